@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "benchmark.hpp"
+
+__DATA_STRUCTURE_START(benchmark runner implementation)
+namespace {
+std::string escape_json_string(const std::string &str) {
+    std::string result {};
+    result.reserve(str.size());
+    for(auto c : str) {
+        if(c == '"' or c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+}
+
+benchmark_runner::benchmark_runner(std::string name, int argc, char *argv[]) :
+        name {std::move(name)}, json_path {this->name + "_benchmark.json"}, element_size {100000},
+        repetition {5}, records {}, sink {0} {
+    for(auto i {1}; i < argc; ++i) {
+        if(std::strcmp(argv[i], "--size") == 0 and i + 1 < argc) {
+            this->element_size = std::strtoull(argv[++i], nullptr, 10);
+        }else if(std::strcmp(argv[i], "--repeat") == 0 and i + 1 < argc) {
+            this->repetition = std::strtoull(argv[++i], nullptr, 10);
+        }else if(std::strcmp(argv[i], "--json") == 0 and i + 1 < argc) {
+            this->json_path = argv[++i];
+        }else {
+            std::cerr << "usage : " << argv[0] << " [--size n] [--repeat n] [--json path]" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    if(this->element_size == 0) {
+        this->element_size = 1;
+    }
+    if(this->repetition == 0) {
+        this->repetition = 1;
+    }
+}
+int benchmark_runner::report() const {
+    char line[256];
+    std::snprintf(line, sizeof line, "%-20s %-12s %-16s %14s %14s %16s %14s\n",
+            "container", "type", "operation", "ns/op", "allocations/op", "deallocations/op", "bytes/op");
+    std::cout << line;
+    for(const auto &r : this->records) {
+        std::snprintf(line, sizeof line, "%-20s %-12s %-16s %14.2f %14.4f %16.4f %14.2f\n", r.container.c_str(),
+                r.type.c_str(), r.operation.c_str(), r.ns_per_operation, r.allocations_per_operation,
+                r.deallocations_per_operation, r.bytes_per_operation);
+        std::cout << line;
+    }
+    std::ofstream json(this->json_path);
+    if(not json) {
+        std::cerr << "Cannot write benchmark result to " << this->json_path << std::endl;
+        return EXIT_FAILURE;
+    }
+    json << "{\n    \"benchmark\" : \"" << escape_json_string(this->name) << "\",\n";
+    json << "    \"size\" : " << this->element_size << ",\n";
+    json << "    \"repetition\" : " << this->repetition << ",\n";
+    json << "    \"results\" : [";
+    for(auto i {0uz}; i < this->records.size(); ++i) {
+        const auto &r {this->records[i]};
+        json << (i == 0 ? "\n" : ",\n");
+        json << "        {\"container\" : \"" << escape_json_string(r.container)
+                << "\", \"type\" : \"" << escape_json_string(r.type)
+                << "\", \"operation\" : \"" << escape_json_string(r.operation)
+                << "\", \"operations\" : " << r.operations
+                << ", \"ns_per_operation\" : " << r.ns_per_operation
+                << ", \"allocations_per_operation\" : " << r.allocations_per_operation
+                << ", \"deallocations_per_operation\" : " << r.deallocations_per_operation
+                << ", \"bytes_per_operation\" : " << r.bytes_per_operation << "}";
+    }
+    json << "\n    ],\n    \"checksum\" : " << this->sink << "\n}\n";
+    std::cout << "Benchmark result has been written to " << this->json_path << std::endl;
+    return EXIT_SUCCESS;
+}
+__DATA_STRUCTURE_END(benchmark runner implementation)
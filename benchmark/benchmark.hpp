@@ -0,0 +1,442 @@
+#ifndef DATA_STRUCTURE_BENCHMARK_HPP
+#define DATA_STRUCTURE_BENCHMARK_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "../source/allocator.hpp"
+
+__DATA_STRUCTURE_START(allocation statistics for benchmark)
+struct allocation_statistics {
+    static inline std::size_t allocation_count {};
+    static inline std::size_t deallocation_count {};
+    static inline std::size_t allocation_bytes {};
+    static void reset() noexcept {
+        allocation_statistics::allocation_count = 0;
+        allocation_statistics::deallocation_count = 0;
+        allocation_statistics::allocation_bytes = 0;
+    }
+    static void record_allocation(std::size_t bytes) noexcept {
+        ++allocation_statistics::allocation_count;
+        allocation_statistics::allocation_bytes += bytes;
+    }
+    static void record_deallocation() noexcept {
+        ++allocation_statistics::deallocation_count;
+    }
+};
+__DATA_STRUCTURE_END(allocation statistics for benchmark)
+
+__DATA_STRUCTURE_START(counting allocators for benchmark)
+/*
+ * Both allocators forward to the default allocator of their own library and only bump the
+ * counters in allocation_statistics, so ds containers and std containers are measured with the
+ * same (negligible) bookkeeping overhead.
+ */
+template <typename T>
+class ds_counting_allocator : public ds::allocator<T> {
+public:
+    using size_type = ds::size_t;
+    using difference_type = ds::ptrdiff_t;
+    using value_type = T;
+public:
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    static constexpr T *allocate(ds::size_t n) noexcept(NoThrow) {
+        if(n not_eq 0) {
+            allocation_statistics::record_allocation(n * sizeof(T));
+        }
+        return ds::allocator<T>::template allocate<NoThrow>(n);
+    }
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    static constexpr T *reallocate(void *source, ds::size_t n) noexcept(NoThrow)
+            requires ds::is_trivially_relocatable_v<T> {
+        if(n not_eq 0) {
+            allocation_statistics::record_allocation(n * sizeof(T));
+        }
+        if(source) {
+            allocation_statistics::record_deallocation();
+        }
+        return ds::allocator<T>::template reallocate<NoThrow>(source, n);
+    }
+    static constexpr void deallocate(void *p) noexcept {
+        if(p) {
+            allocation_statistics::record_deallocation();
+        }
+        ds::allocator<T>::deallocate(p);
+    }
+    static constexpr void deallocate(void *p, ds::size_t) noexcept {
+        ds_counting_allocator::deallocate(p);
+    }
+};
+
+template <typename T>
+struct std_counting_allocator : std::allocator<T> {
+    using value_type = T;
+    template <typename U>
+    struct rebind {
+        using other = std_counting_allocator<U>;
+    };
+    constexpr std_counting_allocator() noexcept = default;
+    template <typename U>
+    constexpr std_counting_allocator(const std_counting_allocator<U> &) noexcept {}
+    [[nodiscard]]
+    T *allocate(std::size_t n) {
+        allocation_statistics::record_allocation(n * sizeof(T));
+        return std::allocator<T>::allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        allocation_statistics::record_deallocation();
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+template <typename T, typename U>
+inline constexpr bool operator==(const std_counting_allocator<T> &, const std_counting_allocator<U> &) noexcept {
+    return true;
+}
+__DATA_STRUCTURE_END(counting allocators for benchmark)
+
+__DATA_STRUCTURE_START(value types for benchmark)
+struct large_pod {
+    std::uint64_t data[32];
+};
+
+template <typename T>
+T make_benchmark_value(std::size_t i) {
+    if constexpr(ds::is_same_v<T, std::string>) {
+        return std::string("benchmark string value #") + std::to_string(i);
+    }else if constexpr(ds::is_same_v<T, large_pod>) {
+        large_pod result {};
+        for(auto &element : result.data) {
+            element = i++;
+        }
+        return result;
+    }else {
+        return static_cast<T>(i);
+    }
+}
+template <typename T>
+std::uint64_t consume_benchmark_value(const T &value) noexcept {
+    if constexpr(ds::is_same_v<T, std::string>) {
+        return value.size();
+    }else if constexpr(ds::is_same_v<T, large_pod>) {
+        return value.data[0] ^ value.data[31];
+    }else {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+template <typename T>
+constexpr const char *benchmark_type_name() noexcept {
+    if constexpr(ds::is_same_v<T, std::string>) {
+        return "std::string";
+    }else if constexpr(ds::is_same_v<T, large_pod>) {
+        return "large_pod";
+    }else if constexpr(ds::is_same_v<T, std::uint64_t>) {
+        return "uint64_t";
+    }else if constexpr(ds::is_same_v<T, double>) {
+        return "double";
+    }else {
+        return "int";
+    }
+}
+__DATA_STRUCTURE_END(value types for benchmark)
+
+__DATA_STRUCTURE_START(benchmark runner)
+class benchmark_runner {
+public:
+    struct record {
+        std::string container;
+        std::string type;
+        std::string operation;
+        std::size_t operations;
+        double ns_per_operation;
+        double allocations_per_operation;
+        double deallocations_per_operation;
+        double bytes_per_operation;
+    };
+private:
+    std::string name;
+    std::string json_path;
+    std::size_t element_size;
+    std::size_t repetition;
+    std::vector<record> records;
+    std::uint64_t sink;
+public:
+    benchmark_runner(std::string name, int argc, char *argv[]);
+    benchmark_runner(const benchmark_runner &) = delete;
+    benchmark_runner &operator=(const benchmark_runner &) = delete;
+    ~benchmark_runner() noexcept = default;
+public:
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return this->element_size;
+    }
+    [[nodiscard]]
+    std::size_t repetitions() const noexcept {
+        return this->repetition;
+    }
+    void consume(std::uint64_t value) noexcept {
+        this->sink += value;
+    }
+    /*
+     * The workload is called repeatedly, and it returns the elapsed time of the measured
+     * region, so that the set up and the tear down of each round are excluded. The fastest
+     * round is reported, the allocation and deallocation counters (which are reset by
+     * benchmark_timer) are averaged over all rounds, so the tear down workloads (e.g. destroy)
+     * report the blocks they free.
+     */
+    template <typename Workload>
+    void run(const char *container, const char *type, const char *operation, std::size_t operations,
+            Workload &&workload) {
+        auto best {std::chrono::nanoseconds::max()};
+        std::size_t allocation_count {0};
+        std::size_t deallocation_count {0};
+        std::size_t allocation_bytes {0};
+        for(auto i {0uz}; i < this->repetition; ++i) {
+            const std::chrono::nanoseconds elapsed {workload()};
+            allocation_count += allocation_statistics::allocation_count;
+            deallocation_count += allocation_statistics::deallocation_count;
+            allocation_bytes += allocation_statistics::allocation_bytes;
+            if(elapsed < best) {
+                best = elapsed;
+            }
+        }
+        const auto divisor {static_cast<double>(operations == 0 ? 1 : operations)};
+        const auto rounds {static_cast<double>(this->repetition)};
+        this->records.push_back({container, type, operation, operations,
+                static_cast<double>(best.count()) / divisor,
+                static_cast<double>(allocation_count) / rounds / divisor,
+                static_cast<double>(deallocation_count) / rounds / divisor,
+                static_cast<double>(allocation_bytes) / rounds / divisor});
+    }
+    // adds a result measured by the caller, e.g. the compile time of a header, which is measured in another process
+    void add(record r) {
+        this->records.push_back(std::move(r));
+    }
+    int report() const;
+};
+
+class benchmark_timer {
+private:
+    std::chrono::steady_clock::time_point start;
+public:
+    benchmark_timer() noexcept {
+        allocation_statistics::reset();
+        this->start = std::chrono::steady_clock::now();
+    }
+public:
+    [[nodiscard]]
+    std::chrono::nanoseconds elapsed() const noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->start);
+    }
+};
+__DATA_STRUCTURE_END(benchmark runner)
+
+__DATA_STRUCTURE_START(sequence container workloads)
+/*
+ * The same workloads are shared by ds containers and their std counterparts. Operations which
+ * are linear for a container (e.g. insertion at the front of a vector) are measured with
+ * size() / 100 operations on a container holding size() elements, constant operations are
+ * measured with size() operations.
+ */
+namespace __data_structure_benchmark {
+template <typename Container>
+concept IsRandomAccessContainer = requires(const Container &c) {
+    c.cbegin() + 1;
+};
+template <typename Container>
+concept IsForwardListContainer = requires(Container &c) {
+    c.before_begin();
+};
+enum class position {
+    front, middle, back
+};
+inline const char *operation_name(const char *operation, position where) {
+    static thread_local std::string name;
+    name = operation;
+    switch(where) {
+        case position::front:
+            name += "_front";
+            break;
+        case position::middle:
+            name += "_middle";
+            break;
+        case position::back:
+            name += "_back";
+            break;
+    }
+    return name.c_str();
+}
+template <typename Container>
+auto iterator_at(Container &c, std::size_t n) {
+    auto it {c.cbegin()};
+    for(; n not_eq 0; --n) {
+        ++it;
+    }
+    return it;
+}
+template <typename Container, typename T>
+void insert_at(benchmark_runner &runner, const char *name, position where, const T &value) {
+    const auto n {runner.size()};
+    const auto operations {n / 100 == 0 ? 1 : n / 100};
+    runner.run(name, benchmark_type_name<T>(), operation_name("insert", where), operations, [&] {
+        Container c(n, value);
+        if constexpr(IsRandomAccessContainer<Container>) {
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < operations; ++i) {
+                const auto size {c.size()};
+                c.insert(c.cbegin() + (where == position::front ? 0 : where == position::middle ? size / 2 : size),
+                        value);
+            }
+            return timer.elapsed();
+        }else if constexpr(IsForwardListContainer<Container>) {
+            auto it {where == position::front ? c.cbefore_begin() :
+                    __data_structure_benchmark::iterator_at(c, where == position::middle ? n / 2 - 1 : n - 1)};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < operations; ++i) {
+                c.insert_after(it, value);
+                if(where == position::back) {
+                    ++it;
+                }
+            }
+            return timer.elapsed();
+        }else {
+            auto it {where == position::front ? c.cbegin() : where == position::back ? c.cend() :
+                    __data_structure_benchmark::iterator_at(c, n / 2)};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < operations; ++i) {
+                if(where == position::front) {
+                    c.insert(c.cbegin(), value);
+                }else {
+                    c.insert(it, value);
+                }
+            }
+            return timer.elapsed();
+        }
+    });
+}
+template <typename Container, typename T>
+void erase_at(benchmark_runner &runner, const char *name, position where, const T &value) {
+    const auto n {runner.size()};
+    const auto operations {n / 100 == 0 ? 1 : n / 100};
+    if(n < 2 * operations + 2) {
+        return;
+    }
+    runner.run(name, benchmark_type_name<T>(), operation_name("erase", where), operations, [&] {
+        Container c(n, value);
+        if constexpr(IsRandomAccessContainer<Container>) {
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < operations; ++i) {
+                const auto size {c.size()};
+                c.erase(c.cbegin() + (where == position::front ? 0 :
+                        where == position::middle ? size / 2 : size - 1));
+            }
+            return timer.elapsed();
+        }else if constexpr(IsForwardListContainer<Container>) {
+            auto it {where == position::front ? c.cbefore_begin() :
+                    __data_structure_benchmark::iterator_at(c, n / 2 - 1)};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < operations; ++i) {
+                c.erase_after(it);
+            }
+            return timer.elapsed();
+        }else {
+            auto it {__data_structure_benchmark::iterator_at(c, n / 2)};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < operations; ++i) {
+                if(where == position::front) {
+                    c.erase(c.cbegin());
+                }else if(where == position::middle) {
+                    auto next {it};
+                    ++next;
+                    c.erase(it);
+                    it = next;
+                }else {
+                    auto last {c.cend()};
+                    c.erase(--last);
+                }
+            }
+            return timer.elapsed();
+        }
+    });
+}
+}
+
+template <typename Container>
+void benchmark_sequence_container(benchmark_runner &runner, const char *name) {
+    namespace __dsb = __data_structure_benchmark;
+    using T = typename Container::value_type;
+    const auto n {runner.size()};
+    const auto type {benchmark_type_name<T>()};
+    const auto value {make_benchmark_value<T>(n)};
+    runner.run(name, type, "construct", n, [&] {
+        std::unique_ptr<Container> c {};
+        benchmark_timer timer {};
+        c.reset(new Container(n, value));
+        return timer.elapsed();
+    });
+    if constexpr(requires(Container &c) { c.push_back(value); }) {
+        runner.run(name, type, "push_back", n, [&] {
+            Container c {};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < n; ++i) {
+                c.push_back(value);
+            }
+            return timer.elapsed();
+        });
+        runner.run(name, type, "emplace_back", n, [&] {
+            Container c {};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < n; ++i) {
+                c.emplace_back(make_benchmark_value<T>(i));
+            }
+            return timer.elapsed();
+        });
+    }
+    if constexpr(requires(Container &c) { c.push_front(value); }) {
+        runner.run(name, type, "push_front", n, [&] {
+            Container c {};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < n; ++i) {
+                c.push_front(value);
+            }
+            return timer.elapsed();
+        });
+        runner.run(name, type, "emplace_front", n, [&] {
+            Container c {};
+            benchmark_timer timer {};
+            for(auto i {0uz}; i < n; ++i) {
+                c.emplace_front(make_benchmark_value<T>(i));
+            }
+            return timer.elapsed();
+        });
+    }
+    for(auto where : {__dsb::position::front, __dsb::position::middle, __dsb::position::back}) {
+        __dsb::insert_at<Container>(runner, name, where, value);
+        if(not __dsb::IsForwardListContainer<Container> or where not_eq __dsb::position::back) {
+            __dsb::erase_at<Container>(runner, name, where, value);
+        }
+    }
+    runner.run(name, type, "iterate", n, [&] {
+        const Container c(n, value);
+        benchmark_timer timer {};
+        std::uint64_t sum {0};
+        for(const auto &element : c) {
+            sum += consume_benchmark_value(element);
+        }
+        const auto elapsed {timer.elapsed()};
+        runner.consume(sum);
+        return elapsed;
+    });
+    runner.run(name, type, "destroy", n, [&] {
+        auto c {std::make_unique<Container>(n, value)};
+        benchmark_timer timer {};
+        c.reset();
+        return timer.elapsed();
+    });
+}
+__DATA_STRUCTURE_END(sequence container workloads)
+
+#endif      //DATA_STRUCTURE_BENCHMARK_HPP
@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#if defined(__unix__) or defined(__APPLE__)
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+extern char **environ;
+#endif
+#include "benchmark.hpp"
+
+/*
+ * The cost of a translation unit which only includes a header of ds, that is, the header is compiled alone (syntax
+ * only) by the compiler of the build. The fastest round is reported in ns/op, and the peak memory of the compiler is
+ * reported in bytes/op. The rows of an empty translation unit and of <deque> with <map> are the baselines. The budgets
+ * are given by CMake (DATA_STRUCTURE_COMPILE_TIME_BUDGET_RATIO, a multiple of the time of <deque> with <map>, and
+ * DATA_STRUCTURE_COMPILE_MEMORY_BUDGET_MB, 0 means no budget), the benchmark fails if a header of ds exceeds one of
+ * them or fails to compile, or if the budgets are not calibrated for the compiler.
+ */
+#ifndef DATA_STRUCTURE_CXX_COMPILER
+#define DATA_STRUCTURE_CXX_COMPILER "c++"
+#endif
+#ifndef DATA_STRUCTURE_CXX_STANDARD_FLAG
+#define DATA_STRUCTURE_CXX_STANDARD_FLAG "-std=c++23"
+#endif
+#ifndef DATA_STRUCTURE_SOURCE_DIRECTORY
+#define DATA_STRUCTURE_SOURCE_DIRECTORY "../source"
+#endif
+#ifndef DATA_STRUCTURE_CXX_COMPILER_NAME
+#define DATA_STRUCTURE_CXX_COMPILER_NAME DATA_STRUCTURE_CXX_COMPILER
+#endif
+#ifndef DATA_STRUCTURE_COMPILE_BUDGET_CALIBRATED
+#define DATA_STRUCTURE_COMPILE_BUDGET_CALIBRATED 0
+#endif
+#ifndef DATA_STRUCTURE_COMPILE_TIME_BUDGET_RATIO
+#define DATA_STRUCTURE_COMPILE_TIME_BUDGET_RATIO 0
+#endif
+#ifndef DATA_STRUCTURE_COMPILE_MEMORY_BUDGET_MB
+#define DATA_STRUCTURE_COMPILE_MEMORY_BUDGET_MB 0
+#endif
+
+namespace {
+struct compilation {
+    std::chrono::nanoseconds elapsed;
+    std::size_t peak_memory;
+    bool succeeded;
+};
+compilation compile(const std::vector<std::string> &arguments) {
+#if defined(__unix__) or defined(__APPLE__)
+    std::vector<char *> argv {};
+    for(const auto &argument : arguments) {
+        argv.push_back(const_cast<char *>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+    const auto start {std::chrono::steady_clock::now()};
+    pid_t pid;
+    if(posix_spawnp(&pid, argv[0], nullptr, nullptr, argv.data(), environ) not_eq 0) {
+        return {{}, 0, false};
+    }
+    // the usage of the compiler driver includes the compiler proper, which is waited by the driver
+    int status {};
+    rusage usage {};
+    if(wait4(pid, &status, 0, &usage) not_eq pid) {
+        return {{}, 0, false};
+    }
+    const auto elapsed {std::chrono::steady_clock::now() - start};
+#ifdef __APPLE__
+    const auto peak_memory {static_cast<std::size_t>(usage.ru_maxrss)};
+#else
+    const auto peak_memory {static_cast<std::size_t>(usage.ru_maxrss) * 1024};
+#endif
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed), peak_memory,
+            WIFEXITED(status) and WEXITSTATUS(status) == 0};
+#else
+    static_cast<void>(arguments);
+    return {{}, 0, false};
+#endif
+}
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("compile_time", argc, argv);
+#if not(defined(__unix__) or defined(__APPLE__))
+    std::cerr << "The compile time benchmark is only supported on POSIX systems" << std::endl;
+    return runner.report();
+#else
+    const std::vector<std::string> command {DATA_STRUCTURE_CXX_COMPILER, DATA_STRUCTURE_CXX_STANDARD_FLAG,
+            "-fsyntax-only", "-x", "c++"};
+    const auto measure {[&](const std::string &name, std::vector<std::string> arguments) {
+        compilation best {std::chrono::nanoseconds::max(), 0, true};
+        for(auto i {0uz}; i < runner.repetitions() and best.succeeded; ++i) {
+            const auto result {compile(arguments)};
+            best.succeeded = result.succeeded;
+            best.elapsed = std::min(best.elapsed, result.elapsed);
+            best.peak_memory = i == 0 ? result.peak_memory : std::min(best.peak_memory, result.peak_memory);
+        }
+        runner.add({name, "TU", "include", 1, static_cast<double>(best.elapsed.count()), 0, 0,
+                static_cast<double>(best.peak_memory)});
+        return best;
+    }};
+
+    auto baseline {command};
+    baseline.emplace_back("/dev/null");
+    measure("<empty>", baseline);
+    baseline.insert(baseline.end() - 1, {"-include", "deque", "-include", "map"});
+    const auto reference {measure("<deque> <map>", baseline)};
+
+    std::vector<std::filesystem::path> headers {};
+    for(const auto &entry : std::filesystem::directory_iterator(DATA_STRUCTURE_SOURCE_DIRECTORY)) {
+        if(entry.path().extension() == ".hpp") {
+            headers.push_back(entry.path());
+        }
+    }
+    std::sort(headers.begin(), headers.end());
+    const auto time_budget {std::chrono::duration_cast<std::chrono::milliseconds>(
+            reference.elapsed * static_cast<double>(DATA_STRUCTURE_COMPILE_TIME_BUDGET_RATIO))};
+    constexpr auto memory_budget {static_cast<std::size_t>(DATA_STRUCTURE_COMPILE_MEMORY_BUDGET_MB) * 1024 * 1024};
+    auto failed {not reference.succeeded or not DATA_STRUCTURE_COMPILE_BUDGET_CALIBRATED};
+    if(not reference.succeeded) {
+        std::cerr << "<deque> with <map> cannot be compiled, so there is no time budget" << std::endl;
+    }
+    if(not DATA_STRUCTURE_COMPILE_BUDGET_CALIBRATED) {
+        std::cerr << "The compile budgets are not calibrated for " << DATA_STRUCTURE_CXX_COMPILER_NAME
+                << ", give DATA_STRUCTURE_COMPILE_MEMORY_BUDGET_MB and DATA_STRUCTURE_COMPILE_TIME_BUDGET_RATIO"
+                << " to CMake" << std::endl;
+    }
+    for(const auto &header : headers) {
+        auto arguments {command};
+        arguments.push_back(header.string());
+        const auto name {header.filename().string()};
+        const auto result {measure(name, arguments)};
+        if(not result.succeeded) {
+            std::cerr << name << " cannot be compiled alone" << std::endl;
+            failed = true;
+        }else if(reference.succeeded and time_budget.count() not_eq 0 and result.elapsed > time_budget) {
+            std::cerr << name << " exceeds the compile time budget of " << time_budget.count() << " ms ("
+                    << DATA_STRUCTURE_COMPILE_TIME_BUDGET_RATIO << " times <deque> with <map>)" << std::endl;
+            failed = true;
+        }else if(memory_budget not_eq 0 and result.peak_memory > memory_budget) {
+            std::cerr << name << " exceeds the compile memory budget of " << DATA_STRUCTURE_COMPILE_MEMORY_BUDGET_MB
+                    << " MiB" << std::endl;
+            failed = true;
+        }
+    }
+    const auto reported {runner.report()};
+    return failed ? EXIT_FAILURE : reported;
+#endif
+}
@@ -0,0 +1,20 @@
+#include <deque>
+#include "benchmark.hpp"
+#include "../source/deque.hpp"
+
+template <typename T>
+void deque_benchmark(benchmark_runner &runner) {
+    benchmark_sequence_container<ds::deque<T, ds_counting_allocator<T>>>(runner, "ds::deque");
+    // 64 KiB blocks instead of the default 4 KiB ones (16 elements for the large elements)
+    benchmark_sequence_container<ds::deque<T, ds_counting_allocator<T>, ds::deque_block_size<T, 64 * 1024>>>(runner,
+            "ds::deque<64KiB>");
+    benchmark_sequence_container<std::deque<T, std_counting_allocator<T>>>(runner, "std::deque");
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("deque", argc, argv);
+    deque_benchmark<int>(runner);
+    deque_benchmark<std::string>(runner);
+    deque_benchmark<large_pod>(runner);
+    return runner.report();
+}
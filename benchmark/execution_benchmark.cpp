@@ -0,0 +1,87 @@
+#include <random>
+#include "benchmark.hpp"
+#include "../source/execution.hpp"
+#include "../source/deque.hpp"
+
+namespace {
+/*
+ * Every algorithm runs serially and with execution::par on the global thread pool, whose concurrency is the count
+ * of the hardware threads, so the speedup is the ratio of the two rows. The serial rows of ds::deque are the
+ * segmented algorithms, which walk the blocks as contiguous spans (copy is a memmove per block).
+ */
+template <typename Container>
+Container generate_container(std::size_t n) {
+    std::mt19937_64 engine {n};
+    Container result {};
+    for(auto i {0uz}; i < n; ++i) {
+        result.push_back(static_cast<typename Container::value_type>(engine() >> 1));
+    }
+    return result;
+}
+template <typename Container>
+void run_algorithms(benchmark_runner &runner, const char *container) {
+    using T = typename Container::value_type;
+    const auto source {generate_container<Container>(runner.size())};
+    for(const auto parallel : {false, true}) {
+        runner.run(container, benchmark_type_name<T>(), parallel ? "for_each_par" : "for_each", runner.size(), [&] {
+            auto c {source};
+            benchmark_timer timer {};
+            const auto f {[](T &value) noexcept {
+                value = value * 3 + 1;
+            }};
+            if(parallel) {
+                ds::for_each(ds::execution::par, c, f);
+            }else {
+                ds::for_each(c.begin(), c.end(), f);
+            }
+            const auto elapsed {timer.elapsed()};
+            runner.consume(consume_benchmark_value(c[c.size() / 2]));
+            return elapsed;
+        });
+        runner.run(container, benchmark_type_name<T>(), parallel ? "reduce_par" : "reduce", runner.size(), [&] {
+            benchmark_timer timer {};
+            T result {};
+            if(parallel) {
+                result = ds::reduce(ds::execution::par, source, T {});
+            }else {
+                result = ds::accumulate(source.begin(), source.end(), T {});
+            }
+            const auto elapsed {timer.elapsed()};
+            runner.consume(consume_benchmark_value(result));
+            return elapsed;
+        });
+        runner.run(container, benchmark_type_name<T>(), parallel ? "copy_par" : "copy", runner.size(), [&] {
+            ds::vector<T> result(source.size());
+            benchmark_timer timer {};
+            if(parallel) {
+                ds::copy(ds::execution::par, source, result.begin());
+            }else {
+                ds::copy(source.begin(), source.end(), result.begin());
+            }
+            const auto elapsed {timer.elapsed()};
+            runner.consume(consume_benchmark_value(result[result.size() / 2]));
+            return elapsed;
+        });
+        runner.run(container, benchmark_type_name<T>(), parallel ? "sort_par" : "sort", runner.size(), [&] {
+            auto c {source};
+            benchmark_timer timer {};
+            if(parallel) {
+                ds::sort(ds::execution::par, c);
+            }else {
+                ds::sort(c.begin(), c.end());
+            }
+            const auto elapsed {timer.elapsed()};
+            runner.consume(consume_benchmark_value(c[c.size() / 2]));
+            return elapsed;
+        });
+    }
+}
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("execution", argc, argv);
+    run_algorithms<ds::vector<std::uint64_t>>(runner, "ds::vector");
+    run_algorithms<ds::deque<std::uint64_t>>(runner, "ds::deque");
+    run_algorithms<ds::vector<double>>(runner, "ds::vector");
+    return runner.report();
+}
@@ -0,0 +1,17 @@
+#include <forward_list>
+#include "benchmark.hpp"
+#include "../source/forward_list.hpp"
+
+template <typename T>
+void forward_list_benchmark(benchmark_runner &runner) {
+    benchmark_sequence_container<ds::forward_list<T, ds_counting_allocator<T>>>(runner, "ds::forward_list");
+    benchmark_sequence_container<std::forward_list<T, std_counting_allocator<T>>>(runner, "std::forward_list");
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("forward_list", argc, argv);
+    forward_list_benchmark<int>(runner);
+    forward_list_benchmark<std::string>(runner);
+    forward_list_benchmark<large_pod>(runner);
+    return runner.report();
+}
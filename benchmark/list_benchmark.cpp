@@ -0,0 +1,17 @@
+#include <list>
+#include "benchmark.hpp"
+#include "../source/list.hpp"
+
+template <typename T>
+void list_benchmark(benchmark_runner &runner) {
+    benchmark_sequence_container<ds::list<T, ds_counting_allocator<T>>>(runner, "ds::list");
+    benchmark_sequence_container<std::list<T, std_counting_allocator<T>>>(runner, "std::list");
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("list", argc, argv);
+    list_benchmark<int>(runner);
+    list_benchmark<std::string>(runner);
+    list_benchmark<large_pod>(runner);
+    return runner.report();
+}
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <deque>
+#include <random>
+#include "benchmark.hpp"
+#include "../source/sort.hpp"
+#include "../source/deque.hpp"
+
+namespace {
+/*
+ * The keys are random unless the pattern is sorted, so every round sorts the same sequence which is copied into
+ * the container before the timer starts.
+ */
+template <typename T>
+std::vector<T> generate_keys(std::size_t n, bool sorted) {
+    std::mt19937_64 engine {n};
+    std::vector<T> result {};
+    result.reserve(n);
+    for(auto i {0uz}; i < n; ++i) {
+        if constexpr(ds::is_same_v<T, std::string>) {
+            result.push_back(std::to_string(engine()));
+        }else if constexpr(ds::is_floating_point_v<T>) {
+            result.push_back(static_cast<T>(engine()) / static_cast<T>(engine() | 1) - static_cast<T>(0.5));
+        }else {
+            result.push_back(static_cast<T>(engine()));
+        }
+    }
+    if(sorted) {
+        std::sort(result.begin(), result.end());
+    }
+    return result;
+}
+template <typename T, typename Sort>
+void run_contiguous(benchmark_runner &runner, const char *container, const char *operation,
+        const std::vector<T> &keys, Sort &&sort) {
+    runner.run(container, benchmark_type_name<T>(), operation, keys.size(), [&] {
+        auto v {keys};
+        benchmark_timer timer {};
+        sort(v.data(), v.data() + v.size());
+        const auto elapsed {timer.elapsed()};
+        runner.consume(consume_benchmark_value(v[v.size() / 2]));
+        return elapsed;
+    });
+}
+template <typename Deque>
+void run_deque(benchmark_runner &runner, const char *container, const char *operation,
+        const std::vector<typename Deque::value_type> &keys) {
+    using T = typename Deque::value_type;
+    runner.run(container, benchmark_type_name<T>(), operation, keys.size(), [&] {
+        Deque d {};
+        for(const auto &key : keys) {
+            d.push_back(key);
+        }
+        benchmark_timer timer {};
+        if constexpr(ds::is_same_v<Deque, std::deque<T, std_counting_allocator<T>>>) {
+            std::sort(d.begin(), d.end());
+        }else {
+            ds::sort(d.begin(), d.end());
+        }
+        const auto elapsed {timer.elapsed()};
+        runner.consume(consume_benchmark_value(d[d.size() / 2]));
+        return elapsed;
+    });
+}
+}
+
+template <typename T>
+void sort_benchmark(benchmark_runner &runner) {
+    for(const auto sorted : {false, true}) {
+        const auto keys {generate_keys<T>(runner.size(), sorted)};
+        run_contiguous(runner, "ds::sort", sorted ? "sorted" : "random", keys, [](T *begin, T *end) {
+            ds::sort(begin, end);
+        });
+        run_contiguous(runner, "std::sort", sorted ? "sorted" : "random", keys, [](T *begin, T *end) {
+            std::sort(begin, end);
+        });
+        if constexpr(ds::is_arithmetic_v<T>) {
+            run_contiguous(runner, "ds::radix_sort", sorted ? "sorted" : "random", keys, [](T *begin, T *end) {
+                ds::radix_sort(begin, end);
+            });
+        }
+        run_deque<ds::deque<T, ds_counting_allocator<T>>>(runner, "ds::deque", sorted ? "sort_sorted" : "sort", keys);
+        run_deque<std::deque<T, std_counting_allocator<T>>>(runner, "std::deque", sorted ? "sort_sorted" : "sort",
+                keys);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("sort", argc, argv);
+    sort_benchmark<std::uint64_t>(runner);
+    sort_benchmark<int>(runner);
+    sort_benchmark<double>(runner);
+    sort_benchmark<std::string>(runner);
+    return runner.report();
+}
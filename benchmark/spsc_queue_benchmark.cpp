@@ -0,0 +1,108 @@
+#include <mutex>
+#include <thread>
+#include "benchmark.hpp"
+#include "../source/spsc_queue.hpp"
+#include "../source/deque.hpp"
+
+namespace {
+/*
+ * One producer thread sends size() integers to the consumer (the calling thread), which is measured from the start of
+ * the producer to the last element received. The baseline is ds::deque guarded by a mutex, which is the queue we had
+ * before spsc_queue. Both sides yield when the queue is full or empty, so the numbers are meaningful on one core too.
+ */
+constexpr std::size_t capacity {1024};
+constexpr std::size_t batch_size {64};
+
+void run_mutex_deque(benchmark_runner &runner) {
+    const auto n {runner.size()};
+    runner.run("ds::deque+mutex", benchmark_type_name<std::uint64_t>(), "transfer", n, [&] {
+        ds::deque<std::uint64_t> q {};
+        std::mutex lock {};
+        std::uint64_t sum {0};
+        benchmark_timer timer {};
+        std::thread producer([&] {
+            for(auto i {0uz}; i < n;) {
+                {
+                    std::lock_guard guard {lock};
+                    if(q.size() < capacity) {
+                        q.push_back(i++);
+                        continue;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        });
+        for(auto received {0uz}; received < n;) {
+            {
+                std::lock_guard guard {lock};
+                if(not q.empty()) {
+                    sum += q.front();
+                    q.pop_front();
+                    ++received;
+                    continue;
+                }
+            }
+            std::this_thread::yield();
+        }
+        producer.join();
+        const auto elapsed {timer.elapsed()};
+        runner.consume(sum);
+        return elapsed;
+    });
+}
+void run_spsc_queue(benchmark_runner &runner, bool batched) {
+    const auto n {runner.size()};
+    runner.run("ds::spsc_queue", benchmark_type_name<std::uint64_t>(), batched ? "transfer_n" : "transfer", n, [&] {
+        ds::spsc_queue<std::uint64_t> q(capacity);
+        std::uint64_t sum {0};
+        benchmark_timer timer {};
+        std::thread producer([&] {
+            std::uint64_t buffer[batch_size];
+            for(auto i {0uz}; i < n;) {
+                auto pushed {0uz};
+                if(batched) {
+                    const auto count {n - i < batch_size ? n - i : batch_size};
+                    for(auto j {0uz}; j < count; ++j) {
+                        buffer[j] = i + j;
+                    }
+                    pushed = q.push_n(buffer, count);
+                }else {
+                    pushed = q.try_push(i);
+                }
+                if(pushed == 0) {
+                    std::this_thread::yield();
+                }
+                i += pushed;
+            }
+        });
+        std::uint64_t buffer[batch_size];
+        for(auto received {0uz}; received < n;) {
+            auto popped {0uz};
+            if(batched) {
+                popped = q.pop_n(buffer, batch_size);
+            }else {
+                popped = q.try_pop(buffer[0]);
+            }
+            if(popped == 0) {
+                std::this_thread::yield();
+            }
+            for(auto j {0uz}; j < popped; ++j) {
+                sum += buffer[j];
+            }
+            received += popped;
+        }
+        producer.join();
+        const auto elapsed {timer.elapsed()};
+        runner.consume(sum);
+        return elapsed;
+    });
+}
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("spsc_queue", argc, argv);
+    run_mutex_deque(runner);
+    run_spsc_queue(runner, false);
+    run_spsc_queue(runner, true);
+    return runner.report();
+}
@@ -0,0 +1,17 @@
+#include <vector>
+#include "benchmark.hpp"
+#include "../source/vector.hpp"
+
+template <typename T>
+void vector_benchmark(benchmark_runner &runner) {
+    benchmark_sequence_container<ds::vector<T, ds_counting_allocator<T>>>(runner, "ds::vector");
+    benchmark_sequence_container<std::vector<T, std_counting_allocator<T>>>(runner, "std::vector");
+}
+
+int main(int argc, char *argv[]) {
+    benchmark_runner runner("vector", argc, argv);
+    vector_benchmark<int>(runner);
+    vector_benchmark<std::string>(runner);
+    vector_benchmark<large_pod>(runner);
+    return runner.report();
+}
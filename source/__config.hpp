@@ -21,10 +21,20 @@
 #include <initializer_list>
 #include <compare>
 #include <exception>
+#include <stdexcept>
+#include <cassert>
+#if defined(_MSC_VER) || defined(__linux__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
 
 #define __DATA_STRUCTURE_START(x, ...)
 #define __DATA_STRUCTURE_END(x, ...)
 
+// checked in debug builds only, the message should be a string literal
+#define __DATA_STRUCTURE_DEBUG_ASSERT(condition, message) assert((condition) and message)
+
 namespace data_structure {      // data structure namespace creation
 
 __DATA_STRUCTURE_START(basic type definition)
@@ -99,12 +109,85 @@ inline constexpr void *memory_contiguous_allocation(size_t num, size_t size) noe
 inline constexpr void *memory_reallocation(void *ptr, size_t size) noexcept {
     return std::realloc(ptr, size);
 }
+/*
+ * Try to grow (or shrink) the memory allocated by memory_allocation to size bytes without
+ * moving it, returns false if it's impossible. Only _expand of MSVC could really grow a block
+ * beyond its size class. glibc and macOS have no such function, so a block grows there only
+ * within the slack of its size class, and a container doubling its capacity is moved almost
+ * always. The bytes up to the usable size belong to the block on both of them, so the block
+ * is neither touched nor resized there.
+ */
+[[nodiscard]]
+inline bool memory_expansion(void *ptr, size_t size) noexcept {
+#if defined(_MSC_VER)
+    return _expand(ptr, size) not_eq nullptr;
+#elif defined(__APPLE__)
+    return malloc_size(ptr) >= size;
+#elif defined(__GLIBC__)
+    return malloc_usable_size(ptr) >= size;
+#else
+    return false;
+#endif
+}
+/*
+ * Returns the number of bytes which the memory allocated by memory_allocation could really hold, or zero if it can't
+ * be queried on this platform
+ */
+[[nodiscard]]
+inline size_t memory_usable_size(void *ptr) noexcept {
+#if defined(_MSC_VER)
+    return _msize(ptr);
+#elif defined(__APPLE__)
+    return malloc_size(ptr);
+#elif defined(__linux__)
+    return malloc_usable_size(ptr);
+#else
+    return 0;
+#endif
+}
 template <typename T = char>
 inline constexpr void *memory_default_initialization(void *start, size_t size) noexcept {
     return __builtin_memset(start, 0, size * sizeof(T));
 }
 __DATA_STRUCTURE_END(memory functions)
 
+__DATA_STRUCTURE_START(bit functions)
+/*
+ * The words are unsigned and no wider than unsigned long long, the result of countr_zero or countl_zero is
+ * the width of the word if the word is zero
+ */
+template <typename Word>
+[[nodiscard]]
+inline constexpr int popcount(Word word) noexcept {
+    return __builtin_popcountll(static_cast<unsigned long long>(word));
+}
+template <typename Word>
+[[nodiscard]]
+inline constexpr int countr_zero(Word word) noexcept {
+    return word == 0 ? static_cast<int>(sizeof(Word) * 8) : __builtin_ctzll(static_cast<unsigned long long>(word));
+}
+template <typename Word>
+[[nodiscard]]
+inline constexpr int countl_zero(Word word) noexcept {
+    constexpr auto padding {static_cast<int>((sizeof(unsigned long long) - sizeof(Word)) * 8)};
+    return word == 0 ? static_cast<int>(sizeof(Word) * 8) :
+            __builtin_clzll(static_cast<unsigned long long>(word)) - padding;
+}
+// the smallest power of two not less than the word, std::length_error is thrown if it is not representable by Word
+template <typename Word>
+[[nodiscard]]
+inline constexpr Word bit_ceil(Word word) {
+    if(word <= 1) {
+        return 1;
+    }
+    const auto shift {static_cast<int>(sizeof(Word) * 8) - countl_zero(static_cast<Word>(word - 1))};
+    if(shift == static_cast<int>(sizeof(Word) * 8)) {
+        throw std::length_error {"ds::bit_ceil : the power of two is not representable!"};
+    }
+    return static_cast<Word>(static_cast<Word>(1) << shift);
+}
+__DATA_STRUCTURE_END(bit functions)
+
 __DATA_STRUCTURE_START(exceptional functions)
 [[noreturn]]
 inline void abort() noexcept {
@@ -0,0 +1,252 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_ALGORITHM_HPP
+#define DATA_STRUCTURE_ALGORITHM_HPP
+
+#include "compare.hpp"
+#include "simd_algorithm.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(segmented iteration)
+/*
+ * for_each_segment calls f(first, last) for every contiguous piece of [begin, end) in order. The pieces of a
+ * segmented range (e.g. ds::deque or a subrange of it) are the parts of its blocks, and first and last are pointers,
+ * so the loops over a piece have no block boundary check and could be vectorized. The other ranges are a single
+ * piece, f is called with begin and end. f is not called for the empty range.
+ */
+template <IsInputIterator InputIterator, typename Function>
+constexpr void for_each_segment(InputIterator begin, InputIterator end, Function f) {
+    if constexpr(__dsa::is_segmented_iterator_v<InputIterator>) {
+        using traits = __dsa::segmented_iterator_traits<InputIterator>;
+        auto segment {traits::segment(begin)};
+        const auto last_segment {traits::segment(end)};
+        auto local {traits::local(begin)};
+        for(; segment not_eq last_segment; local = traits::begin(++segment)) {
+            f(local, traits::end(segment));
+        }
+        if(local not_eq traits::local(end)) {
+            f(local, traits::local(end));
+        }
+    }else if(begin not_eq end) {
+        f(begin, end);
+    }
+}
+template <IsRange Range, typename Function>
+inline constexpr void for_each_segment(Range &&range, Function f) {
+    ds::for_each_segment(ds::begin(range), ds::end(range), ds::move(f));
+}
+__DATA_STRUCTURE_END(segmented iteration)
+
+__DATA_STRUCTURE_START(search algorithms)
+template <IsInputIterator InputIterator, typename T>
+[[nodiscard]]
+constexpr InputIterator find(InputIterator begin, InputIterator end, const T &value) {
+    if constexpr(__dsa::is_segmented_iterator_v<InputIterator>) {
+        // every block is searched by the vectorized kernel
+        using traits = __dsa::segmented_iterator_traits<InputIterator>;
+        auto segment {traits::segment(begin)};
+        const auto last_segment {traits::segment(end)};
+        auto local {traits::local(begin)};
+        for(; segment not_eq last_segment; local = traits::begin(++segment)) {
+            const auto segment_end {traits::end(segment)};
+            const auto result {ds::find(local, segment_end, value)};
+            if(result not_eq segment_end) {
+                return traits::compose(segment, result);
+            }
+        }
+        return traits::compose(segment, ds::find(local, traits::local(end), value));
+    }else if constexpr(__dsa::is_vectorizable_iterator_v<InputIterator, T>) {
+        if(not ds::is_constant_evaluated() and begin not_eq end) {
+            const auto first {ds::address_of(*begin)};
+            return begin + (__dsi::vectorized_find<T>(first, first + (end - begin), value) - first);
+        }
+    }
+    while(begin not_eq end and not(*begin == value)) {
+        ++begin;
+    }
+    return begin;
+}
+template <IsInputIterator InputIterator, typename T>
+[[nodiscard]]
+constexpr typename iterator_traits<InputIterator>::difference_type
+count(InputIterator begin, InputIterator end, const T &value) {
+    using difference_type = typename iterator_traits<InputIterator>::difference_type;
+    if constexpr(__dsa::is_vectorizable_iterator_v<InputIterator, T>) {
+        if(not ds::is_constant_evaluated() and begin not_eq end) {
+            const auto first {ds::address_of(*begin)};
+            return static_cast<difference_type>(__dsi::vectorized_count<T>(first, first + (end - begin), value));
+        }
+    }
+    difference_type result {0};
+    for(; begin not_eq end; ++begin) {
+        if(*begin == value) {
+            ++result;
+        }
+    }
+    return result;
+}
+template <IsForwardIterator ForwardIterator>
+[[nodiscard]]
+constexpr ForwardIterator min_element(ForwardIterator begin, ForwardIterator end) {
+    if constexpr(__dsa::is_vectorizable_iterator_v<ForwardIterator>) {
+        if(not ds::is_constant_evaluated() and begin not_eq end) {
+            using value_type = remove_cv_t<typename iterator_traits<ForwardIterator>::value_type>;
+            const auto first {ds::address_of(*begin)};
+            const auto last {first + (end - begin)};
+            const auto value {__dsi::vectorized_extreme<value_type, true>(first, last)};
+            return begin + (__dsi::vectorized_find(first, last, value) - first);
+        }
+    }
+    auto result {begin};
+    if(begin not_eq end) {
+        while(++begin not_eq end) {
+            if(*begin < *result) {
+                result = begin;
+            }
+        }
+    }
+    return result;
+}
+template <IsForwardIterator ForwardIterator>
+[[nodiscard]]
+constexpr ForwardIterator max_element(ForwardIterator begin, ForwardIterator end) {
+    if constexpr(__dsa::is_vectorizable_iterator_v<ForwardIterator>) {
+        if(not ds::is_constant_evaluated() and begin not_eq end) {
+            using value_type = remove_cv_t<typename iterator_traits<ForwardIterator>::value_type>;
+            const auto first {ds::address_of(*begin)};
+            const auto last {first + (end - begin)};
+            const auto value {__dsi::vectorized_extreme<value_type, false>(first, last)};
+            return begin + (__dsi::vectorized_find(first, last, value) - first);
+        }
+    }
+    auto result {begin};
+    if(begin not_eq end) {
+        while(++begin not_eq end) {
+            if(*result < *begin) {
+                result = begin;
+            }
+        }
+    }
+    return result;
+}
+__DATA_STRUCTURE_END(search algorithms)
+
+__DATA_STRUCTURE_START(modifying and numeric algorithms)
+/*
+ * The segmented ranges are processed block by block, copy is a memmove per block for the trivially copyable
+ * elements, and fill is a memset for the byte sized integers.
+ */
+template <IsInputIterator InputIterator, typename Function>
+constexpr Function for_each(InputIterator begin, InputIterator end, Function f) {
+    if constexpr(__dsa::is_segmented_iterator_v<InputIterator>) {
+        ds::for_each_segment(begin, end, [&f](auto first, auto last) {
+            for(; first not_eq last; ++first) {
+                f(*first);
+            }
+        });
+    }else {
+        for(; begin not_eq end; ++begin) {
+            f(*begin);
+        }
+    }
+    return f;
+}
+template <IsInputIterator InputIterator, IsIterator OutputIterator>
+constexpr OutputIterator copy(InputIterator begin, InputIterator end, OutputIterator out) {
+    using value_type = remove_cv_t<typename iterator_traits<InputIterator>::value_type>;
+    if constexpr(__dsa::is_segmented_iterator_v<InputIterator>) {
+        ds::for_each_segment(begin, end, [&out](auto first, auto last) {
+            out = ds::copy(first, last, out);
+        });
+        return out;
+    }else if constexpr(__dsa::is_segmented_iterator_v<OutputIterator> and is_random_access_iterator_v<InputIterator>) {
+        // the input is split by the blocks of the output
+        using traits = __dsa::segmented_iterator_traits<OutputIterator>;
+        auto n {static_cast<ptrdiff_t>(end - begin)};
+        while(n > 0) {
+            const auto local {traits::local(out)};
+            const auto space {static_cast<ptrdiff_t>(traits::end(traits::segment(out)) - local)};
+            const auto step {n < space ? n : space};
+            ds::copy(begin, begin + step, local);
+            begin += step;
+            out += step;
+            n -= step;
+        }
+        return out;
+    }else {
+        if constexpr(is_contiguous_iterator_v<InputIterator> and is_contiguous_iterator_v<OutputIterator> and
+                is_trivially_copyable_v<value_type> and
+                is_same_v<value_type, remove_cv_t<typename iterator_traits<OutputIterator>::value_type>>) {
+            if(not ds::is_constant_evaluated()) {
+                const auto n {end - begin};
+                if(n not_eq 0) {
+                    ds::memory_move(ds::address_of(*out), ds::address_of(*begin),
+                            sizeof(value_type) * static_cast<size_t>(n));
+                }
+                return out + n;
+            }
+        }
+        for(; begin not_eq end; ++begin, static_cast<void>(++out)) {
+            *out = *begin;
+        }
+        return out;
+    }
+}
+template <IsForwardIterator ForwardIterator, typename T>
+constexpr void fill(ForwardIterator begin, ForwardIterator end, const T &value) {
+    using value_type = remove_cv_t<typename iterator_traits<ForwardIterator>::value_type>;
+    if constexpr(__dsa::is_segmented_iterator_v<ForwardIterator>) {
+        ds::for_each_segment(begin, end, [&value](auto first, auto last) {
+            ds::fill(first, last, value);
+        });
+    }else {
+        if constexpr(is_contiguous_iterator_v<ForwardIterator> and is_integral_v<value_type> and
+                sizeof(value_type) == 1) {
+            if(not ds::is_constant_evaluated()) {
+                if(begin not_eq end) {
+                    const auto byte {static_cast<value_type>(value)};
+                    ds::memory_set(ds::address_of(*begin), *reinterpret_cast<const unsigned char *>(&byte),
+                            static_cast<size_t>(end - begin));
+                }
+                return;
+            }
+        }
+        for(; begin not_eq end; ++begin) {
+            *begin = value;
+        }
+    }
+}
+template <IsInputIterator InputIterator, typename T, typename BinaryOperation = plus<>>
+[[nodiscard]]
+constexpr T accumulate(InputIterator begin, InputIterator end, T init, BinaryOperation op = {}) {
+    if constexpr(__dsa::is_segmented_iterator_v<InputIterator>) {
+        ds::for_each_segment(begin, end, [&](auto first, auto last) {
+            init = ds::accumulate(first, last, ds::move(init), op);
+        });
+    }else {
+        for(; begin not_eq end; ++begin) {
+            init = op(ds::move(init), *begin);
+        }
+    }
+    return init;
+}
+__DATA_STRUCTURE_END(modifying and numeric algorithms)
+
+}       // namespace data_structure
+
+#endif      //DATA_STRUCTURE_ALGORITHM_HPP
\ No newline at end of file
@@ -27,14 +27,24 @@ namespace data_structure {
  * to customize your own allocator, it's essential to follow the detailed specifications :
  * (1) The nothrow attribution of member function `allocate` is determined by the first
  *     non-type template parameter `NoThrow`, the default value of `NoThrow` is false;
- * (2) The allocator should support reallocation by providing member function `reallocate`;
+ * (2) The allocator should support reallocation by providing member function `reallocate`,
+ *     which is only required for the trivially relocatable value_type, because the elements
+ *     are moved by copying bytes;
  * (3) The member function `deallocate` should be marked as noexcept, and if there exists
  *     deallocating memory in other member functions, the operation should also be nothrow;
  * (4) The copy and move operations of allocator, size_type, difference_type, pointer,
  *     const_pointer, reference, const_reference and rvalue_reference should be nothrow;
  * (5) If the allocation size is zero, no memory should be allocated and nullptr is the
  *     returning value. Especially note that if the reallocation size is zero, the source
- *     memory should be deallocated.
+ *     memory should be deallocated;
+ * (6) Optionally, the allocator could support growing a block in place by providing member
+ *     function `try_expand(void *p, size_t n) noexcept`, which makes the block pointed by p be
+ *     able to hold n elements without moving it and returns true, or returns false and leaves
+ *     the block untouched. Containers try it before falling back to allocation and movement;
+ * (7) Optionally, the allocator could report the real capacity of a block by providing member
+ *     function `usable_size(void *p, size_t n) noexcept`, where p is allocated for n elements,
+ *     the result is the number of elements the block could hold, which is not less than n. The
+ *     block could be deallocated with either size afterwards.
 */
 __DATA_STRUCTURE_START(universal allocator)
 // Todo : consider the move operation on limited memory range
@@ -59,23 +69,17 @@ public:
         if(n == 0) {
             return nullptr;
         }
-        if constexpr(is_trivially_copyable_v<T>) {
-            auto memory {static_cast<T *>(ds::memory_allocation(n * sizeof(T)))};
-            if constexpr(not NoThrow) {
-                if(not memory) {
-                    throw std::bad_alloc {};
-                }
+        auto memory {static_cast<T *>(ds::memory_allocation(n * sizeof(T)))};
+        if constexpr(not NoThrow) {
+            if(not memory) {
+                throw std::bad_alloc {};
             }
-            return memory;
         }
-        if constexpr(NoThrow) {
-            return static_cast<T *>(::operator new(n * sizeof(T), ds::nothrow));
-        }
-        return static_cast<T *>(::operator new(n * sizeof(T)));
+        return memory;
     }
     template <bool NoThrow = false>
     [[nodiscard]]
-    static constexpr T *reallocate(void *source, size_t n) noexcept(NoThrow) requires is_trivially_copyable_v<T> {
+    static constexpr T *reallocate(void *source, size_t n) noexcept(NoThrow) requires is_trivially_relocatable_v<T> {
         if(n == 0) {
             ds::memory_free(source);
             return nullptr;
@@ -88,11 +92,18 @@ public:
         }
         return memory;
     }
+    [[nodiscard]]
+    static constexpr bool try_expand(void *p, size_t n) noexcept {
+        return p and ds::memory_expansion(p, n * sizeof(T));
+    }
+    [[nodiscard]]
+    static constexpr size_t usable_size(void *p, size_t n) noexcept {
+        // the slack is claimed through memory_expansion, which resizes the block where the allocator tracks its size
+        const auto usable {p ? ds::memory_usable_size(p) / sizeof(T) : 0};
+        return usable > n and ds::memory_expansion(p, usable * sizeof(T)) ? usable : n;
+    }
     static constexpr void deallocate(void *p) noexcept {
-        if constexpr(is_trivially_copyable_v<T>) {
-            return ds::memory_free(p);
-        }
-        ::operator delete(p, ds::nothrow);
+        ds::memory_free(p);
     }
     static constexpr void deallocate(void *p, size_t) noexcept {
         allocator::deallocate(p);
@@ -110,6 +121,492 @@ inline consteval bool operator!=(const allocator<T> &, const allocator<U> &) noe
 }
 __DATA_STRUCTURE_END(universal allocator)
 
+__DATA_STRUCTURE_START(allocation statistics)
+/*
+ * The counters are updated by relaxed atomic operations, so the allocations of different threads
+ * are all recorded, but a copy of the statistics is not a consistent snapshot while others allocate.
+ */
+class allocation_statistics {
+public:
+    /*
+     * The bucket i of the histogram counts the requests of [2^i, 2^(i + 1)) bytes, the
+     * requests of reallocation are counted by their new size.
+     */
+    constexpr static auto histogram_size {sizeof(size_t) * 8};
+private:
+    size_t allocate_count {};
+    size_t reallocate_count {};
+    size_t deallocate_count {};
+    size_t live {};
+    size_t peak {};
+    size_t request_histogram[histogram_size] {};
+private:
+    [[nodiscard]]
+    static size_t load(const size_t &counter) noexcept {
+        return __atomic_load_n(ds::address_of(counter), __ATOMIC_RELAXED);
+    }
+    static void store(size_t &counter, size_t value) noexcept {
+        __atomic_store_n(ds::address_of(counter), value, __ATOMIC_RELAXED);
+    }
+    static size_t add(size_t &counter, size_t n) noexcept {
+        return __atomic_add_fetch(ds::address_of(counter), n, __ATOMIC_RELAXED);
+    }
+    void raise_peak(size_t live_bytes) noexcept {
+        auto peak_bytes {allocation_statistics::load(this->peak)};
+        while(live_bytes > peak_bytes and not __atomic_compare_exchange_n(ds::address_of(this->peak), ds::address_of(peak_bytes),
+                live_bytes, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    }
+public:
+    constexpr allocation_statistics() noexcept = default;
+    allocation_statistics(const allocation_statistics &rhs) noexcept {
+        *this = rhs;
+    }
+    constexpr ~allocation_statistics() noexcept = default;
+public:
+    allocation_statistics &operator=(const allocation_statistics &rhs) noexcept {
+        allocation_statistics::store(this->allocate_count, allocation_statistics::load(rhs.allocate_count));
+        allocation_statistics::store(this->reallocate_count, allocation_statistics::load(rhs.reallocate_count));
+        allocation_statistics::store(this->deallocate_count, allocation_statistics::load(rhs.deallocate_count));
+        allocation_statistics::store(this->live, allocation_statistics::load(rhs.live));
+        allocation_statistics::store(this->peak, allocation_statistics::load(rhs.peak));
+        for(auto i {0uz}; i < histogram_size; ++i) {
+            allocation_statistics::store(this->request_histogram[i], allocation_statistics::load(rhs.request_histogram[i]));
+        }
+        return *this;
+    }
+public:
+    [[nodiscard]]
+    static constexpr size_t histogram_bucket(size_t bytes) noexcept {
+        auto bucket {0uz};
+        while(bytes >>= 1) {
+            ++bucket;
+        }
+        return bucket;
+    }
+    [[nodiscard]]
+    size_t allocate_calls() const noexcept {
+        return allocation_statistics::load(this->allocate_count);
+    }
+    [[nodiscard]]
+    size_t reallocate_calls() const noexcept {
+        return allocation_statistics::load(this->reallocate_count);
+    }
+    [[nodiscard]]
+    size_t deallocate_calls() const noexcept {
+        return allocation_statistics::load(this->deallocate_count);
+    }
+    [[nodiscard]]
+    size_t live_bytes() const noexcept {
+        return allocation_statistics::load(this->live);
+    }
+    [[nodiscard]]
+    size_t peak_bytes() const noexcept {
+        return allocation_statistics::load(this->peak);
+    }
+    [[nodiscard]]
+    size_t histogram(size_t bucket) const noexcept {
+        return bucket < histogram_size ? allocation_statistics::load(this->request_histogram[bucket]) : 0;
+    }
+    void reset() noexcept {
+        *this = allocation_statistics {};
+    }
+    void record_allocation(size_t bytes) noexcept {
+        allocation_statistics::add(this->allocate_count, 1);
+        allocation_statistics::add(this->request_histogram[allocation_statistics::histogram_bucket(bytes)], 1);
+        this->raise_peak(allocation_statistics::add(this->live, bytes));
+    }
+    void record_reallocation(size_t old_bytes, size_t new_bytes) noexcept {
+        allocation_statistics::add(this->reallocate_count, 1);
+        allocation_statistics::add(this->request_histogram[allocation_statistics::histogram_bucket(new_bytes)], 1);
+        // the unsigned addition wraps, so a shrinking block subtracts from the live bytes
+        this->raise_peak(allocation_statistics::add(this->live, new_bytes - old_bytes));
+    }
+    void record_deallocation(size_t bytes) noexcept {
+        allocation_statistics::add(this->deallocate_count, 1);
+        __atomic_sub_fetch(ds::address_of(this->live), bytes, __ATOMIC_RELAXED);
+    }
+};
+__DATA_STRUCTURE_END(allocation statistics)
+
+__DATA_STRUCTURE_START(instrumented allocator)
+namespace __data_structure_auxiliary {
+inline allocation_statistics instrumented_allocator_statistics {};
+}
+
+/*
+ * The instrumented allocator records every allocation, reallocation and deallocation in an
+ * allocation_statistics shared by all instantiations (so the nodes of list or the map of deque,
+ * which are allocated by the rebound allocator, are recorded together with the elements). Each
+ * block is prefixed by a header recording its size, so that deallocate(void *) is able to maintain
+ * the live bytes. The slack reported by usable_size is claimed through try_expand, so that it's
+ * recorded as well.
+ */
+template <typename T>
+class instrumented_allocator {
+public:
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using value_type = T;
+private:
+    constexpr static size_t header_size {__STDCPP_DEFAULT_NEW_ALIGNMENT__};
+    static_assert(alignof(T) <= header_size, "The over-aligned type is not supported by instrumented_allocator!");
+private:
+    [[nodiscard]]
+    static constexpr unsigned char *header_of(void *p) noexcept {
+        return static_cast<unsigned char *>(p) - header_size;
+    }
+    [[nodiscard]]
+    static constexpr size_t block_size(const unsigned char *header) noexcept {
+        size_t size;
+        ds::memory_copy(ds::address_of(size), header, sizeof(size_t));
+        return size;
+    }
+    [[nodiscard]]
+    static constexpr T *mark_block(unsigned char *header, size_t size) noexcept {
+        ds::memory_copy(header, ds::address_of(size), sizeof(size_t));
+        return reinterpret_cast<T *>(header + header_size);
+    }
+public:
+    constexpr instrumented_allocator() noexcept = default;
+    constexpr instrumented_allocator(const instrumented_allocator &) noexcept = default;
+    constexpr instrumented_allocator(instrumented_allocator &&) noexcept = default;
+    constexpr ~instrumented_allocator() noexcept = default;
+public:
+    constexpr instrumented_allocator &operator=(const instrumented_allocator &) noexcept = default;
+    constexpr instrumented_allocator &operator=(instrumented_allocator &&) noexcept = default;
+public:
+    [[nodiscard]]
+    static constexpr allocation_statistics &statistics() noexcept {
+        return __dsa::instrumented_allocator_statistics;
+    }
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    static constexpr T *allocate(size_t n) noexcept(NoThrow) {
+        if(n == 0) {
+            return nullptr;
+        }
+        const auto size {n * sizeof(T)};
+        auto memory {static_cast<unsigned char *>(ds::memory_allocation(header_size + size))};
+        if(not memory) {
+            if constexpr(NoThrow) {
+                return nullptr;
+            }else {
+                throw std::bad_alloc {};
+            }
+        }
+        instrumented_allocator::statistics().record_allocation(size);
+        return instrumented_allocator::mark_block(memory, size);
+    }
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    static constexpr T *reallocate(void *source, size_t n) noexcept(NoThrow) requires is_trivially_relocatable_v<T> {
+        if(not source) {
+            return instrumented_allocator::allocate<NoThrow>(n);
+        }
+        if(n == 0) {
+            instrumented_allocator::deallocate(source);
+            return nullptr;
+        }
+        auto header {instrumented_allocator::header_of(source)};
+        const auto old_size {instrumented_allocator::block_size(header)};
+        const auto size {n * sizeof(T)};
+        auto memory {static_cast<unsigned char *>(ds::memory_reallocation(header, header_size + size))};
+        if(not memory) {
+            if constexpr(NoThrow) {
+                return nullptr;
+            }else {
+                throw std::bad_alloc {};
+            }
+        }
+        instrumented_allocator::statistics().record_reallocation(old_size, size);
+        return instrumented_allocator::mark_block(memory, size);
+    }
+    [[nodiscard]]
+    static constexpr bool try_expand(void *p, size_t n) noexcept {
+        if(not p) {
+            return false;
+        }
+        auto header {instrumented_allocator::header_of(p)};
+        const auto size {n * sizeof(T)};
+        if(not ds::memory_expansion(header, header_size + size)) {
+            return false;
+        }
+        instrumented_allocator::statistics().record_reallocation(instrumented_allocator::block_size(header), size);
+        static_cast<void>(instrumented_allocator::mark_block(header, size));
+        return true;
+    }
+    [[nodiscard]]
+    static constexpr size_t usable_size(void *p, size_t n) noexcept {
+        if(not p) {
+            return n;
+        }
+        const auto usable {ds::memory_usable_size(instrumented_allocator::header_of(p))};
+        const auto capacity {usable > header_size ? (usable - header_size) / sizeof(T) : 0};
+        return capacity > n and instrumented_allocator::try_expand(p, capacity) ? capacity : n;
+    }
+    static constexpr void deallocate(void *p) noexcept {
+        if(p) {
+            auto header {instrumented_allocator::header_of(p)};
+            instrumented_allocator::statistics().record_deallocation(instrumented_allocator::block_size(header));
+            ds::memory_free(header);
+        }
+    }
+    static constexpr void deallocate(void *p, size_t) noexcept {
+        instrumented_allocator::deallocate(p);
+    }
+};
+template <typename T, typename U>
+[[nodiscard]]
+inline consteval bool operator==(const instrumented_allocator<T> &, const instrumented_allocator<U> &) noexcept {
+    return true;
+}
+template <typename T, typename U>
+[[nodiscard]]
+inline consteval bool operator!=(const instrumented_allocator<T> &, const instrumented_allocator<U> &) noexcept {
+    return false;
+}
+__DATA_STRUCTURE_END(instrumented allocator)
+
+__DATA_STRUCTURE_START(monotonic arena)
+/*
+ * The monotonic arena hands out memory by bumping a cursor inside large chunks, the chunk size
+ * grows geometrically. Deallocation is a no-op, the memory is released when the arena is
+ * destroyed, released or rewound to a checkpoint. The size of each block is recorded in front
+ * of it, so the last block can be extended in place and the others can be reallocated by copying.
+ * An optional external buffer could be used as the first chunk, and it won't be freed.
+ */
+class monotonic_arena {
+private:
+    struct chunk {
+        chunk *previous;
+        size_t size;
+        bool owned;
+    };
+public:
+    struct checkpoint {
+        chunk *current;
+        unsigned char *cursor;
+    };
+private:
+    chunk *initial {};
+    chunk *current {};
+    unsigned char *cursor {};
+    unsigned char *end {};
+    unsigned char *last {};
+    size_t next_chunk_size;
+private:
+    [[nodiscard]]
+    static unsigned char *chunk_begin(chunk *c) noexcept {
+        return reinterpret_cast<unsigned char *>(c + 1);
+    }
+    [[nodiscard]]
+    static unsigned char *align_block(unsigned char *p, size_t alignment) noexcept {
+        const auto address {reinterpret_cast<size_t>(p + sizeof(size_t))};
+        return reinterpret_cast<unsigned char *>((address + alignment - 1) & ~(alignment - 1));
+    }
+    [[nodiscard]]
+    static size_t block_size(const unsigned char *block) noexcept {
+        size_t size;
+        ds::memory_copy(ds::address_of(size), block - sizeof(size_t), sizeof(size_t));
+        return size;
+    }
+    static void record_block_size(unsigned char *block, size_t size) noexcept {
+        ds::memory_copy(block - sizeof(size_t), ds::address_of(size), sizeof(size_t));
+    }
+    template <bool NoThrow>
+    bool add_chunk(size_t least) noexcept(NoThrow) {
+        const auto size {this->next_chunk_size < least ? least : this->next_chunk_size};
+        auto memory {ds::memory_allocation(sizeof(chunk) + size)};
+        if(not memory) {
+            if constexpr(NoThrow) {
+                return false;
+            }else {
+                throw std::bad_alloc {};
+            }
+        }
+        this->current = ds::construct<false>(static_cast<chunk *>(memory), this->current, size, true);
+        this->cursor = monotonic_arena::chunk_begin(this->current);
+        this->end = this->cursor + size;
+        this->next_chunk_size = size * 2;
+        return true;
+    }
+public:
+    explicit monotonic_arena(size_t initial_chunk_size = 4096) noexcept :
+            next_chunk_size {initial_chunk_size == 0 ? 1 : initial_chunk_size} {}
+    monotonic_arena(void *buffer, size_t size, size_t next_chunk_size = 4096) noexcept :
+            next_chunk_size {next_chunk_size == 0 ? 1 : next_chunk_size} {
+        const auto address {reinterpret_cast<size_t>(buffer)};
+        const auto offset {((address + alignof(chunk) - 1) & ~(alignof(chunk) - 1)) - address};
+        if(buffer and size > offset + sizeof(chunk)) {
+            this->initial = this->current = ds::construct<false>(
+                    reinterpret_cast<chunk *>(static_cast<unsigned char *>(buffer) + offset), nullptr,
+                    size - offset - sizeof(chunk), false);
+            this->cursor = monotonic_arena::chunk_begin(this->current);
+            this->end = this->cursor + this->current->size;
+        }
+    }
+    monotonic_arena(const monotonic_arena &) = delete;
+    monotonic_arena(monotonic_arena &&rhs) noexcept : initial {rhs.initial}, current {rhs.current},
+            cursor {rhs.cursor}, end {rhs.end}, last {rhs.last}, next_chunk_size {rhs.next_chunk_size} {
+        rhs.initial = rhs.current = nullptr;
+        rhs.cursor = rhs.end = rhs.last = nullptr;
+    }
+    ~monotonic_arena() noexcept {
+        this->release();
+    }
+public:
+    monotonic_arena &operator=(const monotonic_arena &) = delete;
+    monotonic_arena &operator=(monotonic_arena &&rhs) noexcept {
+        if(this not_eq &rhs) {
+            this->release();
+            this->initial = rhs.initial;
+            this->current = rhs.current;
+            this->cursor = rhs.cursor;
+            this->end = rhs.end;
+            this->last = rhs.last;
+            this->next_chunk_size = rhs.next_chunk_size;
+            rhs.initial = rhs.current = nullptr;
+            rhs.cursor = rhs.end = rhs.last = nullptr;
+        }
+        return *this;
+    }
+public:
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    void *allocate(size_t size, size_t alignment) noexcept(NoThrow) {
+        if(size == 0) {
+            return nullptr;
+        }
+        unsigned char *block {};
+        if(this->cursor) {
+            block = monotonic_arena::align_block(this->cursor, alignment);
+        }
+        if(not block or block + size > this->end) {
+            if(not this->add_chunk<NoThrow>(size + sizeof(size_t) + alignment)) {
+                return nullptr;
+            }
+            block = monotonic_arena::align_block(this->cursor, alignment);
+        }
+        monotonic_arena::record_block_size(block, size);
+        this->cursor = block + size;
+        this->last = block;
+        return block;
+    }
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    void *reallocate(void *source, size_t size, size_t alignment) noexcept(NoThrow) {
+        if(not source) {
+            return this->allocate<NoThrow>(size, alignment);
+        }
+        if(size == 0) {
+            return nullptr;
+        }
+        if(this->try_expand(source, size)) {
+            return source;
+        }
+        const auto block {static_cast<unsigned char *>(source)};
+        const auto old_size {monotonic_arena::block_size(block)};
+        auto memory {this->allocate<NoThrow>(size, alignment)};
+        if(memory) {
+            ds::memory_copy(memory, block, old_size < size ? old_size : size);
+        }
+        return memory;
+    }
+    [[nodiscard]]
+    bool try_expand(void *p, size_t size) noexcept {
+        const auto block {static_cast<unsigned char *>(p)};
+        if(block and block == this->last and block + size <= this->end) {
+            monotonic_arena::record_block_size(block, size);
+            this->cursor = block + size;
+            return true;
+        }
+        return false;
+    }
+    void deallocate(void *) noexcept {}
+    [[nodiscard]]
+    checkpoint mark() const noexcept {
+        return {this->current, this->cursor};
+    }
+    void rewind(checkpoint point) noexcept {
+        while(this->current not_eq point.current) {
+            auto backup {this->current};
+            this->current = this->current->previous;
+            if(backup->owned) {
+                ds::memory_free(backup);
+            }
+        }
+        if(this->current) {
+            this->cursor = point.cursor;
+            this->end = monotonic_arena::chunk_begin(this->current) + this->current->size;
+        }else {
+            this->cursor = this->end = nullptr;
+        }
+        this->last = nullptr;
+    }
+    void release() noexcept {
+        this->rewind({this->initial, this->initial ? monotonic_arena::chunk_begin(this->initial) : nullptr});
+    }
+};
+
+/*
+ * The allocator handing out the memory of a monotonic arena, the arena should outlive the allocator and everything
+ * allocated by it. There is no default constructor, so the containers using it are constructed with an allocator
+ * bound to an arena, e.g. vector<int, arena_allocator<int>> v {arena_allocator<int> {arena}}, the internal allocators
+ * of the containers are rebound from it and share the arena.
+ */
+template <typename T>
+class arena_allocator {
+    template <typename> friend class arena_allocator;
+public:
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using value_type = T;
+private:
+    monotonic_arena *arena;
+public:
+    constexpr arena_allocator(monotonic_arena &arena) noexcept : arena {ds::address_of(arena)} {}
+    template <typename U>
+    constexpr arena_allocator(const arena_allocator<U> &rhs) noexcept : arena {rhs.arena} {}
+    constexpr arena_allocator(const arena_allocator &) noexcept = default;
+    constexpr arena_allocator(arena_allocator &&) noexcept = default;
+    constexpr ~arena_allocator() noexcept = default;
+public:
+    constexpr arena_allocator &operator=(const arena_allocator &) noexcept = default;
+    constexpr arena_allocator &operator=(arena_allocator &&) noexcept = default;
+public:
+    [[nodiscard]]
+    constexpr monotonic_arena &resource() const noexcept {
+        return *this->arena;
+    }
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    constexpr T *allocate(size_t n) const noexcept(NoThrow) {
+        return static_cast<T *>(this->arena->template allocate<NoThrow>(n * sizeof(T), alignof(T)));
+    }
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    constexpr T *reallocate(void *source, size_t n) const noexcept(NoThrow) requires is_trivially_relocatable_v<T> {
+        return static_cast<T *>(this->arena->template reallocate<NoThrow>(source, n * sizeof(T), alignof(T)));
+    }
+    [[nodiscard]]
+    constexpr bool try_expand(void *p, size_t n) const noexcept {
+        return this->arena->try_expand(p, n * sizeof(T));
+    }
+    constexpr void deallocate(void *) const noexcept {}
+    constexpr void deallocate(void *, size_t) const noexcept {}
+};
+template <typename T, typename U>
+[[nodiscard]]
+inline constexpr bool operator==(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs) noexcept {
+    return ds::address_of(lhs.resource()) == ds::address_of(rhs.resource());
+}
+template <typename T, typename U>
+[[nodiscard]]
+inline constexpr bool operator!=(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs) noexcept {
+    return not(lhs == rhs);
+}
+__DATA_STRUCTURE_END(monotonic arena)
+
 __DATA_STRUCTURE_START(allocator traits)
 template <typename Allocator>
 struct allocator_traits {
@@ -126,6 +623,107 @@ struct allocator_traits {
 };
 __DATA_STRUCTURE_END(allocator traits)
 
+__DATA_STRUCTURE_START(chunk growth policy for node allocator)
+/*
+ * The chunk growth policy decides how many nodes are allocated at once when a node allocator runs out of free nodes.
+ * It should provide static member function `next_chunk_size(size_t last, size_t n) noexcept`, where last is the size
+ * of the previous chunk (zero for the first chunk) and n is the number of nodes still needed, the result should not
+ * be less than n. The surplus nodes are kept in the free list.
+ */
+template <size_t Size = 64>
+struct fixed_chunk_policy {
+    static_assert(Size > 0, "The chunk size should be positive!");
+    static constexpr size_t next_chunk_size(size_t, size_t n) noexcept {
+        return n < Size ? Size : n;
+    }
+};
+template <size_t Initial = 16, size_t Factor = 2>
+struct geometric_chunk_policy {
+    static_assert(Initial > 0 and Factor > 0, "The initial chunk size and the factor should be positive!");
+    static constexpr size_t next_chunk_size(size_t last, size_t n) noexcept {
+        const auto size {last == 0 ? Initial : last * Factor};
+        return n < size ? size : n;
+    }
+};
+template <size_t Initial = 16, size_t Cap = 4096, size_t Factor = 2>
+struct capped_chunk_policy {
+    static_assert(Initial > 0 and Initial <= Cap and Factor > 0,
+            "The initial chunk size should be positive and not be greater than the cap!");
+    static constexpr size_t next_chunk_size(size_t last, size_t n) noexcept {
+        auto size {geometric_chunk_policy<Initial, Factor>::next_chunk_size(last, 0)};
+        if(size > Cap) {
+            size = Cap;
+        }
+        return n < size ? size : n;
+    }
+};
+__DATA_STRUCTURE_END(chunk growth policy for node allocator)
+
+__DATA_STRUCTURE_START(growth policy for contiguous container)
+/*
+ * The growth policy decides the new capacity when a contiguous container like vector or buffer runs out of space.
+ * It should provide static member function template `next_capacity<T>(size_t capacity, size_t n) noexcept`, where
+ * capacity is the current capacity (zero for an empty container) and n is the number of elements which should be
+ * held, the result should not be less than n.
+ */
+template <size_t Numerator, size_t Denominator = 1, size_t Initial = 1>
+struct factor_growth_policy {
+    static_assert(Numerator > Denominator and Denominator > 0 and Initial > 0,
+            "The growth factor should be greater than 1 and the initial capacity should be positive!");
+    template <typename T>
+    static constexpr size_t next_capacity(size_t capacity, size_t n) noexcept {
+        const auto grown {capacity == 0 ? Initial :
+                capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator};
+        return n < grown ? grown : n;
+    }
+};
+using doubling_growth_policy = factor_growth_policy<2>;
+using one_and_a_half_growth_policy = factor_growth_policy<3, 2>;
+/*
+ * Rounds the capacity given by Policy up to the usable size of the chunk which malloc really hands out. The size is
+ * estimated by the layout of glibc here, that is, the chunks are 16-byte aligned with an 8-byte header, and the large
+ * chunks are mapped by pages. Since the policy is tagged by round_to_usable_size, the containers replace the estimate
+ * by the usable size the allocator reports after the allocation, if the allocator supports usable_size.
+ */
+template <typename Policy = one_and_a_half_growth_policy>
+struct size_class_growth_policy {
+    constexpr static auto round_to_usable_size {true};
+    template <typename T>
+    static constexpr size_t next_capacity(size_t capacity, size_t n) noexcept {
+        constexpr auto header_size {sizeof(void *)};
+        constexpr auto alignment {16uz};
+        constexpr auto page_size {4096uz};
+        constexpr auto mapping_threshold {128uz * 1024};
+        const auto bytes {Policy::template next_capacity<T>(capacity, n) * sizeof(T)};
+        const auto usable_size {bytes < mapping_threshold ?
+                ((bytes + header_size + (alignment - 1)) & ~(alignment - 1)) - header_size :
+                ((bytes + 2 * header_size + (page_size - 1)) & ~(page_size - 1)) - 2 * header_size};
+        return usable_size / sizeof(T);
+    }
+};
+/*
+ * Grows by Policy until the memory reaches Threshold bytes, then grows by Step bytes each time, which bounds the
+ * unused memory of huge containers.
+ */
+template <size_t Threshold = 64uz * 1024 * 1024, size_t Step = Threshold, typename Policy = doubling_growth_policy>
+struct capped_linear_growth_policy {
+    static_assert(Threshold > 0 and Step > 0, "The threshold and the step should be positive!");
+    template <typename T>
+    static constexpr size_t next_capacity(size_t capacity, size_t n) noexcept {
+        constexpr auto threshold {Threshold / sizeof(T) == 0 ? 1 : Threshold / sizeof(T)};
+        constexpr auto step {Step / sizeof(T) == 0 ? 1 : Step / sizeof(T)};
+        auto grown {capacity + step};
+        if(capacity < threshold) {
+            grown = Policy::template next_capacity<T>(capacity, 0);
+            if(grown > threshold) {
+                grown = threshold;
+            }
+        }
+        return n < grown ? grown : n;
+    }
+};
+__DATA_STRUCTURE_END(growth policy for contiguous container)
+
 __DATA_STRUCTURE_START(inner tools for data structure library)
 namespace __data_structure_auxiliary {
 
@@ -136,34 +734,81 @@ concept IsLinkedAfterAllocation = requires {
 };
 __DATA_STRUCTURE_END(concept for node allocator, tag in class named linked_after_allocation)
 
+__DATA_STRUCTURE_START(in-place expansion for the allocator which may not support it)
+template <typename Allocator>
+concept IsExpandableAllocator = requires(Allocator &allocator, void *p, size_t n) {
+    {allocator.try_expand(p, n)} noexcept;
+};
+template <typename Allocator>
+[[nodiscard]]
+inline constexpr bool try_expand(Allocator &allocator, void *p, size_t n) noexcept {
+    if constexpr(IsExpandableAllocator<Allocator>) {
+        return allocator.try_expand(p, n);
+    }else {
+        return false;
+    }
+}
+__DATA_STRUCTURE_END(in-place expansion for the allocator which may not support it)
+
+__DATA_STRUCTURE_START(usable size for the allocator which may not report it, tag in class named round_to_usable_size)
+template <typename Allocator>
+concept IsUsableSizeAllocator = requires(Allocator &allocator, void *p, size_t n) {
+    {allocator.usable_size(p, n)} noexcept;
+};
+template <typename GrowthPolicy>
+concept IsRoundingToUsableSize = requires {
+    requires GrowthPolicy::round_to_usable_size == true;
+};
+template <typename Allocator>
+[[nodiscard]]
+inline constexpr size_t usable_size(Allocator &allocator, void *p, size_t n) noexcept {
+    if constexpr(IsUsableSizeAllocator<Allocator>) {
+        return allocator.usable_size(p, n);
+    }else {
+        return n;
+    }
+}
+__DATA_STRUCTURE_END(usable size for the allocator which may not report it, tag in class named round_to_usable_size)
+
+__DATA_STRUCTURE_START(construction of the rebound allocator)
+/*
+ * The allocators bound to a resource (such as arena_allocator) are not default constructible, so the rebound
+ * allocators of the containers (the map of deque, the nodes of list) are converted from the original allocator if
+ * it's possible, otherwise they are default constructed
+ */
+template <typename Rebound, typename Allocator>
+[[nodiscard]]
+inline constexpr Rebound rebind_allocator(const Allocator &allocator)
+        noexcept(is_constructible_v<Rebound, const Allocator &> ?
+                is_nothrow_constructible_v<Rebound, const Allocator &> : is_nothrow_default_constructible_v<Rebound>) {
+    if constexpr(is_constructible_v<Rebound, const Allocator &>) {
+        return Rebound(allocator);
+    }else {
+        return Rebound {};
+    }
+}
+__DATA_STRUCTURE_END(construction of the rebound allocator)
+
 __DATA_STRUCTURE_START(forward list node allocator)
 template <typename T, template <typename> typename NodeTemplate, typename Allocator = allocator<T>,
-        typename NodeAllocator = typename allocator_traits<Allocator>::template rebind<NodeTemplate<T>>>
+        typename NodeAllocator = typename allocator_traits<Allocator>::template rebind<NodeTemplate<T>>,
+        typename ChunkPolicy = capped_chunk_policy<>>
 class forward_list_node_allocator : public Allocator, public NodeAllocator {
-    friend constexpr bool operator==(const forward_list_node_allocator &, const forward_list_node_allocator &) noexcept;
+    friend constexpr bool operator==(const forward_list_node_allocator &lhs,
+            const forward_list_node_allocator &rhs) noexcept {
+        return lhs.shared_list == rhs.shared_list;
+    }
 private:
-    struct free_list_exception_handler {
+    struct construction_handler {
+        forward_list_node_allocator &allocator;
         NodeTemplate<T> *begin;
         NodeTemplate<T> *end;
-        constexpr void operator()() noexcept {
-            while(this->begin not_eq this->end) {
-                ds::destroy(ds::address_of(this->begin->value));
-                this->begin = this->begin->next->node();
-            }
-        }
-    };
-    struct allocation_exception_handler {
-        NodeTemplate<T> *nodes;
         size_t n;
-        size_t i;
-        NodeAllocator &allocator;
-        constexpr allocation_exception_handler(NodeTemplate<T> *nodes, size_t n, NodeAllocator &allocator)
-                noexcept : nodes {nodes}, n {n}, i {0}, allocator(allocator) {}
         constexpr void operator()() noexcept {
-            for(auto j {0}; j < this->i; ++j) {
-                ds::destroy(ds::address_of(this->nodes[j].value));
+            for(auto it {this->begin}; it not_eq this->end; it = next_node(it)) {
+                ds::destroy(ds::address_of(it->value));
             }
-            this->allocator.deallocate(this->nodes, this->n);
+            this->allocator.deallocate(this->begin, this->n);
         }
     };
 public:
@@ -179,17 +824,99 @@ private:
             size_t node_size;
         };
         size_t strong_count;
+        size_t chunk_size;
         struct recorder_list {
             struct {
                 NodeTemplate<T> *record;
                 size_t size;
             };
             recorder_list *next;
-        } *recorder;
+        } *recorder;        // sorted by the address of chunks
     } *shared_list;
 public:
     constexpr static auto linked_after_allocation {true};
 private:
+    static constexpr NodeTemplate<T> *next_node(NodeTemplate<T> *node) noexcept {
+        return static_cast<NodeTemplate<T> *>(node->next);
+    }
+    static constexpr NodeTemplate<T> *sort_by_address(NodeTemplate<T> *list, size_t n) noexcept {
+        if(n <= 1) {
+            if(list) {
+                list->next = nullptr;
+            }
+            return list;
+        }
+        auto middle {list};
+        for(auto i {1uz}; i < n / 2; ++i) {
+            middle = next_node(middle);
+        }
+        auto rhs {next_node(middle)};
+        middle->next = nullptr;
+        auto lhs {sort_by_address(list, n / 2)};
+        rhs = sort_by_address(rhs, n - n / 2);
+        NodeTemplate<T> *first {};
+        NodeTemplate<T> *last {};
+        while(lhs or rhs) {
+            NodeTemplate<T> *node;
+            if(not rhs or (lhs and std::less<> {}(lhs, rhs))) {
+                node = lhs;
+                lhs = next_node(lhs);
+            }else {
+                node = rhs;
+                rhs = next_node(rhs);
+            }
+            if(last) {
+                last->next = node;
+            }else {
+                first = node;
+            }
+            last = node;
+        }
+        last->next = nullptr;
+        return first;
+    }
+    template <bool NoThrow>
+    constexpr NodeTemplate<T> *allocate_chunk(size_t n) noexcept(NoThrow) {
+        // the first n nodes of the new chunk are returned, the others become the free list
+        const auto size {ChunkPolicy::next_chunk_size(this->shared_list->chunk_size, n)};
+        const auto nodes {this->NodeAllocator::template allocate<NoThrow>(size)};
+        if constexpr(NoThrow) {
+            if(not nodes) {
+                return nullptr;
+            }
+        }
+        typename shared_block::recorder_list *new_record;
+        if constexpr(NoThrow) {
+            new_record = ::new (ds::nothrow) shared_block::recorder_list {{nodes, size}, nullptr};
+            if(not new_record) {
+                this->NodeAllocator::deallocate(nodes, size);
+                return nullptr;
+            }
+        }else {
+            try {
+                new_record = ::new shared_block::recorder_list {{nodes, size}, nullptr};
+            }catch(...) {
+                this->NodeAllocator::deallocate(nodes, size);
+                throw;
+            }
+        }
+        auto link {&this->shared_list->recorder};
+        while(*link and std::less<> {}((*link)->record, nodes)) {
+            link = &(*link)->next;
+        }
+        new_record->next = *link;
+        *link = new_record;
+        const auto last_position {size - 1};
+        for(auto i {0uz}; i < last_position; ++i) {
+            nodes[i].next = nodes + (i + 1);
+        }
+        nodes[last_position].next = nullptr;
+        nodes[n - 1].next = nullptr;
+        this->shared_list->free_list = n < size ? nodes + n : nullptr;
+        this->shared_list->node_size = size - n;
+        this->shared_list->chunk_size = size;
+        return nodes;
+    }
     constexpr void release_this() noexcept {
         if(this->shared_list and --this->shared_list->strong_count == 0) {
             for(auto it {this->shared_list->recorder}; it;) {
@@ -203,9 +930,10 @@ private:
     }
 public:
     constexpr forward_list_node_allocator() : Allocator(), NodeAllocator(),
-            shared_list {::new shared_block {.strong_count {1}}} {}
-    explicit constexpr forward_list_node_allocator(const Allocator &allocator) : Allocator(allocator), NodeAllocator(),
-            shared_list {::new shared_block {.strong_count {1}}} {}
+            shared_list {::new shared_block {{}, 1, 0, nullptr}} {}
+    explicit constexpr forward_list_node_allocator(const Allocator &allocator) : Allocator(allocator),
+            NodeAllocator(rebind_allocator<NodeAllocator>(allocator)),
+            shared_list {::new shared_block {{}, 1, 0, nullptr}} {}
     constexpr forward_list_node_allocator(const forward_list_node_allocator &rhs) noexcept : Allocator(rhs),
             NodeAllocator(rhs), shared_list {rhs.shared_list} {
         ++this->shared_list->strong_count;
@@ -248,50 +976,28 @@ public:
         auto result {this->shared_list->free_list};
         if(n <= this->shared_list->node_size) {
             auto cursor {result};
-            while(n not_eq 1) {
-                cursor = cursor->next->node();
-                --n;
+            for(auto i {1uz}; i < n; ++i) {
+                cursor = next_node(cursor);
             }
             this->shared_list->node_size -= n;
-            this->shared_list->free_list = cursor->next->node();
+            this->shared_list->free_list = next_node(cursor);
             cursor->next = link_to;
             return result;
         }
-        const auto nodes {this->NodeAllocator::template allocate<NoThrow>(n -= this->shared_list->node_size)};
+        const auto rest {n - this->shared_list->node_size};
+        const auto nodes {this->allocate_chunk<NoThrow>(rest)};
         if constexpr(NoThrow) {
             if(not nodes) {
                 return nullptr;
             }
-            auto new_record {::new (ds::nothrow) shared_block::recorder_list {{nodes, n}, this->shared_list->recorder}};
-            if(new_record) {
-                this->shared_list->recorder = new_record;
-            }else {
-                this->NodeAllocator::deallocate(nodes, n);
-                return nullptr;
-            }
-        }else {
-            try {
-                auto new_record {::new shared_block::recorder_list {{nodes, n}, this->shared_list->recorder}};
-                this->shared_list->recorder = new_record;
-            }catch(...) {
-                this->NodeAllocator::deallocate(nodes, n);
-                throw;
-            }
-        }
-        const auto last_position {n - 1};
-        for(auto i {0uz}; i < last_position; ++i) {
-            nodes[i].next = nodes + (i + 1);
         }
-        nodes[last_position].next = link_to;
+        nodes[rest - 1].next = link_to;
         if(auto cursor {result}; cursor) {
-            for(; cursor->next; cursor = cursor->next->node());
+            for(; cursor->next; cursor = next_node(cursor));
             cursor->next = nodes;
-        }else {
-            result = nodes;
+            return result;
         }
-        this->shared_list->free_list = nullptr;
-        this->shared_list->node_size = 0;
-        return result;
+        return nodes;
     }
     template <typename ...Args>
     [[nodiscard]]
@@ -299,48 +1005,15 @@ public:
         if(n == 0) {
             return nullptr;
         }
-        auto result {this->shared_list->free_list};
-        if(n <= this->shared_list->node_size) {
-            auto trans {transaction {free_list_exception_handler {result, result}}};
-            auto &cursor {trans.get_rollback().end};
-            while(n not_eq 1) {
-                ds::construct(ds::address_of(cursor->value), ds::forward<Args>(args)...);
-                cursor = cursor->next->node();
-                --n;
-            }
+        const auto result {this->allocate(n, link_to)};
+        auto trans {transaction {construction_handler {*this, result, result, n}}};
+        auto &cursor {trans.get_rollback().end};
+        for(; n not_eq 1; --n, static_cast<void>(cursor = next_node(cursor))) {
             ds::construct(ds::address_of(cursor->value), ds::forward<Args>(args)...);
-            trans.complete();
-            this->shared_list->node_size -= n;
-            this->shared_list->free_list = cursor->next->node();
-            cursor->next = link_to;
-            return result;
         }
-        if(result) {
-            auto trans {transaction {free_list_exception_handler {result, result}}};
-            auto &cursor {trans.get_rollback().end};
-            for(; cursor->next; cursor = cursor->next->node()) {
-                ds::construct(ds::address_of(cursor->value), ds::forward<Args>(args)...);
-            }
-            ds::construct(ds::address_of(cursor->value), ds::forward<Args>(args)...);
-            cursor->next = link_to;
-            trans.complete();
-        }
-        const auto nodes {this->NodeAllocator::template allocate<false>(n -= this->shared_list->node_size)};
-        const auto last_position {n - 1};
-        auto trans {transaction {allocation_exception_handler(nodes, n, *this)}};
-        auto &i {trans.get_rollback().i};
-        for(; i < last_position; ++i) {
-            nodes[i].next = nodes + (i + 1);
-            ds::construct(ds::address_of(nodes[i].value), ds::forward<Args>(args)...);
-        }
-        ds::construct(ds::address_of(nodes[i].value), ds::forward<Args>(args)...);
-        ++i;
-        this->shared_list->recorder = ::new shared_block::recorder_list {{nodes, n}, this->shared_list->recorder};
+        ds::construct(ds::address_of(cursor->value), ds::forward<Args>(args)...);
         trans.complete();
-        nodes[last_position].next = link_to;
-        this->shared_list->free_list = nullptr;
-        this->shared_list->node_size = 0;
-        return nodes;
+        return result;
     }
     template <IsInputIterator InputIterator>
     [[nodiscard]]
@@ -348,50 +1021,15 @@ public:
         if(n == 0) {
             return nullptr;
         }
-        auto result {this->shared_list->free_list};
-        if(n <= this->shared_list->node_size) {
-            auto trans {transaction {free_list_exception_handler {result, result}}};
-            auto &cursor {trans.get_rollback().end};
-            while(n not_eq 1) {
-                ds::construct(ds::address_of(cursor->value),
-                        ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
-                cursor = cursor->next->node();
-                --n;
-            }
+        const auto result {this->allocate(n, link_to)};
+        auto trans {transaction {construction_handler {*this, result, result, n}}};
+        auto &cursor {trans.get_rollback().end};
+        for(; n not_eq 1; --n, static_cast<void>(cursor = next_node(cursor))) {
             ds::construct(ds::address_of(cursor->value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
-            trans.complete();
-            this->shared_list->node_size -= n;
-            this->shared_list->free_list = cursor->next->node();
-            cursor->next = link_to;
-            return result;
-        }
-        const auto nodes {this->NodeAllocator::template allocate<false>(n -= this->shared_list->node_size)};
-        const auto last_position {n - 1};
-        auto trans {transaction {allocation_exception_handler(nodes, n, *this)}};
-        auto &i {trans.get_rollback().i};
-        for(; i < last_position; ++i) {
-            nodes[i].next = nodes + (i + 1);
-            ds::construct(ds::address_of(nodes[i].value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
-        }
-        ds::construct(ds::address_of(nodes[i].value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
-        ++i;
-        this->shared_list->recorder = ::new shared_block::recorder_list {{nodes, n}, this->shared_list->recorder};
-        if(result) {
-            auto trans {transaction {free_list_exception_handler {result, result}}};
-            auto &cursor {trans.get_rollback().end};
-            for(; cursor->next; cursor = cursor->next->node()) {
-                ds::construct(ds::address_of(cursor->value),
-                        ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
-            }
-            ds::construct(ds::address_of(cursor->value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
-            cursor->next = link_to;
-            trans.complete();
         }
+        ds::construct(ds::address_of(cursor->value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin));
         trans.complete();
-        nodes[last_position].next = link_to;
-        this->shared_list->free_list = nullptr;
-        this->shared_list->node_size = 0;
-        return nodes;
+        return result;
     }
     template <bool = false>
     [[nodiscard]]
@@ -424,7 +1062,7 @@ public:
         if(node) {
             auto it {node};
             this->shared_list->node_size += n;
-            for(; n not_eq 1; it = it->next->node(), static_cast<void>(--n));
+            for(; n not_eq 1; it = next_node(it), static_cast<void>(--n));
             it->next = this->shared_list->free_list;
             this->shared_list->free_list = node;
         }
@@ -432,9 +1070,9 @@ public:
     constexpr void deallocate(NodeTemplate<T> *begin, NodeTemplate<T> *end) noexcept {
         if(begin) {
             auto n {1uz};
+            for(auto it {begin}; it not_eq end; it = next_node(it), static_cast<void>(++n));
             end->next = this->shared_list->free_list;
             this->shared_list->free_list = begin;
-            for(; begin not_eq end; begin = begin->next, static_cast<void>(++n));
             this->shared_list->node_size += n;
         }
     }
@@ -445,6 +1083,54 @@ public:
             this->shared_list->free_list = begin;
         }
     }
+    /*
+     * Returns the chunks whose nodes are all in the free list to the underlying allocator, and returns the number of
+     * released nodes. The free list is sorted by address meanwhile, so the following allocations walk the memory in
+     * order.
+     */
+    constexpr size_t trim() noexcept {
+        // the nodes of different chunks are compared, the built-in operators don't promise a total order for them
+        constexpr std::less<> before {};
+        auto &shared {*this->shared_list};
+        auto node {sort_by_address(shared.free_list, shared.node_size)};
+        NodeTemplate<T> *first {};
+        NodeTemplate<T> *last {};
+        auto released {0uz};
+        for(auto link {&shared.recorder}; node;) {
+            auto chunk {*link};
+            while(before(node, chunk->record) or not before(node, chunk->record + chunk->size)) {
+                link = &chunk->next;
+                chunk = *link;
+            }
+            const auto run_first {node};
+            auto run_last {node};
+            auto run_size {0uz};
+            const auto chunk_end {chunk->record + chunk->size};
+            for(; node and before(node, chunk_end); node = next_node(node), static_cast<void>(++run_size)) {
+                run_last = node;
+            }
+            if(run_size == chunk->size) {
+                *link = chunk->next;
+                this->NodeAllocator::deallocate(chunk->record, chunk->size);
+                ::delete chunk;
+                released += run_size;
+                continue;
+            }
+            if(last) {
+                last->next = run_first;
+            }else {
+                first = run_first;
+            }
+            last = run_last;
+            link = &chunk->next;
+        }
+        if(last) {
+            last->next = nullptr;
+        }
+        shared.free_list = first;
+        shared.node_size -= released;
+        return released;
+    }
 };
 __DATA_STRUCTURE_END(forward node node allocator)
 
@@ -19,6 +19,7 @@
 
 #include "utility.hpp"
 #include "iterator.hpp"
+#include "compare.hpp"
 
 namespace data_structure {
 
@@ -37,7 +38,7 @@ public:
     using const_pointer = const T *;
     using iterator = T *;
     using const_iterator = const T *;
-    using reverse_iterator = reverse_iterator<T *>;
+    using reverse_iterator = ds::reverse_iterator<T *>;
     using const_reverse_iterator = ds::reverse_iterator<const T *>;
 private:
     T elements[N];
@@ -169,10 +170,18 @@ template <typename T, size_t N>
 void swap(array<T, N> &lhs, array<T, N> &rhs) noexcept {
     lhs.swap(rhs);
 }
-// Todo : wait for header "compare.hpp"?
-/*template <typename T, size_t N>
-inline constexpr some_ordering operator<=>(array<T, N> &, array<T, N> &)
-        noexcept(is_nothrow_three_way_comparable_v<T>);*/
+template <typename T, size_t N>
+[[nodiscard]]
+inline constexpr bool operator==(const array<T, N> &lhs, const array<T, N> &rhs)
+        noexcept(is_nothrow_equal_to_comparable_v<const T &>) {
+    return ds::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+template <typename T, size_t N>
+[[nodiscard]]
+inline constexpr auto operator<=>(const array<T, N> &lhs, const array<T, N> &rhs)
+        noexcept(__dsa::is_nothrow_synth_three_way_comparable_v<T>) {
+    return ds::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
 __DATA_STRUCTURE_END(array with non-zero size)
 
 __DATA_STRUCTURE_START(array with zero size)
@@ -190,7 +199,7 @@ public:
     using const_pointer = const T *;
     using iterator = T *;
     using const_iterator = const T *;
-    using reverse_iterator = reverse_iterator<T *>;
+    using reverse_iterator = ds::reverse_iterator<T *>;
     using const_reverse_iterator = ds::reverse_iterator<const T *>;
 public:
     consteval void operator[](ptrdiff_t) const noexcept {
@@ -276,7 +285,13 @@ public:
 template <typename T>
 inline consteval void swap(array<T, 0> &, array<T, 0> &) noexcept {}
 template <typename T>
-inline consteval strong_ordering operator<=>(array<T, 0> &, array<T, 0> &) noexcept {
+[[nodiscard]]
+inline consteval bool operator==(const array<T, 0> &, const array<T, 0> &) noexcept {
+    return true;
+}
+template <typename T>
+[[nodiscard]]
+inline consteval strong_ordering operator<=>(const array<T, 0> &, const array<T, 0> &) noexcept {
     return strong_ordering::equal;
 }
 __DATA_STRUCTURE_END(array with zero size)
@@ -0,0 +1,37 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_ATOMIC_HPP
+#define DATA_STRUCTURE_ATOMIC_HPP
+
+#include <atomic>
+#include "__config.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(atomic operations)
+template <typename T>
+using atomic = std::atomic<T>;
+using memory_order = std::memory_order;
+inline constexpr auto memory_order_relaxed {std::memory_order_relaxed};
+inline constexpr auto memory_order_acquire {std::memory_order_acquire};
+inline constexpr auto memory_order_release {std::memory_order_release};
+inline constexpr auto memory_order_acq_rel {std::memory_order_acq_rel};
+__DATA_STRUCTURE_END(atomic operations)
+
+}       // namespace data_structure
+
+#endif      // DATA_STRUCTURE_ATOMIC_HPP
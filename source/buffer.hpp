@@ -24,7 +24,7 @@
 namespace data_structure {
 
 __DATA_STRUCTURE_START(buffer declaration)
-template <typename T, typename Allocator = allocator<T>>
+template <typename T, typename Allocator = allocator<T>, typename GrowthPolicy = doubling_growth_policy>
 class buffer {
 public:
     using allocator_type = Allocator;
@@ -48,7 +48,7 @@ private:
     __dsa::allocator_compressor<size_type, Allocator> buffer_size;
     pointer first;
 private:
-    template <bool = true>
+    template <bool = true, bool = false>
     constexpr void initialize(const T &);
     constexpr void move_to(pointer, size_type);
     template <typename InputIterator>
@@ -59,6 +59,7 @@ public:
     buffer() = delete;
     explicit constexpr buffer(size_type, const Allocator & = {});
     constexpr buffer(size_type, const T &, const Allocator & = {});
+    constexpr buffer(size_type, for_overwrite_tag, const Allocator & = {});
     template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
     constexpr buffer(InputIterator, InputIterator, const Allocator & = {}, size_type = 64);
     template <IsForwardIterator ForwardIterator>
@@ -92,8 +93,8 @@ __DATA_STRUCTURE_END(buffer declaration)
 
 __DATA_STRUCTURE_START(buffer implementation)
 /* private type */
-template <typename T, typename Allocator>
-struct buffer<T, Allocator>::exception_handler {
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct buffer<T, Allocator, GrowthPolicy>::exception_handler {
     buffer &b;
     size_type i {0};
     explicit constexpr exception_handler(buffer &b) noexcept : b {b} {}
@@ -104,17 +105,11 @@ struct buffer<T, Allocator>::exception_handler {
 };
 
 /* private functions */
-template <typename T, typename Allocator>
-constexpr void buffer<T, Allocator>::move_to(pointer new_buffer, size_type old_size) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void buffer<T, Allocator, GrowthPolicy>::move_to(pointer new_buffer, size_type old_size) {
     auto &allocator {this->buffer_size.allocator()};
-    if constexpr(is_trivially_copy_assignable_v<T>) {
-        if constexpr(is_pointer_v<pointer>) {
-            ds::memory_copy(new_buffer, this->first, sizeof(T) * old_size);
-        }else {
-            for(size_type i {0}; i < old_size; ++i) {
-                ds::construct(new_buffer + i, ds::move(this->first[i]));
-            }
-        }
+    if constexpr(is_pointer_v<pointer> and is_trivially_relocatable_v<T>) {
+        ds::memory_copy(new_buffer, this->first, sizeof(T) * old_size);
     }else {
         struct exception_handler {
             pointer old_buffer;
@@ -139,23 +134,27 @@ constexpr void buffer<T, Allocator>::move_to(pointer new_buffer, size_type old_s
             ds::construct(new_buffer + i, ds::move(this->first[i]));
         }
         trans.complete();
+        ds::destroy(this->first, this->first + old_size);
     }
-    ds::destroy(this->first, this->first + old_size);
     allocator.deallocate(this->first, old_size);
     this->first = new_buffer;
 }
-template <typename T, typename Allocator>
-template <bool CopyFromValue>
-constexpr void buffer<T, Allocator>::initialize(const T &value) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <bool CopyFromValue, bool ForOverwrite>
+constexpr void buffer<T, Allocator, GrowthPolicy>::initialize(const T &value) {
     const auto size {this->buffer_size()};
     this->first = this->buffer_size.allocator().allocate(size);
     auto trans {transaction {exception_handler(*this)}};
-    if constexpr(not CopyFromValue and is_trivially_default_constructible_v<T>) {
+    if constexpr(ForOverwrite and is_trivially_default_constructible_v<T>) {
+        // the elements will be overwritten, so the memory is left untouched
+    }else if constexpr(not CopyFromValue and is_trivially_default_constructible_v<T>) {
         ds::memory_default_initialization(this->first, sizeof(T) * size);
     }else {
         for(auto &i {trans.get_rollback().i}; i < size; ++i) {
             if constexpr(CopyFromValue) {
                 ds::construct(this->first + i, value);
+            }else if constexpr(ForOverwrite) {
+                ds::default_construct(this->first + i);
             }else {
                 ds::construct(this->first + i);
             }
@@ -163,9 +162,9 @@ constexpr void buffer<T, Allocator>::initialize(const T &value) {
     }
     trans.complete();
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InputIterator>
-constexpr void buffer<T, Allocator>::initialize(InputIterator begin, InputIterator end, false_type) {
+constexpr void buffer<T, Allocator, GrowthPolicy>::initialize(InputIterator begin, InputIterator end, false_type) {
     auto &size {this->buffer_size()};
     this->first = this->buffer_size.allocator().allocate(size);
     auto &allocator {this->buffer_size.allocator()};
@@ -173,17 +172,17 @@ constexpr void buffer<T, Allocator>::initialize(InputIterator begin, InputIterat
     auto &i {trans.get_rollback().i};
     for(; begin not_eq end; ++i) {
         if(i == size) {
-            size *= 2;
-            if constexpr(is_trivially_copyable_v<T>) {
+            size = GrowthPolicy::template next_capacity<T>(size, size + 1);
+            if constexpr(is_trivially_relocatable_v<T>) {
                 this->first = allocator.reallocate(this->first, size);
-            }else {
+            }else if(not __dsa::try_expand(allocator, this->first, size)) {
                 this->move_to(allocator.allocate(size), i);
             }
         }
         ds::construct(this->first + i, ds::move(*begin++));
     }
     if(i not_eq size) {
-        if constexpr(is_trivially_copyable_v<T>) {
+        if constexpr(is_trivially_relocatable_v<T>) {
             this->first = allocator.reallocate(this->first, i);
         }else {
             this->move_to(allocator.allocate(i), i);
@@ -192,9 +191,9 @@ constexpr void buffer<T, Allocator>::initialize(InputIterator begin, InputIterat
     }
     trans.complete();
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename ForwardIterator>
-constexpr void buffer<T, Allocator>::initialize(ForwardIterator begin, ForwardIterator end, true_type) {
+constexpr void buffer<T, Allocator, GrowthPolicy>::initialize(ForwardIterator begin, ForwardIterator end, true_type) {
     const auto size {this->buffer_size()};
     this->first = this->buffer_size.allocator().allocate(size);
     auto trans {transaction {exception_handler(*this)}};
@@ -209,75 +208,91 @@ constexpr void buffer<T, Allocator>::initialize(ForwardIterator begin, ForwardIt
 }
 
 /* public functions */
-template <typename T, typename Allocator>
-constexpr buffer<T, Allocator>::buffer(size_type n, const Allocator &allocator) : buffer_size(n, allocator), first {} {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr buffer<T, Allocator, GrowthPolicy>::buffer(size_type n, const Allocator &allocator) :
+        buffer_size(n, allocator), first {} {
     this->initialize<false>({});
 }
-template <typename T, typename Allocator>
-constexpr buffer<T, Allocator>::buffer(size_type n, const T &value, const Allocator &allocator) :
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr buffer<T, Allocator, GrowthPolicy>::buffer(size_type n, const T &value, const Allocator &allocator) :
         buffer_size(n, allocator), first {} {
     this->initialize(value);
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr buffer<T, Allocator, GrowthPolicy>::buffer(size_type n, for_overwrite_tag, const Allocator &allocator) :
+        buffer_size(n, allocator), first {} {
+    this->initialize<false, true>({});
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr buffer<T, Allocator>::buffer(InputIterator begin, InputIterator end, const Allocator &allocator,
+constexpr buffer<T, Allocator, GrowthPolicy>::buffer(InputIterator begin, InputIterator end, const Allocator &allocator,
         size_type default_size) : buffer_size(default_size, allocator), first {} {
     this->initialize(begin, end, false_type {});
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsForwardIterator ForwardIterator>
-constexpr buffer<T, Allocator>::buffer(ForwardIterator begin, ForwardIterator end, const Allocator &allocator) :
-        buffer_size(ds::distance(begin, end), allocator), first {} {
+constexpr buffer<T, Allocator, GrowthPolicy>::buffer(ForwardIterator begin, ForwardIterator end,
+        const Allocator &allocator) : buffer_size(ds::distance(begin, end), allocator), first {} {
     this->initialize(begin, end, true_type {});
 }
-template <typename T, typename Allocator>
-constexpr buffer<T, Allocator>::buffer(initializer_list<T> init_list, const Allocator &allocator) :
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr buffer<T, Allocator, GrowthPolicy>::buffer(initializer_list<T> init_list, const Allocator &allocator) :
         buffer(init_list.begin(), init_list.end(), allocator) {}
 
-template <typename T, typename Allocator>
-constexpr buffer<T, Allocator>::~buffer() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr buffer<T, Allocator, GrowthPolicy>::~buffer() noexcept {
     if(this->first) {
         const auto size {this->buffer_size()};
         ds::destroy(this->first, this->first + size);
         this->buffer_size.allocator().deallocate(this->first, size);
     }
 }
-template <typename T, typename Allocator>
-constexpr typename buffer<T, Allocator>::const_pointer buffer<T, Allocator>::begin() const & noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename buffer<T, Allocator, GrowthPolicy>::const_pointer
+buffer<T, Allocator, GrowthPolicy>::begin() const & noexcept {
     return this->first;
 }
-template <typename T, typename Allocator>
-constexpr typename buffer<T, Allocator>::const_pointer buffer<T, Allocator>::end() const & noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename buffer<T, Allocator, GrowthPolicy>::const_pointer
+buffer<T, Allocator, GrowthPolicy>::end() const & noexcept {
     return this->first + this->buffer_size();
 }
-template <typename T, typename Allocator>
-constexpr typename buffer<T, Allocator>::pointer buffer<T, Allocator>::release() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename buffer<T, Allocator, GrowthPolicy>::pointer buffer<T, Allocator, GrowthPolicy>::release() noexcept {
     auto result {this->first};
     this->first = nullptr;
     return result;
 }
-template <typename T, typename Allocator>
-constexpr typename buffer<T, Allocator>::move_iterator buffer<T, Allocator>::mbegin() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename buffer<T, Allocator, GrowthPolicy>::move_iterator
+buffer<T, Allocator, GrowthPolicy>::mbegin() noexcept {
     return move_iterator(this->first);
 }
-template <typename T, typename Allocator>
-constexpr typename buffer<T, Allocator>::move_iterator buffer<T, Allocator>::mend() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename buffer<T, Allocator, GrowthPolicy>::move_iterator
+buffer<T, Allocator, GrowthPolicy>::mend() noexcept {
     return move_iterator(this->first + this->buffer_size());
 }
-template <typename T, typename Allocator>
-constexpr typename buffer<T, Allocator>::size_type buffer<T, Allocator>::size() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename buffer<T, Allocator, GrowthPolicy>::size_type
+buffer<T, Allocator, GrowthPolicy>::size() const noexcept {
     return this->buffer_size();
 }
-template <typename T, typename Allocator>
-constexpr bool buffer<T, Allocator>::empty() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr bool buffer<T, Allocator, GrowthPolicy>::empty() const noexcept {
     return this->first == nullptr;
 }
-template <typename T, typename Allocator>
-constexpr Allocator buffer<T, Allocator>::allocator() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr Allocator buffer<T, Allocator, GrowthPolicy>::allocator() const noexcept {
     return this->buffer_size.allocator();
 }
 __DATA_STRUCTURE_END(buffer implementation)
 
+__DATA_STRUCTURE_START(buffer traits)
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct is_trivially_relocatable<buffer<T, Allocator, GrowthPolicy>> : is_trivially_relocatable<Allocator> {};
+__DATA_STRUCTURE_END(buffer traits)
+
 }       // namespace data_structure
 
 #endif      // DATA_STRUCTURE_BUFFER_HPP
\ No newline at end of file
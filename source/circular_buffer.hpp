@@ -0,0 +1,458 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_CIRCULAR_BUFFER_HPP
+#define DATA_STRUCTURE_CIRCULAR_BUFFER_HPP
+
+#include "allocator.hpp"
+#include "iterator.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(circular buffer span)
+/*
+ * A contiguous piece of the elements of circular_buffer, the elements are [data(), data() + size())
+ */
+template <typename Pointer, typename SizeType>
+class circular_buffer_span {
+private:
+    Pointer first;
+    SizeType span_size;
+public:
+    constexpr circular_buffer_span(Pointer first, SizeType size) noexcept : first {first}, span_size {size} {}
+public:
+    [[nodiscard]]
+    constexpr Pointer data() const noexcept {
+        return this->first;
+    }
+    [[nodiscard]]
+    constexpr Pointer begin() const noexcept {
+        return this->first;
+    }
+    [[nodiscard]]
+    constexpr Pointer end() const noexcept {
+        return this->first + this->span_size;
+    }
+    [[nodiscard]]
+    constexpr SizeType size() const noexcept {
+        return this->span_size;
+    }
+    [[nodiscard]]
+    constexpr bool empty() const noexcept {
+        return this->span_size == 0;
+    }
+};
+__DATA_STRUCTURE_END(circular buffer span)
+
+__DATA_STRUCTURE_START(circular buffer declaration)
+/*
+ * A fixed-capacity FIFO, the capacity is rounded up to a power of two, so the slot of an element is found by masking
+ * instead of a modulo. The storage is allocated once and left uninitialized : push_back constructs the element in
+ * its slot, and pop_front, pop_back and clear destroy the elements, so T needs no default constructor and the
+ * resources held by a popped element are released at once. When it is full, push_back and emplace_back replace the
+ * oldest element, while try_push_back and try_emplace_back reject the new element. A circular_buffer without capacity
+ * drops every new element. The elements are at most two contiguous spans, first_span() and second_span(). The
+ * constructor throws std::length_error if the capacity cannot be rounded up to a power of two in size_type.
+ */
+template <typename T, typename Allocator = allocator<T>>
+class circular_buffer {
+public:
+    using allocator_type = Allocator;
+    using size_type = typename Allocator::size_type;
+    using difference_type = typename Allocator::difference_type;
+    using value_type = T;
+    using reference = typename allocator_traits<Allocator>::reference;
+    using const_reference = typename allocator_traits<Allocator>::const_reference;
+    using rvalue_reference = typename allocator_traits<Allocator>::rvalue_reference;
+    using pointer = typename allocator_traits<Allocator>::pointer;
+    using const_pointer = typename allocator_traits<Allocator>::const_pointer;
+    using iterator = __dsa::circular_buffer_iterator<T, false>;
+    using const_iterator = __dsa::circular_buffer_iterator<T, true>;
+    using reverse_iterator = ds::reverse_iterator<iterator>;
+    using const_reverse_iterator = ds::reverse_iterator<const_iterator>;
+    using span = circular_buffer_span<pointer, size_type>;
+    using const_span = circular_buffer_span<const_pointer, size_type>;
+    static_assert(is_same_v<T, typename Allocator::value_type>,
+            "The value type of circular_buffer should be same as the allocator's value_type!");
+private:
+    pointer first;
+    size_type head;
+    size_type element_size;
+    __dsa::allocator_compressor<size_type, Allocator> storage_size;
+private:
+    [[nodiscard]]
+    constexpr size_type mask() const noexcept;
+    constexpr void deallocate_storage() noexcept;
+public:
+    constexpr circular_buffer() noexcept(is_nothrow_default_constructible_v<Allocator>);
+    explicit constexpr circular_buffer(size_type, const Allocator & = {});
+    constexpr circular_buffer(const circular_buffer &);
+    constexpr circular_buffer(circular_buffer &&) noexcept;
+    constexpr ~circular_buffer() noexcept;
+public:
+    constexpr circular_buffer &operator=(const circular_buffer &);
+    constexpr circular_buffer &operator=(circular_buffer &&) noexcept;
+    [[nodiscard]]
+    constexpr reference operator[](size_type) noexcept;
+    [[nodiscard]]
+    constexpr const_reference operator[](size_type) const noexcept;
+public:
+    [[nodiscard]]
+    constexpr iterator begin() noexcept;
+    [[nodiscard]]
+    constexpr const_iterator begin() const noexcept;
+    [[nodiscard]]
+    constexpr const_iterator cbegin() const noexcept;
+    [[nodiscard]]
+    constexpr iterator end() noexcept;
+    [[nodiscard]]
+    constexpr const_iterator end() const noexcept;
+    [[nodiscard]]
+    constexpr const_iterator cend() const noexcept;
+    [[nodiscard]]
+    constexpr reverse_iterator rbegin() noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator rbegin() const noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator crbegin() const noexcept;
+    [[nodiscard]]
+    constexpr reverse_iterator rend() noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator rend() const noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator crend() const noexcept;
+    [[nodiscard]]
+    constexpr span first_span() noexcept;
+    [[nodiscard]]
+    constexpr const_span first_span() const noexcept;
+    [[nodiscard]]
+    constexpr span second_span() noexcept;
+    [[nodiscard]]
+    constexpr const_span second_span() const noexcept;
+    [[nodiscard]]
+    constexpr size_type size() const noexcept;
+    [[nodiscard]]
+    constexpr bool empty() const noexcept;
+    [[nodiscard]]
+    constexpr bool full() const noexcept;
+    [[nodiscard]]
+    constexpr size_type capacity() const noexcept;
+    [[nodiscard]]
+    constexpr reference front() noexcept;
+    [[nodiscard]]
+    constexpr const_reference front() const noexcept;
+    [[nodiscard]]
+    constexpr reference back() noexcept;
+    [[nodiscard]]
+    constexpr const_reference back() const noexcept;
+    [[nodiscard]]
+    constexpr Allocator allocator() const noexcept;
+    constexpr void push_back(const_reference);
+    constexpr void push_back(rvalue_reference);
+    template <typename ...Args>
+    constexpr void emplace_back(Args &&...);
+    constexpr bool try_push_back(const_reference);
+    constexpr bool try_push_back(rvalue_reference);
+    template <typename ...Args>
+    constexpr bool try_emplace_back(Args &&...);
+    constexpr void pop_front() noexcept;
+    constexpr void pop_front(size_type) noexcept;
+    constexpr void pop_back() noexcept;
+    constexpr void clear() noexcept;
+    constexpr void swap(circular_buffer &) noexcept;
+};
+__DATA_STRUCTURE_END(circular buffer declaration)
+
+__DATA_STRUCTURE_START(circular buffer implementation)
+/* private functions */
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::size_type circular_buffer<T, Allocator>::mask() const noexcept {
+    return this->storage_size() - 1;
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::deallocate_storage() noexcept {
+    if(this->first) {
+        this->clear();
+        this->storage_size.allocator().deallocate(this->first, this->storage_size());
+    }
+}
+
+/* public functions */
+template <typename T, typename Allocator>
+constexpr circular_buffer<T, Allocator>::circular_buffer() noexcept(is_nothrow_default_constructible_v<Allocator>) :
+        first {}, head {0}, element_size {0}, storage_size {0} {}
+template <typename T, typename Allocator>
+constexpr circular_buffer<T, Allocator>::circular_buffer(size_type n, const Allocator &allocator) :
+        first {}, head {0}, element_size {0}, storage_size(n == 0 ? 0 : ds::bit_ceil(n), allocator) {
+    if(n not_eq 0) {
+        this->first = this->storage_size.allocator().allocate(this->storage_size());
+    }
+}
+template <typename T, typename Allocator>
+constexpr circular_buffer<T, Allocator>::circular_buffer(const circular_buffer &rhs) :
+        circular_buffer(rhs.capacity(), rhs.allocator()) {
+    // the constructor is delegated, so the destructor destroys the copied elements if a copy throws
+    for(; this->element_size < rhs.element_size; ++this->element_size) {
+        ds::construct(this->first + this->element_size, rhs[this->element_size]);
+    }
+}
+template <typename T, typename Allocator>
+constexpr circular_buffer<T, Allocator>::circular_buffer(circular_buffer &&rhs) noexcept : first {rhs.first},
+        head {rhs.head}, element_size {rhs.element_size}, storage_size {ds::move(rhs.storage_size)} {
+    rhs.first = nullptr;
+    rhs.head = rhs.element_size = rhs.storage_size() = 0;
+}
+template <typename T, typename Allocator>
+constexpr circular_buffer<T, Allocator>::~circular_buffer() noexcept {
+    this->deallocate_storage();
+}
+template <typename T, typename Allocator>
+constexpr circular_buffer<T, Allocator> &circular_buffer<T, Allocator>::operator=(const circular_buffer &rhs) {
+    if(this not_eq &rhs) {
+        if(this->capacity() == rhs.capacity()) {
+            this->clear();
+            for(; this->element_size < rhs.element_size; ++this->element_size) {
+                ds::construct(this->first + this->element_size, rhs[this->element_size]);
+            }
+        }else {
+            circular_buffer(rhs).swap(*this);
+        }
+    }
+    return *this;
+}
+template <typename T, typename Allocator>
+constexpr circular_buffer<T, Allocator> &circular_buffer<T, Allocator>::operator=(circular_buffer &&rhs) noexcept {
+    if(this not_eq &rhs) {
+        this->deallocate_storage();
+        this->first = rhs.first;
+        this->head = rhs.head;
+        this->element_size = rhs.element_size;
+        this->storage_size = ds::move(rhs.storage_size);
+        rhs.first = nullptr;
+        rhs.head = rhs.element_size = rhs.storage_size() = 0;
+    }
+    return *this;
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::reference
+circular_buffer<T, Allocator>::operator[](size_type n) noexcept {
+    return this->first[(this->head + n) & this->mask()];
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_reference
+circular_buffer<T, Allocator>::operator[](size_type n) const noexcept {
+    return this->first[(this->head + n) & this->mask()];
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::iterator circular_buffer<T, Allocator>::begin() noexcept {
+    return iterator(this->first, this->mask(), this->head);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_iterator
+circular_buffer<T, Allocator>::begin() const noexcept {
+    return const_iterator(this->first, this->mask(), this->head);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_iterator
+circular_buffer<T, Allocator>::cbegin() const noexcept {
+    return this->begin();
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::iterator circular_buffer<T, Allocator>::end() noexcept {
+    return iterator(this->first, this->mask(), this->head + this->element_size);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_iterator
+circular_buffer<T, Allocator>::end() const noexcept {
+    return const_iterator(this->first, this->mask(), this->head + this->element_size);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_iterator
+circular_buffer<T, Allocator>::cend() const noexcept {
+    return this->end();
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::reverse_iterator circular_buffer<T, Allocator>::rbegin() noexcept {
+    return reverse_iterator(this->end() - 1);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_reverse_iterator
+circular_buffer<T, Allocator>::rbegin() const noexcept {
+    return const_reverse_iterator(this->end() - 1);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_reverse_iterator
+circular_buffer<T, Allocator>::crbegin() const noexcept {
+    return this->rbegin();
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::reverse_iterator circular_buffer<T, Allocator>::rend() noexcept {
+    return reverse_iterator(this->begin() - 1);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_reverse_iterator
+circular_buffer<T, Allocator>::rend() const noexcept {
+    return const_reverse_iterator(this->begin() - 1);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_reverse_iterator
+circular_buffer<T, Allocator>::crend() const noexcept {
+    return this->rend();
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::span circular_buffer<T, Allocator>::first_span() noexcept {
+    const auto tail_room {this->storage_size() - this->head};
+    return span(this->first + this->head, this->element_size < tail_room ? this->element_size : tail_room);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_span
+circular_buffer<T, Allocator>::first_span() const noexcept {
+    const auto tail_room {this->storage_size() - this->head};
+    return const_span(this->first + this->head, this->element_size < tail_room ? this->element_size : tail_room);
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::span circular_buffer<T, Allocator>::second_span() noexcept {
+    return span(this->first, this->element_size - this->first_span().size());
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_span
+circular_buffer<T, Allocator>::second_span() const noexcept {
+    return const_span(this->first, this->element_size - this->first_span().size());
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::size_type circular_buffer<T, Allocator>::size() const noexcept {
+    return this->element_size;
+}
+template <typename T, typename Allocator>
+constexpr bool circular_buffer<T, Allocator>::empty() const noexcept {
+    return this->element_size == 0;
+}
+template <typename T, typename Allocator>
+constexpr bool circular_buffer<T, Allocator>::full() const noexcept {
+    return this->element_size == this->storage_size();
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::size_type circular_buffer<T, Allocator>::capacity() const noexcept {
+    return this->storage_size();
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::reference circular_buffer<T, Allocator>::front() noexcept {
+    return this->first[this->head];
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_reference
+circular_buffer<T, Allocator>::front() const noexcept {
+    return this->first[this->head];
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::reference circular_buffer<T, Allocator>::back() noexcept {
+    return (*this)[this->element_size - 1];
+}
+template <typename T, typename Allocator>
+constexpr typename circular_buffer<T, Allocator>::const_reference
+circular_buffer<T, Allocator>::back() const noexcept {
+    return (*this)[this->element_size - 1];
+}
+template <typename T, typename Allocator>
+constexpr Allocator circular_buffer<T, Allocator>::allocator() const noexcept {
+    return this->storage_size.allocator();
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::push_back(const_reference value) {
+    this->emplace_back(value);
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::push_back(rvalue_reference value) {
+    this->emplace_back(ds::move(value));
+}
+template <typename T, typename Allocator>
+template <typename ...Args>
+constexpr void circular_buffer<T, Allocator>::emplace_back(Args &&...args) {
+    if(this->storage_size() == 0) {
+        return;
+    }
+    if(this->full()) {
+        // the arguments may refer to the oldest element, so it is destroyed after the new element is made
+        T value(ds::forward<Args>(args)...);
+        this->pop_front();
+        ds::construct(ds::address_of((*this)[this->element_size]), ds::move(value));
+    }else {
+        ds::construct(ds::address_of((*this)[this->element_size]), ds::forward<Args>(args)...);
+    }
+    ++this->element_size;
+}
+template <typename T, typename Allocator>
+constexpr bool circular_buffer<T, Allocator>::try_push_back(const_reference value) {
+    return this->try_emplace_back(value);
+}
+template <typename T, typename Allocator>
+constexpr bool circular_buffer<T, Allocator>::try_push_back(rvalue_reference value) {
+    return this->try_emplace_back(ds::move(value));
+}
+template <typename T, typename Allocator>
+template <typename ...Args>
+constexpr bool circular_buffer<T, Allocator>::try_emplace_back(Args &&...args) {
+    if(this->full()) {
+        return false;
+    }
+    ds::construct(ds::address_of((*this)[this->element_size]), ds::forward<Args>(args)...);
+    ++this->element_size;
+    return true;
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::pop_front() noexcept {
+    ds::destroy(ds::address_of(this->front()));
+    this->head = (this->head + 1) & this->mask();
+    --this->element_size;
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::pop_front(size_type n) noexcept {
+    if constexpr(not is_trivially_destructible_v<T>) {
+        for(size_type i {0}; i < n; ++i) {
+            ds::destroy(ds::address_of((*this)[i]));
+        }
+    }
+    this->head = (this->head + n) & this->mask();
+    this->element_size -= n;
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::pop_back() noexcept {
+    ds::destroy(ds::address_of(this->back()));
+    --this->element_size;
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::clear() noexcept {
+    this->pop_front(this->element_size);
+    this->head = 0;
+}
+template <typename T, typename Allocator>
+constexpr void circular_buffer<T, Allocator>::swap(circular_buffer &rhs) noexcept {
+    using ds::swap;
+    swap(this->first, rhs.first);
+    swap(this->head, rhs.head);
+    swap(this->element_size, rhs.element_size);
+    swap(this->storage_size, rhs.storage_size);
+}
+__DATA_STRUCTURE_END(circular buffer implementation)
+
+__DATA_STRUCTURE_START(circular buffer traits)
+template <typename T, typename Allocator>
+struct is_trivially_relocatable<circular_buffer<T, Allocator>> : is_trivially_relocatable<Allocator> {};
+__DATA_STRUCTURE_END(circular buffer traits)
+
+}       // namespace data_structure
+
+#endif      // DATA_STRUCTURE_CIRCULAR_BUFFER_HPP
@@ -0,0 +1,187 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+#ifndef DATA_STRUCTURE_COMPARE_HPP
+#define DATA_STRUCTURE_COMPARE_HPP
+
+#include "iterator.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(inner tools for comparison)
+namespace __data_structure_implement {
+// the integers of 1, 2, 4 or 8 bytes, whose equality is the equality of their bytes
+template <typename T>
+inline constexpr bool is_vectorizable_v {
+    is_integral_v<T> and (sizeof(T) == 1 or sizeof(T) == 2 or sizeof(T) == 4 or sizeof(T) == 8)
+};
+}
+namespace __data_structure_auxiliary {
+/*
+ * Whether the algorithm on Iterator could be forwarded to the vectorized kernels, that is, Iterator is contiguous
+ * and its value_type is the integer T
+ */
+template <typename Iterator, typename T = remove_cv_t<typename iterator_traits<Iterator>::value_type>>
+inline constexpr bool is_vectorizable_iterator_v {
+    is_contiguous_iterator_v<Iterator> and is_same_v<remove_cv_t<typename iterator_traits<Iterator>::value_type>, T>
+            and __dsi::is_vectorizable_v<T>
+};
+
+/*
+ * synth_three_way compares by operator<=> if the operands have one, otherwise the weak_ordering is derived from
+ * operator<, so the containers of the types which only define operator< are still ordered
+ */
+struct synth_three_way {
+    template <typename T, typename U>
+    [[nodiscard]]
+    constexpr auto operator()(const T &lhs, const U &rhs) const noexcept(is_three_way_comparable_v<const T &,
+            const U &> ? is_nothrow_three_way_comparable_v<const T &, const U &> :
+            is_nothrow_less_comparable_v<const T &, const U &> and is_nothrow_less_comparable_v<const U &, const T &>)
+            requires is_three_way_comparable_v<const T &, const U &> or
+                    (is_less_comparable_v<const T &, const U &> and is_less_comparable_v<const U &, const T &>) {
+        if constexpr(is_three_way_comparable_v<const T &, const U &>) {
+            return lhs <=> rhs;
+        }else {
+            if(lhs < rhs) {
+                return weak_ordering::less;
+            }
+            if(rhs < lhs) {
+                return weak_ordering::greater;
+            }
+            return weak_ordering::equivalent;
+        }
+    }
+};
+template <typename T, typename U = T>
+inline constexpr auto is_nothrow_synth_three_way_comparable_v {
+    noexcept(synth_three_way {}(declval<const T &>(), declval<const U &>()))
+};
+}
+__DATA_STRUCTURE_END(inner tools for comparison)
+
+__DATA_STRUCTURE_START(comparison algorithms)
+template <IsInputIterator InputIterator1, IsInputIterator InputIterator2>
+[[nodiscard]]
+constexpr bool equal(InputIterator1 begin1, InputIterator1 end1, InputIterator2 begin2) {
+    if constexpr(__dsa::is_vectorizable_iterator_v<InputIterator1> and __dsa::is_vectorizable_iterator_v<
+            InputIterator2, remove_cv_t<typename iterator_traits<InputIterator1>::value_type>>) {
+        if(not ds::is_constant_evaluated()) {
+            const auto size {static_cast<size_t>(end1 - begin1)};
+            return size == 0 or ds::memory_comparison(ds::address_of(*begin1), ds::address_of(*begin2),
+                    sizeof(typename iterator_traits<InputIterator1>::value_type) * size) == 0;
+        }
+    }
+    for(; begin1 not_eq end1; ++begin1, static_cast<void>(++begin2)) {
+        if(not(*begin1 == *begin2)) {
+            return false;
+        }
+    }
+    return true;
+}
+template <IsInputIterator InputIterator1, IsInputIterator InputIterator2>
+[[nodiscard]]
+constexpr bool equal(InputIterator1 begin1, InputIterator1 end1, InputIterator2 begin2, InputIterator2 end2) {
+    if constexpr(is_random_access_iterator_v<InputIterator1> and is_random_access_iterator_v<InputIterator2>) {
+        if(end1 - begin1 not_eq end2 - begin2) {
+            return false;
+        }
+        return ds::equal(begin1, end1, begin2);
+    }else {
+        for(; begin1 not_eq end1 and begin2 not_eq end2; ++begin1, static_cast<void>(++begin2)) {
+            if(not(*begin1 == *begin2)) {
+                return false;
+            }
+        }
+        return begin1 == end1 and begin2 == end2;
+    }
+}
+template <IsInputIterator InputIterator1, IsInputIterator InputIterator2, typename Compare>
+[[nodiscard]]
+constexpr auto lexicographical_compare_three_way(InputIterator1 begin1, InputIterator1 end1,
+        InputIterator2 begin2, InputIterator2 end2, Compare compare) {
+    using ordering = decltype(compare(*begin1, *begin2));
+    for(; begin1 not_eq end1 and begin2 not_eq end2; ++begin1, static_cast<void>(++begin2)) {
+        if(const auto result {compare(*begin1, *begin2)}; result not_eq 0) {
+            return ordering {result};
+        }
+    }
+    if(begin1 == end1) {
+        return ordering {begin2 == end2 ? strong_ordering::equal : strong_ordering::less};
+    }
+    return ordering {strong_ordering::greater};
+}
+template <IsInputIterator InputIterator1, IsInputIterator InputIterator2>
+[[nodiscard]]
+constexpr auto lexicographical_compare_three_way(InputIterator1 begin1, InputIterator1 end1,
+        InputIterator2 begin2, InputIterator2 end2) {
+    if constexpr(__dsa::is_vectorizable_iterator_v<InputIterator1> and __dsa::is_vectorizable_iterator_v<
+            InputIterator2, remove_cv_t<typename iterator_traits<InputIterator1>::value_type>>) {
+        if(not ds::is_constant_evaluated()) {
+            using value_type = remove_cv_t<typename iterator_traits<InputIterator1>::value_type>;
+            const auto size1 {end1 - begin1};
+            const auto size2 {end2 - begin2};
+            const auto size {static_cast<size_t>(size1 < size2 ? size1 : size2)};
+            if(size not_eq 0) {
+                const auto first1 {ds::address_of(*begin1)};
+                const auto first2 {ds::address_of(*begin2)};
+                if constexpr(sizeof(value_type) == 1 and is_unsigned_v<value_type>) {
+                    // memcmp compares the bytes as unsigned char, which is the order of the unsigned bytes
+                    if(const auto result {ds::memory_comparison(first1, first2, size)}; result not_eq 0) {
+                        return result <=> 0;
+                    }
+                }else {
+                    // the equal prefix is skipped by memcmp in chunks, the first different chunk is left to the loop
+                    constexpr auto chunk {256 / sizeof(value_type)};
+                    auto i {0uz};
+                    while(size - i >= chunk and
+                            ds::memory_comparison(first1 + i, first2 + i, sizeof(value_type) * chunk) == 0) {
+                        i += chunk;
+                    }
+                    for(; i < size; ++i) {
+                        if(first1[i] not_eq first2[i]) {
+                            return first1[i] <=> first2[i];
+                        }
+                    }
+                }
+            }
+            return size1 <=> size2;
+        }
+    }
+    return ds::lexicographical_compare_three_way(begin1, end1, begin2, end2, __dsa::synth_three_way {});
+}
+template <IsInputIterator InputIterator1, IsInputIterator InputIterator2>
+[[nodiscard]]
+constexpr bool lexicographical_compare(InputIterator1 begin1, InputIterator1 end1,
+        InputIterator2 begin2, InputIterator2 end2) {
+    if constexpr(__dsa::is_vectorizable_iterator_v<InputIterator1> and __dsa::is_vectorizable_iterator_v<
+            InputIterator2, remove_cv_t<typename iterator_traits<InputIterator1>::value_type>>) {
+        return ds::lexicographical_compare_three_way(begin1, end1, begin2, end2) < 0;
+    }else {
+        for(; begin1 not_eq end1 and begin2 not_eq end2; ++begin1, static_cast<void>(++begin2)) {
+            if(*begin1 < *begin2) {
+                return true;
+            }
+            if(*begin2 < *begin1) {
+                return false;
+            }
+        }
+        return begin1 == end1 and begin2 not_eq end2;
+    }
+}
+__DATA_STRUCTURE_END(comparison algorithms)
+
+}       // namespace data_structure
+
+#endif      //DATA_STRUCTURE_COMPARE_HPP
@@ -0,0 +1,356 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_CONCURRENT_ALLOCATOR_HPP
+#define DATA_STRUCTURE_CONCURRENT_ALLOCATOR_HPP
+
+#include "allocator.hpp"
+#include "atomic.hpp"
+#include "memory.hpp"
+
+namespace data_structure::__data_structure_auxiliary {
+
+__DATA_STRUCTURE_START(concurrent forward list node allocator)
+/*
+ * The concurrent version of forward_list_node_allocator. Its copies share one node pool and could be used by
+ * different threads at the same time, such as a producer list and a consumer list. The strong count is atomic and
+ * the shared free list is a lock-free stack of one pointer. A copy pushes a chain of nodes by a compare-and-swap and
+ * takes the whole stack by one exchange, so the links of the shared nodes are only read by the copy owning them,
+ * the stack has no ABA problem and the containers link the nodes as usual. Each copy holds a magazine, which is
+ * refilled to at least MagazineSize nodes and returns the nodes beyond twice that many to the shared free list, so
+ * the nodes are moved between the copies in batch. A copy finding the stack empty while another copy is splitting
+ * the stack allocates a new chunk. A copy itself is not thread-safe, it should be owned by only one container like
+ * the other allocators.
+ * Only forward_list takes it for now. The pool of the other node containers, node_allocator, is still unfinished and
+ * not thread-safe.
+ */
+template <typename T, template <typename> typename NodeTemplate, typename Allocator = allocator<T>,
+        typename NodeAllocator = typename allocator_traits<Allocator>::template rebind<NodeTemplate<T>>,
+        size_t MagazineSize = 64>
+class concurrent_forward_list_node_allocator : public Allocator, public NodeAllocator {
+    static_assert(MagazineSize > 0, "The magazine size of concurrent_forward_list_node_allocator should be positive!");
+private:
+    struct node_chain {
+        NodeTemplate<T> *first;
+        NodeTemplate<T> *last;
+    };
+    struct construction_handler {
+        concurrent_forward_list_node_allocator &allocator;
+        node_chain chain;
+        NodeTemplate<T> *end;
+        size_t n;
+        void operator()() noexcept {
+            for(auto it {this->chain.first}; it not_eq this->end; it = next_node(it)) {
+                ds::destroy(ds::address_of(it->value));
+            }
+            this->allocator.give(this->chain, this->n);
+        }
+    };
+public:
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using value_type = T;
+    static_assert(is_same_v<T, typename allocator_traits<Allocator>::value_type>,
+            "The value type of concurrent_forward_list_node_allocator must be same as original allocator!");
+private:
+    using free_list_type = atomic<NodeTemplate<T> *>;
+    struct recorder_list {
+        NodeTemplate<T> *record;
+        size_t size;
+        recorder_list *next;
+    };
+    struct shared_block {
+        free_list_type free_list;
+        atomic<size_t> strong_count;
+        atomic<recorder_list *> recorder;
+    } *shared_list;
+    struct {
+        NodeTemplate<T> *first;
+        NodeTemplate<T> *last;
+        size_t size;
+    } magazine;
+public:
+    constexpr static auto linked_after_allocation {true};
+private:
+    static NodeTemplate<T> *next_node(NodeTemplate<T> *node) noexcept {
+        return static_cast<NodeTemplate<T> *>(node->next);
+    }
+    static void link_node(NodeTemplate<T> *node, NodeTemplate<T> *next) noexcept {
+        node->next = next;
+    }
+    void push(node_chain chain) noexcept {
+        auto &free_list {this->shared_list->free_list};
+        auto head {free_list.load(memory_order_relaxed)};
+        do {
+            link_node(chain.last, head);
+        }while(not free_list.compare_exchange_weak(head, chain.first, memory_order_release, memory_order_relaxed));
+    }
+    size_t pop() noexcept {
+        // the nodes are owned by this copy once the stack is detached, so they are walked without any atomic access
+        const auto first {this->shared_list->free_list.exchange(nullptr, memory_order_acquire)};
+        if(not first) {
+            return 0;
+        }
+        auto last {first};
+        auto size {1uz};
+        for(auto next {next_node(last)}; next; next = next_node(last), static_cast<void>(++size)) {
+            last = next;
+        }
+        this->put_into_magazine({first, last}, size);
+        return size;
+    }
+    void spill(size_t keep) noexcept {
+        if(this->magazine.size > keep * 2) {
+            auto last {this->magazine.first};
+            for(auto i {1uz}; i < keep; ++i) {
+                last = next_node(last);
+            }
+            this->push({next_node(last), this->magazine.last});
+            this->magazine.last = last;
+            this->magazine.size = keep;
+        }
+    }
+    void put_into_magazine(node_chain chain, size_t n) noexcept {
+        link_node(chain.last, this->magazine.first);
+        if(not this->magazine.first) {
+            this->magazine.last = chain.last;
+        }
+        this->magazine.first = chain.first;
+        this->magazine.size += n;
+    }
+    template <bool NoThrow>
+    bool refill(size_t n) noexcept(NoThrow) {
+        if(this->magazine.size >= n) {
+            return true;
+        }
+        if(this->pop() not_eq 0) {
+            this->spill(n < MagazineSize ? MagazineSize : n);
+            if(this->magazine.size >= n) {
+                return true;
+            }
+        }
+        const auto need {n - this->magazine.size};
+        const auto size {need < MagazineSize ? MagazineSize : need};
+        const auto nodes {this->NodeAllocator::template allocate<NoThrow>(size)};
+        if constexpr(NoThrow) {
+            if(not nodes) {
+                return false;
+            }
+        }
+        recorder_list *record;
+        if constexpr(NoThrow) {
+            record = ::new (ds::nothrow) recorder_list {nodes, size, nullptr};
+            if(not record) {
+                this->NodeAllocator::deallocate(nodes, size);
+                return false;
+            }
+        }else {
+            try {
+                record = ::new recorder_list {nodes, size, nullptr};
+            }catch(...) {
+                this->NodeAllocator::deallocate(nodes, size);
+                throw;
+            }
+        }
+        auto &recorder {this->shared_list->recorder};
+        record->next = recorder.load(memory_order_relaxed);
+        while(not recorder.compare_exchange_weak(record->next, record,
+                memory_order_release, memory_order_relaxed));
+        for(auto i {1uz}; i < size; ++i) {
+            nodes[i - 1].next = nodes + i;
+        }
+        this->put_into_magazine({nodes, nodes + (size - 1)}, size);
+        return true;
+    }
+    node_chain take(size_t n) noexcept {
+        auto last {this->magazine.first};
+        for(auto i {1uz}; i < n; ++i) {
+            last = next_node(last);
+        }
+        const node_chain result {this->magazine.first, last};
+        this->magazine.first = next_node(last);
+        if((this->magazine.size -= n) == 0) {
+            this->magazine.first = this->magazine.last = nullptr;
+        }
+        return result;
+    }
+    void give(node_chain chain, size_t n) noexcept {
+        this->put_into_magazine(chain, n);
+        this->spill(MagazineSize);
+    }
+    void release_this() noexcept {
+        if(not this->shared_list) {
+            return;
+        }
+        if(this->magazine.first) {
+            this->push({this->magazine.first, this->magazine.last});
+            this->magazine = {};
+        }
+        if(this->shared_list->strong_count.fetch_sub(1, memory_order_acq_rel) == 1) {
+            for(auto it {this->shared_list->recorder.load(memory_order_acquire)}; it;) {
+                auto backup {it};
+                it = it->next;
+                this->NodeAllocator::deallocate(backup->record, backup->size);
+                ::delete backup;
+            }
+            ::delete this->shared_list;
+        }
+        this->shared_list = nullptr;
+    }
+public:
+    concurrent_forward_list_node_allocator() : Allocator(), NodeAllocator(),
+            shared_list {::new shared_block {{}, 1, nullptr}}, magazine {} {}
+    explicit concurrent_forward_list_node_allocator(const Allocator &allocator) : Allocator(allocator),
+            NodeAllocator(rebind_allocator<NodeAllocator>(allocator)),
+            shared_list {::new shared_block {{}, 1, nullptr}}, magazine {} {}
+    concurrent_forward_list_node_allocator(const concurrent_forward_list_node_allocator &rhs) noexcept :
+            Allocator(rhs), NodeAllocator(rhs), shared_list {rhs.shared_list}, magazine {} {
+        this->shared_list->strong_count.fetch_add(1, memory_order_relaxed);
+    }
+    concurrent_forward_list_node_allocator(concurrent_forward_list_node_allocator &&rhs) noexcept :
+            Allocator(ds::move(rhs)), NodeAllocator(ds::move(rhs)), shared_list {rhs.shared_list},
+            magazine {rhs.magazine} {
+        rhs.shared_list = nullptr;
+        rhs.magazine = {};
+    }
+    ~concurrent_forward_list_node_allocator() noexcept {
+        this->release_this();
+    }
+public:
+    concurrent_forward_list_node_allocator &operator=(const concurrent_forward_list_node_allocator &rhs) noexcept {
+        if(this not_eq &rhs) {
+            this->release_this();
+            this->shared_list = rhs.shared_list;
+            this->shared_list->strong_count.fetch_add(1, memory_order_relaxed);
+            this->Allocator::operator=(rhs);
+            this->NodeAllocator::operator=(rhs);
+        }
+        return *this;
+    }
+    concurrent_forward_list_node_allocator &operator=(concurrent_forward_list_node_allocator &&rhs) noexcept {
+        if(this not_eq &rhs) {
+            this->release_this();
+            this->shared_list = rhs.shared_list;
+            this->magazine = rhs.magazine;
+            rhs.shared_list = nullptr;
+            rhs.magazine = {};
+            this->Allocator::operator=(ds::move(rhs));
+            this->NodeAllocator::operator=(ds::move(rhs));
+        }
+        return *this;
+    }
+    friend bool operator==(const concurrent_forward_list_node_allocator &lhs,
+            const concurrent_forward_list_node_allocator &rhs) noexcept {
+        return lhs.shared_list == rhs.shared_list;
+    }
+public:
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    NodeTemplate<T> *allocate(size_t n, NodeTemplate<T> *link_to = {}) noexcept(NoThrow) {
+        if(n == 0 or not this->refill<NoThrow>(n)) {
+            return nullptr;
+        }
+        const auto chain {this->take(n)};
+        link_node(chain.last, link_to);
+        return chain.first;
+    }
+    template <typename ...Args>
+    [[nodiscard]]
+    NodeTemplate<T> *allocate_with_value(size_t n, NodeTemplate<T> *link_to, Args &&...args) {
+        if(n == 0) {
+            return nullptr;
+        }
+        this->refill<false>(n);
+        const auto chain {this->take(n)};
+        auto trans {transaction {construction_handler {*this, chain, chain.first, n}}};
+        for(auto &cursor {trans.get_rollback().end}; cursor not_eq chain.last; cursor = next_node(cursor)) {
+            ds::construct(ds::address_of(cursor->value), ds::forward<Args>(args)...);
+        }
+        ds::construct(ds::address_of(chain.last->value), ds::forward<Args>(args)...);
+        trans.complete();
+        link_node(chain.last, link_to);
+        return chain.first;
+    }
+    template <IsInputIterator InputIterator>
+    [[nodiscard]]
+    NodeTemplate<T> *allocate_with_range(size_t n, NodeTemplate<T> *link_to, InputIterator begin) {
+        if(n == 0) {
+            return nullptr;
+        }
+        this->refill<false>(n);
+        const auto chain {this->take(n)};
+        auto trans {transaction {construction_handler {*this, chain, chain.first, n}}};
+        for(auto &cursor {trans.get_rollback().end}; cursor not_eq chain.last; cursor = next_node(cursor)) {
+            ds::construct(ds::address_of(cursor->value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
+        }
+        ds::construct(ds::address_of(chain.last->value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin));
+        trans.complete();
+        link_node(chain.last, link_to);
+        return chain.first;
+    }
+    template <bool = false>
+    [[nodiscard]]
+    void *reallocate(void *source, size_t n) noexcept {
+        if(n == 0) {
+            this->deallocate(source);
+        }
+        return nullptr;
+    }
+    void deallocate(void *p) noexcept {
+        this->deallocate(static_cast<NodeTemplate<T> *>(p));
+    }
+    void deallocate(void *p, size_t n) noexcept {
+        this->deallocate(static_cast<NodeTemplate<T> *>(p), n);
+    }
+    void deallocate(void *begin, void *end) noexcept {
+        this->deallocate(static_cast<NodeTemplate<T> *>(begin), static_cast<NodeTemplate<T> *>(end));
+    }
+    void deallocate(void *begin, void *end, size_t n) noexcept {
+        this->deallocate(static_cast<NodeTemplate<T> *>(begin), static_cast<NodeTemplate<T> *>(end), n);
+    }
+    void deallocate(NodeTemplate<T> *node) noexcept {
+        if(node) {
+            this->give({node, node}, 1);
+        }
+    }
+    void deallocate(NodeTemplate<T> *node, size_t n) noexcept {
+        if(node) {
+            auto last {node};
+            for(auto i {1uz}; i < n; ++i) {
+                last = next_node(last);
+            }
+            this->give({node, last}, n);
+        }
+    }
+    void deallocate(NodeTemplate<T> *begin, NodeTemplate<T> *end) noexcept {
+        if(begin) {
+            auto n {1uz};
+            for(auto it {begin}; it not_eq end; it = next_node(it), static_cast<void>(++n));
+            this->give({begin, end}, n);
+        }
+    }
+    void deallocate(NodeTemplate<T> *begin, NodeTemplate<T> *end, size_t n) noexcept {
+        if(begin) {
+            this->give({begin, end}, n);
+        }
+    }
+};
+__DATA_STRUCTURE_END(concurrent forward list node allocator)
+
+
+}       // namespace data_structure::__data_structure_auxiliary
+
+#endif      // DATA_STRUCTURE_CONCURRENT_ALLOCATOR_HPP
@@ -17,15 +17,130 @@
 #ifndef DATA_STRUCTURE_DEQUE_HPP
 #define DATA_STRUCTURE_DEQUE_HPP
 
-#include <deque>
-#include <map>
-
 #include "allocator.hpp"
 
 namespace data_structure {
 
+__DATA_STRUCTURE_START(deque block size)
+/*
+ * The block size of deque is the count of elements of a block. The default one makes the blocks 4 KiB (16 elements
+ * for the elements not less than 256 bytes), deque_block_size<T, Bytes> makes the blocks of Bytes bytes, e.g. the
+ * larger blocks for the streaming queues, or the blocks of the large messages holding more than 16 elements.
+ * huge_page_deque_block_size<T, Bytes> rounds Bytes up to a multiple of the huge page size (2 MiB), so a block fills
+ * the huge pages it occupies if the allocator hands out the memory aligned to the huge pages.
+ */
+inline constexpr size_t huge_page_size {2uz * 1024 * 1024};
+template <typename T, size_t Bytes>
+inline constexpr size_t deque_block_size {Bytes < sizeof(T) ? 1 : Bytes / sizeof(T)};
+template <typename T, size_t Bytes = huge_page_size>
+inline constexpr size_t huge_page_deque_block_size {
+    deque_block_size<T, (Bytes + huge_page_size - 1) / huge_page_size * huge_page_size>
+};
+__DATA_STRUCTURE_END(deque block size)
+
+__DATA_STRUCTURE_START(deque block cache declaration)
+/*
+ * The spare blocks shared by the deques of the same value type, allocator and block size, e.g. many short-lived
+ * queues. A deque which shares a cache gives its spare blocks beyond its high-water mark (and all its blocks when it's
+ * destroyed) to the cache, and takes the blocks from the cache before allocating. The cache keeps at most
+ * high_water_mark() blocks, the others are deallocated. The cache is not synchronized, it should outlive the deques
+ * sharing it, and the allocators of the deques should be equal to the one of the cache.
+ */
+template <typename T, typename Allocator = allocator<T>, size_t BlockSize = __dsa::deque_default_block_size<T>>
+class deque_block_cache {
+public:
+    using allocator_type = Allocator;
+    using size_type = typename Allocator::size_type;
+    static constexpr auto block_size {BlockSize};
+private:
+    using list_allocator = typename allocator_traits<Allocator>::template rebind<T *>;
+private:
+    T **blocks;
+    __dsa::allocator_compressor<size_type, list_allocator> block_count;
+    __dsa::allocator_compressor<size_type, Allocator> limit;
+public:
+    explicit constexpr deque_block_cache(size_type, const Allocator & = {});
+    deque_block_cache(const deque_block_cache &) = delete;
+    deque_block_cache(deque_block_cache &&) = delete;
+    constexpr ~deque_block_cache() noexcept;
+public:
+    deque_block_cache &operator=(const deque_block_cache &) = delete;
+    deque_block_cache &operator=(deque_block_cache &&) = delete;
+public:
+    [[nodiscard]]
+    constexpr size_type size() const noexcept;
+    [[nodiscard]]
+    constexpr bool empty() const noexcept;
+    [[nodiscard]]
+    constexpr size_type high_water_mark() const noexcept;
+    [[nodiscard]]
+    constexpr Allocator allocator() const noexcept;
+    // returns nullptr if the cache is empty
+    [[nodiscard]]
+    constexpr T *acquire() noexcept;
+    // returns false if the cache is full, then the block should be deallocated by the caller
+    [[nodiscard]]
+    constexpr bool release(T *) noexcept;
+    constexpr void clear() noexcept;
+};
+__DATA_STRUCTURE_END(deque block cache declaration)
+
+__DATA_STRUCTURE_START(deque block cache implementation)
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque_block_cache<T, Allocator, BlockSize>::deque_block_cache(size_type high_water_mark,
+        const Allocator &allocator) : blocks {}, block_count(0, __dsa::rebind_allocator<list_allocator>(allocator)),
+        limit {high_water_mark, allocator} {
+    this->blocks = this->block_count.allocator().allocate(high_water_mark);
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque_block_cache<T, Allocator, BlockSize>::~deque_block_cache() noexcept {
+    this->clear();
+    this->block_count.allocator().deallocate(this->blocks, this->limit());
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque_block_cache<T, Allocator, BlockSize>::size_type
+deque_block_cache<T, Allocator, BlockSize>::size() const noexcept {
+    return this->block_count();
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr bool deque_block_cache<T, Allocator, BlockSize>::empty() const noexcept {
+    return this->block_count() == 0;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque_block_cache<T, Allocator, BlockSize>::size_type
+deque_block_cache<T, Allocator, BlockSize>::high_water_mark() const noexcept {
+    return this->limit();
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr Allocator deque_block_cache<T, Allocator, BlockSize>::allocator() const noexcept {
+    return this->limit.allocator();
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr T *deque_block_cache<T, Allocator, BlockSize>::acquire() noexcept {
+    auto &count {this->block_count()};
+    return count == 0 ? nullptr : this->blocks[--count];
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr bool deque_block_cache<T, Allocator, BlockSize>::release(T *block) noexcept {
+    auto &count {this->block_count()};
+    if(count == this->limit()) {
+        return false;
+    }
+    this->blocks[count++] = block;
+    return true;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque_block_cache<T, Allocator, BlockSize>::clear() noexcept {
+    auto &count {this->block_count()};
+    auto &allocator {this->limit.allocator()};
+    while(count not_eq 0) {
+        allocator.deallocate(this->blocks[--count], deque_block_cache::block_size);
+    }
+}
+__DATA_STRUCTURE_END(deque block cache implementation)
+
 __DATA_STRUCTURE_START(deque declaration)
-template <typename T, typename Allocator = allocator<T>>
+template <typename T, typename Allocator = allocator<T>, size_t BlockSize = __dsa::deque_default_block_size<T>>
 class deque {
 public:
     using allocator_type = Allocator;
@@ -37,25 +152,46 @@ public:
     using rvalue_reference = typename allocator_traits<Allocator>::rvalue_reference;
     using pointer = typename allocator_traits<Allocator>::pointer;
     using const_pointer = typename allocator_traits<Allocator>::const_pointer;
-    using iterator = __dsa::deque_iterator<T>;
-    using const_iterator = __dsa::deque_iterator<T, true>;
-    using reverse_iterator = reverse_iterator<iterator>;
+    using iterator = __dsa::deque_iterator<T, false, BlockSize>;
+    using const_iterator = __dsa::deque_iterator<T, true, BlockSize>;
+    using reverse_iterator = ds::reverse_iterator<iterator>;
     using const_reverse_iterator = ds::reverse_iterator<const_iterator>;
     static_assert(is_same_v<T, typename Allocator::value_type>,
             "The value type of deque should be same as the allocator's value_type!");
+    static_assert(BlockSize > 0, "The block size of deque should be positive!");
 private:
     using map_allocator = typename allocator_traits<Allocator>::template rebind<T *>;
     template <bool>
     struct map_allocation_handler;
     struct construction_handler;
 public:
-    static constexpr auto block_size {sizeof(T) < 256 ? 4096 / sizeof(T) : 16};
+    using block_cache = deque_block_cache<T, Allocator, BlockSize>;
+    static constexpr auto block_size {BlockSize};
+    static constexpr size_type default_high_water_mark {2};
 private:
-    T **map;
+    T **map {};
     __dsa::allocator_compressor<size_type, map_allocator> map_size;
-    size_type first;
+    size_type first {};
     __dsa::allocator_compressor<size_type, Allocator> element_size;
+    size_type spare_limit {deque::default_high_water_mark};
+    block_cache *cache {};
 private:
+    [[nodiscard]]
+    constexpr T *acquire_block();
+    template <bool ToCache = true>
+    constexpr void release_block(T *) noexcept;
+    [[nodiscard]]
+    constexpr size_type front_spare_blocks() const noexcept;
+    [[nodiscard]]
+    constexpr size_type back_spare_blocks() const noexcept;
+    constexpr void recycle_front_block() noexcept;
+    constexpr void recycle_back_block() noexcept;
+    template <bool ToCache = true>
+    constexpr void release_front_blocks(size_type) noexcept;
+    template <bool ToCache = true>
+    constexpr void release_back_blocks(size_type) noexcept;
+    constexpr void release_excess_front_blocks() noexcept;
+    constexpr void release_excess_back_blocks() noexcept;
     template <bool, bool>
     constexpr void allocate_blocks(size_type n);
     template <typename ...Args>
@@ -70,7 +206,7 @@ public:
     constexpr deque() noexcept(is_nothrow_copy_constructible_v<Allocator> and
             is_nothrow_default_constructible_v<map_allocator>) = default;
     explicit constexpr deque(const Allocator &) noexcept(is_nothrow_copy_constructible_v<Allocator> and
-            is_nothrow_default_constructible_v<map_allocator>);
+            noexcept(__dsa::rebind_allocator<map_allocator>(declval<const Allocator &>())));
     explicit constexpr deque(size_type, const Allocator & = {});
     constexpr deque(size_type, const_reference, const Allocator & = {});
     template <IsInputIterator InputIterator>
@@ -131,6 +267,14 @@ public:
     constexpr void reserve_back(size_type);
     constexpr void reserve_front(size_type);
     constexpr void shrink_to_fit();
+    [[nodiscard]]
+    constexpr size_type spare_blocks() const noexcept;
+    [[nodiscard]]
+    constexpr size_type high_water_mark() const noexcept;
+    constexpr void set_high_water_mark(size_type) noexcept;
+    [[nodiscard]]
+    constexpr block_cache *shared_block_cache() const noexcept;
+    constexpr void share_block_cache(block_cache *) noexcept;
     constexpr void resize(size_type);
     constexpr void resize(size_type, const_reference);
     [[nodiscard]]
@@ -169,6 +313,10 @@ public:
     constexpr iterator insert(const_iterator, InputIterator, InputIterator);
     constexpr iterator insert(size_type, initializer_list<T>);
     constexpr iterator insert(const_iterator, initializer_list<T>);
+    template <IsRange Range>
+    constexpr void append_range(Range &&);
+    constexpr void splice_back(deque &, size_type);
+    constexpr void splice_back(deque &);
     constexpr iterator erase(size_type, size_type = 1);
     constexpr iterator erase(const_iterator, size_type);
     constexpr iterator erase(const_iterator);
@@ -178,295 +326,385 @@ __DATA_STRUCTURE_END(deque declaration)
 
 __DATA_STRUCTURE_START(deque implementation)
 /* exception handlers */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <bool AppendToTail>
-struct deque<T, Allocator>::map_allocation_handler {
-    T **map;
-    size_type map_size;
+struct deque<T, Allocator, BlockSize>::map_allocation_handler {
+    deque &d;
+    T **new_map;
+    size_type append_size;
     size_type i {0};
-    Allocator &allocator;
-    typename allocator_traits<Allocator>::template rebind<T *> &map_allocator;
-    constexpr map_allocation_handler(T **map, size_type map_size, Allocator &allocator,
-            typename allocator_traits<Allocator>::template rebind<T *> &map_allocator) :
-            map {map}, map_size {map_size}, allocator {allocator}, map_allocator {map_allocator} {}
-    constexpr void operator()() const noexcept {
+    constexpr map_allocation_handler(deque &d, T **new_map, size_type append_size) noexcept :
+            d {d}, new_map {new_map}, append_size {append_size} {}
+    constexpr void operator()() noexcept {
+        const auto map_size {this->d.map_size()};
+        const auto offset {AppendToTail ? map_size : 0};
         while(this->i not_eq 0) {
-            if constexpr(AppendToTail) {
-                this->allocator.deallocate(this->map[this->map_size - (this->i + 1)], deque::block_size);
-            }else {
-                this->allocator.deallocate(this->map[this->i], deque::block_size);
+            this->d.release_block(this->new_map[offset + --this->i]);
+        }
+        if(this->new_map == this->d.map) {
+            if constexpr(not AppendToTail) {
+                ds::memory_move(this->d.map, this->d.map + this->append_size, sizeof(T *) * map_size);
             }
-            --this->i;
+        }else {
+            this->d.map_size.allocator().deallocate(this->new_map, map_size + this->append_size);
         }
-        this->map_allocator.deallocate(this->map, this->map_size);
     }
 };
-template <typename T, typename Allocator>
-struct deque<T, Allocator>::construction_handler {
+template <typename T, typename Allocator, size_t BlockSize>
+struct deque<T, Allocator, BlockSize>::construction_handler {
     T *const *map;
-    size_type from;
-    size_type i {0};
+    size_type from;     // the offset in the first block
+    size_type i {0};    // the count of constructed elements
     constexpr void operator()() noexcept {
-        if(this->i - this->from <= deque::block_size) {
-            const auto start_from {*this->map + this->from};
-            ds::destroy(start_from, start_from + this->i);
-        }else {
-            ds::destroy(*this->map + this->from, *this->map + deque::block_size);
-            ++this->map;
-            this->from += deque::block_size - this->from % deque::block_size;
-            while(this->i - this->from > deque::block_size) {
-                ds::destroy(*this->map, *this->map + deque::block_size);
-                ++this->map;
-                this->from += deque::block_size;
-            }
-            if(const auto remaining {this->i - this->from}; remaining > 0) {
-                ds::destroy(*this->map, *this->map + remaining);
-            }
+        for(auto offset {this->from}; this->i not_eq 0; offset = 0, static_cast<void>(++this->map)) {
+            const auto block_remaining {deque::block_size - offset};
+            const auto n {this->i < block_remaining ? this->i : block_remaining};
+            ds::destroy(*this->map + offset, *this->map + (offset + n));
+            this->i -= n;
         }
     }
 };
 
 /* private functions */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr T *deque<T, Allocator, BlockSize>::acquire_block() {
+    if(this->cache) {
+        if(const auto block {this->cache->acquire()}; block) {
+            return block;
+        }
+    }
+    return this->element_size.allocator().allocate(deque::block_size);
+}
+template <typename T, typename Allocator, size_t BlockSize>
+template <bool ToCache>
+constexpr void deque<T, Allocator, BlockSize>::release_block(T *block) noexcept {
+    if constexpr(ToCache) {
+        if(this->cache and this->cache->release(block)) {
+            return;
+        }
+    }
+    this->element_size.allocator().deallocate(block, deque::block_size);
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type
+deque<T, Allocator, BlockSize>::front_spare_blocks() const noexcept {
+    return this->first / deque::block_size;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type
+deque<T, Allocator, BlockSize>::back_spare_blocks() const noexcept {
+    // the block which end() points to is not spare
+    const auto map_size {this->map_size()};
+    return map_size == 0 ? 0 : map_size - 1 - (this->first + this->element_size()) / deque::block_size;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::recycle_front_block() noexcept {
+    // the spare block at the head is moved to the tail, so no block is allocated for the queue traffic
+    const auto map_size {this->map_size()};
+    const auto block {this->map[0]};
+    ds::memory_move(this->map, this->map + 1, sizeof(T *) * (map_size - 1));
+    this->map[map_size - 1] = block;
+    this->first -= deque::block_size;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::recycle_back_block() noexcept {
+    const auto map_size {this->map_size()};
+    const auto block {this->map[map_size - 1]};
+    ds::memory_move(this->map + 1, this->map, sizeof(T *) * (map_size - 1));
+    this->map[0] = block;
+    this->first += deque::block_size;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+template <bool ToCache>
+constexpr void deque<T, Allocator, BlockSize>::release_front_blocks(size_type n) noexcept {
+    if(n == 0) {
+        return;
+    }
+    for(auto i {0uz}; i < n; ++i) {
+        this->release_block<ToCache>(this->map[i]);
+    }
+    auto &map_size {this->map_size()};
+    map_size -= n;
+    ds::memory_move(this->map, this->map + n, sizeof(T *) * map_size);
+    this->first -= deque::block_size * n;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+template <bool ToCache>
+constexpr void deque<T, Allocator, BlockSize>::release_back_blocks(size_type n) noexcept {
+    auto &map_size {this->map_size()};
+    for(; n not_eq 0; --n) {
+        this->release_block<ToCache>(this->map[--map_size]);
+    }
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::release_excess_front_blocks() noexcept {
+    if(const auto spare_blocks {this->spare_blocks()}; spare_blocks > this->spare_limit) {
+        const auto front_spare_blocks {this->front_spare_blocks()};
+        const auto excess {spare_blocks - this->spare_limit};
+        this->release_front_blocks(excess < front_spare_blocks ? excess : front_spare_blocks);
+    }
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::release_excess_back_blocks() noexcept {
+    if(const auto spare_blocks {this->spare_blocks()}; spare_blocks > this->spare_limit) {
+        const auto back_spare_blocks {this->back_spare_blocks()};
+        const auto excess {spare_blocks - this->spare_limit};
+        this->release_back_blocks(excess < back_spare_blocks ? excess : back_spare_blocks);
+    }
+}
+template <typename T, typename Allocator, size_t BlockSize>
 template <bool AppendToTail, bool FromConstructor>
-constexpr void deque<T, Allocator>::allocate_blocks(size_type n) {
+constexpr void deque<T, Allocator, BlockSize>::allocate_blocks(size_type n) {
+    // one more block is appended to the tail, so that the block which end() points to is always allocated
     const auto offset_in_block {n % deque::block_size};
-    const auto append_size {n / deque::block_size + (offset_in_block == 0 ? 0 : 1)};
-    auto &map_size {this->map_size()};
-    const auto allocation_size {append_size + this->map_size()};
+    const auto append_size {n / deque::block_size + (AppendToTail or offset_in_block not_eq 0 ? 1 : 0)};
+    const auto map_size {this->map_size()};
+    // bounds the size of the map, so that neither the allocation nor the copy of the map overflows
+    constexpr auto max_map_size {(static_cast<size_type>(-1) >> 1) / sizeof(T *)};
+    if(map_size > max_map_size or append_size > max_map_size - map_size) {
+        throw std::length_error {"ds::deque : the map of blocks is too large!"};
+    }
+    const auto allocation_size {append_size + map_size};
     auto &map_allocator {this->map_size.allocator()};
-    const auto new_map {map_allocator.allocate(allocation_size)};
-    if constexpr(not FromConstructor) {
-        if constexpr(AppendToTail) {
-            ds::memory_set(new_map, this->map, this->map_size() * sizeof(T **));
-        }else {
-            ds::memory_set(new_map + append_size, this->map, this->map_size() * sizeof(T **));
+    auto new_map {this->map};
+    if(FromConstructor or not __dsa::try_expand(map_allocator, this->map, allocation_size)) {
+        new_map = map_allocator.allocate(allocation_size);
+        if constexpr(not FromConstructor) {
+            if(map_size not_eq 0) {
+                ds::memory_copy(AppendToTail ? new_map : new_map + append_size, this->map, sizeof(T *) * map_size);
+            }
         }
+    }else if constexpr(not AppendToTail) {
+        ds::memory_move(new_map + append_size, new_map, sizeof(T *) * map_size);
     }
-    auto &allocator {this->element_size.allocator()};
-    auto trans {transaction {map_allocation_handler<AppendToTail>(new_map, allocation_size, allocator,
-            this->map_size.allocator())}};
+    auto trans {transaction {map_allocation_handler<AppendToTail>(*this, new_map, append_size)}};
+    const auto offset {AppendToTail ? map_size : 0};
     for(auto &i {trans.get_rollback().i}; i < append_size; ++i) {
-        if constexpr(FromConstructor or not AppendToTail) {
-            this->map[i] = allocator.allocate(deque::block_size);
-        }else {
-            this->map[map_size + i] = allocator.allocate(deque::block_size);
-        }
+        new_map[offset + i] = this->acquire_block();
     }
     trans.complete();
-    map_allocator.deallocate(this->map, map_size);
-    this->map = new_map;
-    this->map_size = allocation_size;
-    if constexpr(AppendToTail) {
+    if(new_map not_eq this->map) {
+        map_allocator.deallocate(this->map, map_size);
+        this->map = new_map;
+    }
+    this->map_size() = allocation_size;
+    if constexpr(not AppendToTail) {
         this->first += deque::block_size * append_size;
     }
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <typename ...Args>
-constexpr void deque<T, Allocator>::construct_with_value(size_type from, size_type to, Args &&...args)
+constexpr void deque<T, Allocator, BlockSize>::construct_with_value(size_type from, size_type to, Args &&...args)
         noexcept(is_nothrow_constructible_v<T, Args...>) {
     T *const *map {this->map + from / deque::block_size};
-    auto trans {transaction {construction_handler {map, from}}};
-    if(const auto first_block_end {(from / deque::block_size + 1) * deque::block_size}; to < first_block_end) {
-        from %= deque::block_size;
-        to %= deque::block_size;
-        while(from not_eq to) {
-            ds::construct(*map + from, ds::forward<Args>(args)...);
-        }
-        trans.complete();
-        return;
-    }else {
-        from %= deque::block_size;
-        while(from < deque::block_size) {
-            ds::construct(*map + from, ds::forward<Args>(args)...);
+    auto offset {from % deque::block_size};
+    auto trans {transaction {construction_handler {map, offset}}};
+    auto &i {trans.get_rollback().i};
+    for(auto n {to - from}; n not_eq 0; offset = 0, static_cast<void>(++map)) {
+        const auto block_remaining {deque::block_size - offset};
+        const auto block_n {n < block_remaining ? n : block_remaining};
+        for(auto cursor {*map + offset}, end {cursor + block_n}; cursor not_eq end; ++cursor, static_cast<void>(++i)) {
+            ds::construct(cursor, ds::forward<Args>(args)...);
         }
-        from = first_block_end;
-    }
-    ++map;
-    while(to - from > deque::block_size) {
-        for(auto i {0}; i < deque::block_size; ++i) {
-            ds::construct(*map + i, ds::forward<Args>(args)...);
-        }
-        from += deque::block_size;
-        ++map;
-    }
-    if(from not_eq to) {
-        to %= deque::block_size;
-        size_type i {0};
-        do {
-            ds::construct(*map + i, ds::forward<Args>(args)...);
-            ++i;
-        }while(i not_eq to);
+        n -= block_n;
     }
     trans.complete();
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <IsInputIterator InputIterator>
-constexpr void deque<T, Allocator>::construct_with_range(size_type from, size_type to, InputIterator begin)
+constexpr void deque<T, Allocator, BlockSize>::construct_with_range(size_type from, size_type to, InputIterator begin)
         noexcept(is_nothrow_constructible_v<T, typename iterator_traits<InputIterator>::reference>) {
     T *const *map {this->map + from / deque::block_size};
-    auto trans {transaction {construction_handler {map, from}}};
-    if(const auto first_block_end {(from / deque::block_size + 1) * deque::block_size}; to < first_block_end) {
-        from %= deque::block_size;
-        to %= deque::block_size;
-        while(from not_eq to) {
-            ds::construct(*map + from, ds::move_if<not is_forward_iterator_v<InputIterator>>(*begin++));
-        }
-        trans.complete();
-        return;
-    }else {
-        from %= deque::block_size;
-        while(from < deque::block_size) {
-            ds::construct(*map + from, ds::move_if<not is_forward_iterator_v<InputIterator>>(*begin++));
-        }
-        from = first_block_end;
-    }
-    ++map;
-    while(to - from > deque::block_size) {
-        for(auto i {0}; i < deque::block_size; ++i) {
-            ds::construct(*map + i, ds::move_if<not is_forward_iterator_v<InputIterator>>(*begin++));
+    auto offset {from % deque::block_size};
+    auto trans {transaction {construction_handler {map, offset}}};
+    auto &i {trans.get_rollback().i};
+    for(auto n {to - from}; n not_eq 0; offset = 0, static_cast<void>(++map)) {
+        const auto block_remaining {deque::block_size - offset};
+        const auto block_n {n < block_remaining ? n : block_remaining};
+        if constexpr(is_contiguous_iterator_v<InputIterator> and is_trivially_copyable_v<T> and
+                is_lvalue_reference_v<decltype(*begin)> and is_same_v<remove_cvref_t<decltype(*begin)>, T>) {
+            // a block is contiguous, so the elements are copied block by block
+            ds::memory_copy(*map + offset, ds::address_of(*begin), sizeof(T) * block_n);
+            begin += static_cast<typename iterator_traits<InputIterator>::difference_type>(block_n);
+            i += block_n;
+        }else {
+            for(auto cursor {*map + offset}, end {cursor + block_n}; cursor not_eq end;
+                    ++cursor, static_cast<void>(++i)) {
+                ds::construct(cursor, ds::move_if<not is_forward_iterator_v<InputIterator>>(*begin++));
+            }
         }
-        from += deque::block_size;
-        ++map;
-    }
-    if(from not_eq to) {
-        to %= deque::block_size;
-        size_type i {0};
-        do {
-            ds::construct(*map + i, ds::move_if<not is_forward_iterator_v<InputIterator>>(*begin++));
-            ++i;
-        }while(i not_eq to);
+        n -= block_n;
     }
     trans.complete();
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::move_range(size_type from, size_type to, size_type destination)
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::move_range(size_type from, size_type to, size_type destination)
         noexcept(is_nothrow_move_assignable_v<T> or is_nothrow_copy_assignable_v<T>) {
+    // moves [from, to) to [destination, destination + (to - from)), the two ranges may overlap
+    if(from == to or from == destination) {
+        return;
+    }
+    auto n {to - from};
     if constexpr(is_trivially_copy_assignable_v<T>) {
-        auto start {this->begin() + from};
-        auto end {this->begin() + --to};
-        auto new_end {this->begin() + (destination + to - from)};
-        while(start not_eq end) {
-            const auto end_offset {static_cast<size_type>(end.map == start.map ?
-                    end.pos - start.pos : end.pos - *end.map) + 1};
-            const auto new_end_offset {static_cast<size_type>(new_end.pos - *new_end.map) + 1};
-            if(new_end_offset < end_offset) {
-                ds::memory_move(*new_end.map, end.pos - (new_end_offset - 1), new_end_offset * sizeof(T));
-                end -= new_end_offset;
-                new_end -= new_end_offset;
-            }else {
-                ds::memory_move(new_end.pos - (end_offset - 1), *end.map, end_offset * sizeof(T));
-                end -= end_offset;
-                new_end -= end_offset;
+        const auto address {[this](size_type i) noexcept {
+            const auto absolute {this->first + i};
+            return this->map[absolute / deque::block_size] + absolute % deque::block_size;
+        }};
+        const auto room {[this](size_type i) noexcept {
+            return deque::block_size - (this->first + i) % deque::block_size;
+        }};
+        if(destination < from) {
+            while(n not_eq 0) {
+                auto chunk {n < room(from) ? n : room(from)};
+                chunk = chunk < room(destination) ? chunk : room(destination);
+                ds::memory_move(address(destination), address(from), sizeof(T) * chunk);
+                from += chunk;
+                destination += chunk;
+                n -= chunk;
+            }
+        }else {
+            auto destination_end {destination + n};
+            while(n not_eq 0) {
+                // the count of the elements before the end in the same block
+                const auto source_room {deque::block_size - room(to - 1) + 1};
+                const auto destination_room {deque::block_size - room(destination_end - 1) + 1};
+                auto chunk {n < source_room ? n : source_room};
+                chunk = chunk < destination_room ? chunk : destination_room;
+                to -= chunk;
+                destination_end -= chunk;
+                n -= chunk;
+                ds::memory_move(address(destination_end), address(to), sizeof(T) * chunk);
             }
         }
     }else {
-        auto start {this->begin() + from};
-        auto end {this->begin() + --to};
-        auto new_end {this->begin() + (destination + to - from)};
-        while(start not_eq end) {
-            *new_end-- = ds::move(*end--);
+        if(destination < from) {
+            auto source {this->begin() + from};
+            auto target {this->begin() + destination};
+            for(; n not_eq 0; --n) {
+                *target = ds::move(*source);
+                ++target;
+                ++source;
+            }
+        }else {
+            auto source {this->begin() + to};
+            auto target {this->begin() + (destination + n)};
+            for(; n not_eq 0; --n) {
+                *--target = ds::move(*--source);
+            }
         }
     }
 }
 
 /* public functions */
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(const Allocator &allocator) noexcept(is_nothrow_copy_constructible_v<Allocator> and
-    is_nothrow_default_constructible_v<map_allocator>) : map {}, map_size {}, first {}, element_size(allocator) {}
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(size_type n, const Allocator &allocator) : deque(allocator) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(const Allocator &allocator)
+        noexcept(is_nothrow_copy_constructible_v<Allocator> and
+                noexcept(__dsa::rebind_allocator<map_allocator>(declval<const Allocator &>()))) :
+        map {}, map_size(0, __dsa::rebind_allocator<map_allocator>(allocator)), first {}, element_size(allocator) {}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(size_type n, const Allocator &allocator) : deque(allocator) {
     this->allocate_blocks<true, true>(n);
-    this->construct_with_value(0, n + 1);
+    this->construct_with_value(0, n);
     this->element_size() = n;
 }
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(size_type n, const_reference value, const Allocator &allocator) :
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(size_type n, const_reference value, const Allocator &allocator) :
         deque(allocator) {
     this->allocate_blocks<true, true>(n);
-    this->construct_with_value(0, n + 1, value);
+    this->construct_with_value(0, n, value);
     this->element_size() = n;
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <IsInputIterator InputIterator>
-constexpr deque<T, Allocator>::deque(InputIterator begin, InputIterator end, const Allocator &allocator) :
+constexpr deque<T, Allocator, BlockSize>::deque(InputIterator begin, InputIterator end, const Allocator &allocator) :
         deque(allocator) {
     const auto n {static_cast<size_type>(ds::distance(begin, end))};
     this->allocate_blocks<true, true>(n);
-    this->construct_with_range(0, n + 1, begin);
+    this->construct_with_range(0, n, begin);
     this->element_size() = n;
 }
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(initializer_list<T> init_list, const Allocator &allocator) :
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(initializer_list<T> init_list, const Allocator &allocator) :
         deque(init_list.begin(), init_list.end(), allocator) {}
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(const deque &rhs) : deque(rhs.cbegin(), rhs.cend(), rhs.allocator()) {}
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(const deque &rhs, const Allocator &allocator) :
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(const deque &rhs) : deque(rhs.cbegin(), rhs.cend(), rhs.allocator()) {
+    // the cache is shared by the owner of the cache explicitly, so the copy only keeps the high-water mark
+    this->spare_limit = rhs.spare_limit;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(const deque &rhs, const Allocator &allocator) :
         deque(rhs.cbegin(), rhs.cend(), allocator) {}
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(deque &&rhs) noexcept : map {ds::move(rhs.map)}, map_size {ds::move(rhs.map_size)},
-        first {ds::move(rhs.first)}, element_size {ds::move(rhs.element_size)} {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(deque &&rhs) noexcept : map {ds::move(rhs.map)},
+        map_size {ds::move(rhs.map_size)}, first {ds::move(rhs.first)}, element_size {ds::move(rhs.element_size)},
+        spare_limit {rhs.spare_limit}, cache {rhs.cache} {
     rhs.map = nullptr;
     rhs.map_size() = 0;
     rhs.first = 0;
     rhs.element_size() = 0;
 }
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::deque(deque &&rhs, const Allocator &allocator)
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::deque(deque &&rhs, const Allocator &allocator)
         noexcept(is_nothrow_copy_constructible_v<Allocator>) : map {ds::move(rhs.map)},
         map_size {ds::move(rhs.map_size)}, first {ds::move(rhs.first)},
-        element_size(ds::move(rhs.element_size()), allocator) {
+        element_size(ds::move(rhs.element_size()), allocator), spare_limit {rhs.spare_limit}, cache {rhs.cache} {
     rhs.map = nullptr;
     rhs.map_size() = 0;
     rhs.first = 0;
     rhs.element_size() = 0;
 }
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator>::~deque() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize>::~deque() noexcept {
     const auto end {this->end()};
     for(auto it {this->begin()}; it not_eq end; ++it) {
         ds::destroy(ds::address_of(*it));
     }
-    auto &allocator {this->element_size.allocator()};
-    for(auto i {0}; i < this->map_size(); ++i) {
-        allocator.deallocate(this->map[i]);
+    for(auto i {0uz}; i < this->map_size(); ++i) {
+        this->release_block(this->map[i]);
     }
     this->map_size.allocator().deallocate(this->map);
 }
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator> &deque<T, Allocator>::operator=(const deque &rhs) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize> &deque<T, Allocator, BlockSize>::operator=(const deque &rhs) {
     if(&rhs not_eq this) {
         this->assign(rhs.begin(), rhs.end());
     }
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator> &deque<T, Allocator>::operator=(deque &&rhs) noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize> &deque<T, Allocator, BlockSize>::operator=(deque &&rhs) noexcept {
     if(&rhs not_eq this) {
         this->~deque();
         this->map = rhs.map;
         this->map_size = ds::move(rhs.map_size);
         this->first = ds::move(rhs.first);
         this->element_size = ds::move(rhs.element_size);
+        this->spare_limit = rhs.spare_limit;
+        this->cache = rhs.cache;
+        rhs.map = nullptr;
+        rhs.map_size() = 0;
+        rhs.first = 0;
+        rhs.element_size() = 0;
     }
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr deque<T, Allocator> &deque<T, Allocator>::operator=(initializer_list<T> init_list) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr deque<T, Allocator, BlockSize> &deque<T, Allocator, BlockSize>::operator=(initializer_list<T> init_list) {
     this->assign(init_list.begin(), init_list.end());
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::reference deque<T, Allocator>::operator[](size_type i) noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::reference
+deque<T, Allocator, BlockSize>::operator[](size_type i) noexcept {
     return *(this->begin() + i);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_reference deque<T, Allocator>::operator[](size_type i) const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_reference
+deque<T, Allocator, BlockSize>::operator[](size_type i) const noexcept {
     return *(this->cbegin() + i);
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::assign(size_type n, const_reference value) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::assign(size_type n, const_reference value) {
     auto it {this->begin()};
     const auto end {this->end()};
     size_type i {0};
@@ -494,9 +732,9 @@ constexpr void deque<T, Allocator>::assign(size_type n, const_reference value) {
     this->allocate_blocks<true, false>(remaining);
     this->construct_with_range(size, size + remaining, value);
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <IsInputIterator InputIterator>
-constexpr void deque<T, Allocator>::assign(InputIterator begin, InputIterator end) {
+constexpr void deque<T, Allocator, BlockSize>::assign(InputIterator begin, InputIterator end) {
     const auto n {ds::distance(begin, end)};
     auto it {this->begin()};
     const auto this_end {this->end()};
@@ -520,131 +758,187 @@ constexpr void deque<T, Allocator>::assign(InputIterator begin, InputIterator en
     this->allocate_blocks<true, false>(remaining);
     this->construct_with_range(size, size + remaining, begin);
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::assign(initializer_list<T> init_list) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::assign(initializer_list<T> init_list) {
     this->assign(init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::begin() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator deque<T, Allocator, BlockSize>::begin() noexcept {
+    if(not this->map) {
+        return {};
+    }
     const auto map {this->map + this->first / deque::block_size};
     return iterator(map, *map + this->first % deque::block_size);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_iterator deque<T, Allocator>::begin() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_iterator
+deque<T, Allocator, BlockSize>::begin() const noexcept {
+    if(not this->map) {
+        return {};
+    }
     const auto map {this->map + this->first / deque::block_size};
     return const_iterator(map, *map + this->first % deque::block_size);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_iterator deque<T, Allocator>::cbegin() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_iterator
+deque<T, Allocator, BlockSize>::cbegin() const noexcept {
     return this->begin();
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::end() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator deque<T, Allocator, BlockSize>::end() noexcept {
+    if(not this->map) {
+        return {};
+    }
     const auto last {this->first + this->element_size()};
     const auto map {this->map + last / deque::block_size};
     return iterator(map, *map + last % deque::block_size);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_iterator deque<T, Allocator>::end() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_iterator deque<T, Allocator, BlockSize>::end() const noexcept {
+    if(not this->map) {
+        return {};
+    }
     const auto last {this->first + this->element_size()};
     const auto map {this->map + last / deque::block_size};
     return const_iterator(map, *map + last % deque::block_size);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_iterator deque<T, Allocator>::cend() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_iterator
+deque<T, Allocator, BlockSize>::cend() const noexcept {
     return this->end();
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::reverse_iterator deque<T, Allocator>::rbegin() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::reverse_iterator deque<T, Allocator, BlockSize>::rbegin() noexcept {
     return reverse_iterator {this->begin()};
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::rbegin() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_reverse_iterator
+deque<T, Allocator, BlockSize>::rbegin() const noexcept {
     return const_reverse_iterator {this->begin()};
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::crbegin() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_reverse_iterator
+deque<T, Allocator, BlockSize>::crbegin() const noexcept {
     return const_reverse_iterator {this->begin()};
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::reverse_iterator deque<T, Allocator>::rend() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::reverse_iterator deque<T, Allocator, BlockSize>::rend() noexcept {
     return reverse_iterator {this->end()};
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::rend() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_reverse_iterator
+deque<T, Allocator, BlockSize>::rend() const noexcept {
     return const_reverse_iterator {this->end()};
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::crend() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_reverse_iterator
+deque<T, Allocator, BlockSize>::crend() const noexcept {
     return const_reverse_iterator {this->end()};
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::size_type deque<T, Allocator>::size() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type deque<T, Allocator, BlockSize>::size() const noexcept {
     return this->element_size();
 }
-template <typename T, typename Allocator>
-constexpr bool deque<T, Allocator>::empty() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr bool deque<T, Allocator, BlockSize>::empty() const noexcept {
     return this->element_size() == 0;
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::size_type deque<T, Allocator>::capacity() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type deque<T, Allocator, BlockSize>::capacity() const noexcept {
     return this->map_size() * deque::block_size;
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::size_type deque<T, Allocator>::front_spare() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type
+deque<T, Allocator, BlockSize>::front_spare() const noexcept {
     return this->first;
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::size_type deque<T, Allocator>::back_spare() const noexcept {
-    return this->capacity() - this->element_size();
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type
+deque<T, Allocator, BlockSize>::back_spare() const noexcept {
+    return this->capacity() - this->first - this->element_size();
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::size_type deque<T, Allocator>::spare() const noexcept {
-    return this->first + this->capacity() - this->element_size();
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type deque<T, Allocator, BlockSize>::spare() const noexcept {
+    return this->capacity() - this->element_size();
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::reserve_back(size_type n) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::reserve_back(size_type n) {
     const auto back_spare {this->back_spare()};
-    if(n <= back_spare) {
+    if(n < back_spare) {
         return;
     }
     this->allocate_blocks<true, false>(n - back_spare);
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::reserve_front(size_type n) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::reserve_front(size_type n) {
     const auto front_spare {this->front_spare()};
     if(n <= front_spare) {
         return;
     }
+    if(this->map_size() == 0) {
+        this->allocate_blocks<true, false>(0);
+    }
     this->allocate_blocks<false, false>(n - front_spare);
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::shrink_to_fit() {
-    const auto block_from {this->first / deque::block_size};
-    const auto block_to {this->element_size() / deque::block_size};
-    if(block_from == 0 and block_to == this->map_size()) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::shrink_to_fit() {
+    // the spare blocks are deallocated rather than given to the shared cache
+    const auto map_size {this->map_size()};
+    auto &map_allocator {this->map_size.allocator()};
+    if(this->element_size() == 0) {
+        this->release_back_blocks<false>(map_size);
+        map_allocator.deallocate(this->map, map_size);
+        this->map = nullptr;
+        this->first = 0;
         return;
     }
-    const auto new_size {block_to - block_from};
-    auto &map_allocator {this->map_size.allocator()};
-    const auto new_map {map_allocator.allocate(new_size)};
-    ds::memory_copy(new_map, this->map + block_from, new_size);
-    auto &block_allocator {this->element_size.allocator()};
-    for(auto i {0}; i <= block_from; ++i) {
-        block_allocator.deallocate(this->map[i]);
+    const auto front_spare_blocks {this->front_spare_blocks()};
+    const auto new_size {map_size - front_spare_blocks - this->back_spare_blocks()};
+    if(new_size == map_size) {
+        return;
     }
-    for(auto i {block_to}; i < this->map_size(); ++i) {
-        block_allocator.deallocate(this->map[i]);
+    const auto new_map {map_allocator.allocate(new_size)};
+    ds::memory_copy(new_map, this->map + front_spare_blocks, sizeof(T *) * new_size);
+    this->release_back_blocks<false>(map_size - front_spare_blocks - new_size);
+    for(auto i {0uz}; i < front_spare_blocks; ++i) {
+        this->release_block<false>(this->map[i]);
     }
-    map_allocator.deallocate(this->map);
+    map_allocator.deallocate(this->map, map_size);
     this->map = new_map;
-}
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::resize(size_type n) {
+    this->map_size() = new_size;
+    this->first -= deque::block_size * front_spare_blocks;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type
+deque<T, Allocator, BlockSize>::spare_blocks() const noexcept {
+    return this->front_spare_blocks() + this->back_spare_blocks();
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::size_type
+deque<T, Allocator, BlockSize>::high_water_mark() const noexcept {
+    return this->spare_limit;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::set_high_water_mark(size_type n) noexcept {
+    this->spare_limit = n;
+    this->release_excess_back_blocks();
+    this->release_excess_front_blocks();
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::block_cache *
+deque<T, Allocator, BlockSize>::shared_block_cache() const noexcept {
+    return this->cache;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::share_block_cache(block_cache *cache) noexcept {
+    this->cache = cache;
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::resize(size_type n) {
     this->resize(n, {});
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::resize(size_type n, const_reference value) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::resize(size_type n, const_reference value) {
     auto &size {this->element_size()};
     if(n < size) {
         const auto end {this->end()};
@@ -653,252 +947,411 @@ constexpr void deque<T, Allocator>::resize(size_type n, const_reference value) {
         }
     }else if(n > size) {
         const auto insertion_size {n - this->size()};
-        if(const auto back_spare {this->back_spare()}; back_spare < insertion_size) {
+        if(const auto back_spare {this->back_spare()}; back_spare <= insertion_size) {
             this->allocate_blocks<true, false>(insertion_size - back_spare);
         }
-        this->construct_with_value(size, n, value);
+        this->construct_with_value(this->first + size, this->first + n, value);
     }
     size = n;
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::reference deque<T, Allocator>::front() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::reference deque<T, Allocator, BlockSize>::front() noexcept {
     return *this->begin();
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_reference deque<T, Allocator>::front() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_reference
+deque<T, Allocator, BlockSize>::front() const noexcept {
     return *this->begin();
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::reference deque<T, Allocator>::back() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::reference deque<T, Allocator, BlockSize>::back() noexcept {
     return *(this->end() - 1);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::const_reference deque<T, Allocator>::back() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::const_reference
+deque<T, Allocator, BlockSize>::back() const noexcept {
     return *(this->end() - 1);
 }
-template <typename T, typename Allocator>
-constexpr Allocator deque<T, Allocator>::allocator() const noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr Allocator deque<T, Allocator, BlockSize>::allocator() const noexcept {
     return this->element_size.allocator();
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::push_back(const_reference value) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::push_back(const_reference value) {
     this->emplace_back(value);
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::push_back(rvalue_reference value) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::push_back(rvalue_reference value) {
     this->emplace_back(ds::move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <typename ...Args>
-constexpr void deque<T, Allocator>::emplace_back(Args &&...args) {
+constexpr void deque<T, Allocator, BlockSize>::emplace_back(Args &&...args) {
     auto &size {this->element_size()};
-    if(size == this->capacity()) {
-        this->allocate_blocks<true, false>(1);
+    if(this->back_spare() <= 1) {
+        if(this->front_spare_blocks() not_eq 0) {
+            this->recycle_front_block();
+        }else {
+            this->allocate_blocks<true, false>(1);
+        }
     }
-    this->construct_with_value(size, size + 1, ds::forward<Args>(args)...);
+    const auto last {this->first + size};
+    this->construct_with_value(last, last + 1, ds::forward<Args>(args)...);
     ++size;
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::push_front(const_reference value) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::push_front(const_reference value) {
     this->emplace_front(value);
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::push_front(rvalue_reference value) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::push_front(rvalue_reference value) {
     this->emplace_front(ds::move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <typename ...Args>
-constexpr void deque<T, Allocator>::emplace_front(Args &&...args) {
+constexpr void deque<T, Allocator, BlockSize>::emplace_front(Args &&...args) {
     if(this->first == 0) {
-        this->allocate_blocks<false, false>(1);
+        if(this->back_spare_blocks() not_eq 0) {
+            this->recycle_back_block();
+        }else {
+            this->reserve_front(1);
+        }
     }
     this->construct_with_value(this->first - 1, this->first, ds::forward<Args>(args)...);
     --this->first;
+    ++this->element_size();
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::pop_back() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::pop_back() noexcept {
     ds::destroy(ds::address_of(*(this->end() - 1)));
-    --this->element_size();
+    const auto size {--this->element_size()};
+    // a block is emptied, the spare blocks beyond the high-water mark are released
+    if((this->first + size + 1) % deque::block_size == 0) {
+        this->release_excess_back_blocks();
+    }
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::pop_front() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::pop_front() noexcept {
     ds::destroy(ds::address_of(*this->begin()));
     ++this->first;
+    --this->element_size();
+    if(this->first % deque::block_size == 0) {
+        this->release_excess_front_blocks();
+    }
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::clear() noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::clear() noexcept {
     const auto end {this->end()};
     for(auto it {this->begin()}; it not_eq end;) {
         ds::destroy(ds::address_of(*it++));
     }
     this->element_size() = 0;
 }
-template <typename T, typename Allocator>
-constexpr void deque<T, Allocator>::swap(deque &rhs) noexcept {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::swap(deque &rhs) noexcept {
     using ds::swap;
     ds::swap(this->map, rhs.map);
     ds::swap(this->map_size, rhs.map_size);
     ds::swap(this->first, rhs.first);
     ds::swap(this->element_size, rhs.element_size);
+    ds::swap(this->spare_limit, rhs.spare_limit);
+    ds::swap(this->cache, rhs.cache);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(size_type pos, const_reference value,
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::insert(size_type pos, const_reference value,
         size_type n) {
     if(n == 0) {
         return this->begin() + pos;
     }
-    if(const auto back_spare {this->back_spare()}; back_spare < n) {
-        this->allocate_blocks<true, false>(back_spare - n);
-    }
-    const auto result {this->begin() + pos};
+    this->reserve_back(n);
     auto &size {this->element_size()};
-    const auto tail_size {size - pos};
+    const auto old_size {size};
+    const auto tail_size {old_size - pos};
     if(tail_size < n) {
-        const auto overflowed_size {n - tail_size};
-        this->construct_with_value(size, size + overflowed_size, value);
-        size += overflowed_size;
-        this->construct_with_range(size, size + tail_size, move_iterator {result});
-        size += tail_size;
-        const auto end {result + n};
-        for(const auto it {result}; it != end;) {
-            *it++ = value;
+        // the copies which go past the old end are constructed first, then the tail is moved behind them
+        this->construct_with_value(this->first + old_size, this->first + pos + n, value);
+        size = pos + n;
+        this->construct_with_range(this->first + pos + n, this->first + old_size + n,
+                move_iterator {this->begin() + pos});
+        size = old_size + n;
+        for(auto it {this->begin() + pos}, end {this->begin() + old_size}; it not_eq end; ++it) {
+            *it = value;
         }
     }else {
-        this->construct_with_range(size, size + n, move_iterator {result});
-        const auto old_size {size};
+        // the last n elements are moved to the new slots, then the rest of the tail is shifted by n
+        this->construct_with_range(this->first + old_size, this->first + old_size + n,
+                move_iterator {this->begin() + (old_size - n)});
         size += n;
-        this->move_range(pos, old_size, pos + n);
-        const auto end {this->begin() + old_size};
-        for(auto it {result}; it not_eq end;) {
-            *it++ = value;
+        this->move_range(pos, old_size - n, pos + n);
+        for(auto it {this->begin() + pos}, end {it + n}; it not_eq end; ++it) {
+            *it = value;
         }
     }
-    return result;
+    return this->begin() + pos;
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos, const_reference value,
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::insert(const_iterator pos, const_reference value,
         size_type n) {
     return this->insert(pos - this->cbegin(), value, n);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(size_type pos, rvalue_reference value) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::insert(size_type pos, rvalue_reference value) {
     return this->emplace(pos, ds::move(value));
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos,
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator deque<T, Allocator, BlockSize>::insert(const_iterator pos,
     rvalue_reference value) {
     return this->emplace(pos - this->cbegin(), ds::move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <typename ...Args>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::emplace(size_type pos, Args &&...args) {
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::emplace(size_type pos, Args &&...args) {
     const auto old_size {this->element_size()};
     if(pos == old_size) {
         this->emplace_back(ds::forward<Args>(args)...);
         return this->begin() + pos;
     }
-    if(this->back_spare() == 0) {
-        this->allocate_blocks<true, false>(1);
-    }
-    ds::construct(ds::address_of(*this->end()), ds::forward<Args>(args)...);
-    ++this->element_size();
-    this->move_range(pos, old_size, pos + 1);
-    return this->begin() + pos;
+    auto value {T(ds::forward<Args>(args)...)};
+    this->emplace_back(ds::move(this->back()));
+    this->move_range(pos, old_size - 1, pos + 1);
+    auto result {this->begin() + pos};
+    *result = ds::move(value);
+    return result;
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <typename ...Args>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::emplace(const_iterator pos, Args &&...args) {
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::emplace(const_iterator pos, Args &&...args) {
     return this->emplace(pos - this->cbegin(), ds::forward<Args>(args)...);
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <IsInputIterator InputIterator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(size_type pos, InputIterator begin,
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::insert(size_type pos, InputIterator begin,
         InputIterator end) {
-    if(begin == end) {
-        return this->begin() + pos;
-    }
-    const auto n {static_cast<size_type>(ds::distance(begin, end))};
-    if(const auto back_spare {this->back_spare()}; back_spare < n) {
-        this->allocate_blocks<true, false>(back_spare - n);
-    }
-    const auto result {this->begin() + pos};
-    auto &size {this->element_size()};
-    const auto tail_size {size - pos};
-    if(tail_size < n) {
-        const auto overflowed_size {n - tail_size};
-        this->construct_with_value(size, size + overflowed_size, ds::advance(begin, tail_size));
-        size += overflowed_size;
-        this->construct_with_range(size, size + tail_size, move_iterator {result});
-        size += tail_size;
-        const auto end {result + n};
-        for(const auto it {result}; it != end;) {
-            *it++ = ds::move_if<not is_forward_iterator_v<InputIterator>>(*begin++);
+    if constexpr(not is_forward_iterator_v<InputIterator>) {
+        // the length of a single pass range is unknown, so the elements are inserted one by one
+        for(auto i {pos}; begin not_eq end; ++begin) {
+            this->emplace(i++, *begin);
         }
+        return this->begin() + pos;
     }else {
-        this->construct_with_range(size, size + n, move_iterator {result});
+        if(begin == end) {
+            return this->begin() + pos;
+        }
+        const auto n {static_cast<size_type>(ds::distance(begin, end))};
+        this->reserve_back(n);
+        auto &size {this->element_size()};
         const auto old_size {size};
-        size += n;
-        this->move_range(pos, old_size, pos + n);
-        const auto end {this->begin() + old_size};
-        for(auto it {result}; it not_eq end;) {
-            *it++ = ds::move_if<not is_forward_iterator_v<InputIterator>>(*begin++);;
+        const auto tail_size {old_size - pos};
+        if(tail_size < n) {
+            const auto middle {ds::advance(begin, static_cast<difference_type>(tail_size))};
+            this->construct_with_range(this->first + old_size, this->first + pos + n, middle);
+            size = pos + n;
+            this->construct_with_range(this->first + pos + n, this->first + old_size + n,
+                    move_iterator {this->begin() + pos});
+            size = old_size + n;
+            for(auto it {this->begin() + pos}; begin not_eq middle; ++it, static_cast<void>(++begin)) {
+                *it = *begin;
+            }
+        }else {
+            this->construct_with_range(this->first + old_size, this->first + old_size + n,
+                    move_iterator {this->begin() + (old_size - n)});
+            size += n;
+            this->move_range(pos, old_size - n, pos + n);
+            for(auto it {this->begin() + pos}; begin not_eq end; ++it, static_cast<void>(++begin)) {
+                *it = *begin;
+            }
         }
+        return this->begin() + pos;
     }
-    return result;
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, size_t BlockSize>
 template <IsInputIterator InputIterator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos, InputIterator begin,
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::insert(const_iterator pos, InputIterator begin,
         InputIterator end) {
     return this->insert(pos - this->cbegin(), begin, end);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(size_type pos,
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator deque<T, Allocator, BlockSize>::insert(size_type pos,
         initializer_list<T> init_list) {
     return this->insert(pos, init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos,
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator deque<T, Allocator, BlockSize>::insert(const_iterator pos,
         initializer_list<T> init_list) {
     return this->insert(pos - this->cbegin(), init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(size_type pos, size_type n) {
+template <typename T, typename Allocator, size_t BlockSize>
+template <IsRange Range>
+constexpr void deque<T, Allocator, BlockSize>::append_range(Range &&range) {
+    if constexpr(is_forward_iterator_v<range_iterator_t<Range>>) {
+        const auto n {static_cast<size_type>(ds::range_size(range))};
+        if(n == 0) {
+            return;
+        }
+        this->reserve_back(n);
+        const auto from {this->first + this->element_size()};
+        this->construct_with_range(from, from + n, ds::begin(range));
+        this->element_size() += n;
+    }else {
+        const auto end {ds::end(range)};
+        for(auto begin {ds::begin(range)}; begin not_eq end; ++begin) {
+            this->emplace_back(*begin);
+        }
+    }
+}
+/*
+ * Moves the first n elements of source to the end of this deque. If the two deques have equal allocators and the
+ * offsets of source.begin() and end() in their blocks are equal (always true if this deque is empty), the full blocks
+ * of the range change owners by moving their pointers between the maps, and only the elements in the partial blocks at
+ * both edges are moved. Otherwise the elements are moved one by one.
+ */
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::splice_back(deque &source, size_type n) {
+    if(n == 0 or &source == this) {
+        return;
+    }
+    auto transferable {is_nothrow_move_constructible_v<T>};
+    if constexpr(not is_empty_v<Allocator>) {
+        // the stateless allocators are always equal
+        transferable = transferable and this->element_size.allocator() == source.element_size.allocator();
+    }
+    if(transferable and this->empty()) {
+        // the empty deque is rebased to the offset of source.begin() in the same block
+        if(this->map_size() == 0) {
+            this->allocate_blocks<true, false>(0);
+        }
+        this->first = this->first / deque::block_size * deque::block_size + source.first % deque::block_size;
+    }
+    const auto last {this->first + this->element_size()};
+    transferable = transferable and last % deque::block_size == source.first % deque::block_size;
+    if(not transferable) {
+        this->reserve_back(n);
+        this->construct_with_range(last, last + n, move_iterator {source.begin()});
+        this->element_size() += n;
+        for(auto i {n}; i not_eq 0; --i) {
+            source.pop_front();
+        }
+        return;
+    }
+    const auto offset {last % deque::block_size};
+    const auto head_size {offset == 0 ? 0 : deque::block_size - offset};
+    const auto move_elements {[](T *to, T *from, size_type size) noexcept {
+        for(auto end {from + size}; from not_eq end; ++from, static_cast<void>(++to)) {
+            ds::construct(to, ds::move(*from));
+            ds::destroy(from);
+        }
+    }};
+    if(n < head_size) {
+        move_elements(this->map[last / deque::block_size] + offset,
+                source.map[source.first / deque::block_size] + offset, n);
+        this->element_size() += n;
+        source.first += n;
+        source.element_size() -= n;
+        return;
+    }
+    const auto block_n {(n - head_size) / deque::block_size};
+    const auto tail_size {(n - head_size) % deque::block_size};
+    const auto target_block {(last + deque::block_size - 1) / deque::block_size};
+    const auto source_block {(source.first + deque::block_size - 1) / deque::block_size};
+    // the block receiving the tail edge, which is the block end() points to at last
+    if(target_block == this->map_size()) {
+        this->allocate_blocks<true, false>(0);
+    }
+    if(block_n not_eq 0) {
+        const auto map_size {this->map_size()};
+        const auto new_size {map_size + block_n};
+        auto &map_allocator {this->map_size.allocator()};
+        if(__dsa::try_expand(map_allocator, this->map, new_size)) {
+            ds::memory_move(this->map + (target_block + block_n), this->map + target_block,
+                    sizeof(T *) * (map_size - target_block));
+        }else {
+            const auto new_map {map_allocator.allocate(new_size)};
+            ds::memory_copy(new_map, this->map, sizeof(T *) * target_block);
+            ds::memory_copy(new_map + (target_block + block_n), this->map + target_block,
+                    sizeof(T *) * (map_size - target_block));
+            map_allocator.deallocate(this->map, map_size);
+            this->map = new_map;
+        }
+        ds::memory_copy(this->map + target_block, source.map + source_block, sizeof(T *) * block_n);
+        this->map_size() = new_size;
+    }
+    if(head_size not_eq 0) {
+        move_elements(this->map[target_block - 1] + offset, source.map[source_block - 1] + offset, head_size);
+    }
+    move_elements(this->map[target_block + block_n], source.map[source_block + block_n], tail_size);
+    if(block_n not_eq 0) {
+        auto &source_map_size {source.map_size()};
+        source_map_size -= block_n;
+        ds::memory_move(source.map + source_block, source.map + (source_block + block_n),
+                sizeof(T *) * (source_map_size - source_block));
+    }
+    this->element_size() += n;
+    source.first = source_block * deque::block_size + tail_size;
+    source.element_size() -= n;
+    source.release_excess_front_blocks();
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr void deque<T, Allocator, BlockSize>::splice_back(deque &source) {
+    this->splice_back(source, source.size());
+}
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::erase(size_type pos, size_type n) {
+    if(n == 0) {
+        return this->begin() + pos;
+    }
     auto &size {this->element_size()};
     if(size - pos - n < pos) {
+        // the elements after the erased range are fewer, so they are moved towards the front
         this->move_range(pos + n, size, pos);
-        auto it {this->end() - 1};
-        size -= n;
-        while(n not_eq 0) {
-            ds::destroy(*it--);
-            --n;
+        auto it {this->begin() + (size - n)};
+        for(auto i {n}; i not_eq 0; --i) {
+            ds::destroy(ds::address_of(*it));
+            ++it;
         }
-    }else {
-        this->move_range(this->first, pos, this->first + n);
         size -= n;
+        this->release_excess_back_blocks();
+    }else {
+        this->move_range(0, pos, n);
         auto it {this->begin()};
-        this->first += n;
-        while(n not_eq 0) {
-            ds::destroy(*it++);
-            --n;
+        for(auto i {n}; i not_eq 0; --i) {
+            ds::destroy(ds::address_of(*it));
+            ++it;
         }
+        this->first += n;
+        size -= n;
+        this->release_excess_front_blocks();
     }
     return this->begin() + pos;
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(const_iterator pos, size_type n) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::erase(const_iterator pos, size_type n) {
     return this->erase(pos - this->cbegin(), n);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(const_iterator pos) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator deque<T, Allocator, BlockSize>::erase(const_iterator pos) {
     return this->erase(pos - this->cbegin(), 1);
 }
-template <typename T, typename Allocator>
-constexpr typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(const_iterator begin, const_iterator end) {
+template <typename T, typename Allocator, size_t BlockSize>
+constexpr typename deque<T, Allocator, BlockSize>::iterator
+deque<T, Allocator, BlockSize>::erase(const_iterator begin, const_iterator end) {
     return this->erase(begin - this->cbegin(), end - begin);
 }
 __DATA_STRUCTURE_END(deque implementation)
 
+__DATA_STRUCTURE_START(deque traits)
+template <typename T, typename Allocator, size_t BlockSize>
+struct is_trivially_relocatable<deque<T, Allocator, BlockSize>> : is_trivially_relocatable<Allocator> {};
+__DATA_STRUCTURE_END(deque traits)
+
 }
 
 #endif      //DATA_STRUCTURE_DEQUE_HPP
@@ -0,0 +1,886 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_DEVECTOR_HPP
+#define DATA_STRUCTURE_DEVECTOR_HPP
+
+#include "allocator.hpp"
+#include "iterator.hpp"
+#include "buffer.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(devector declaration)
+/*
+ * A double-ended vector, the elements are contiguous like ds::vector, but the spare memory is kept at both ends
+ * like ds::deque, so push_front and push_back are both amortized O(1). The insertion and the erasion move the
+ * elements of the nearer end. The elements are relocated when the memory is moved, so T is expected to be nothrow
+ * move constructible for the exception safety
+ */
+template <typename T, typename Allocator = allocator<T>, typename GrowthPolicy = doubling_growth_policy>
+class devector {
+public:
+    using allocator_type = Allocator;
+    using size_type = typename Allocator::size_type;
+    using difference_type = typename Allocator::difference_type;
+    using value_type = T;
+    using reference = typename allocator_traits<Allocator>::reference;
+    using const_reference = typename allocator_traits<Allocator>::const_reference;
+    using rvalue_reference = typename allocator_traits<Allocator>::rvalue_reference;
+    using pointer = typename allocator_traits<Allocator>::pointer;
+    using const_pointer = typename allocator_traits<Allocator>::const_pointer;
+    using iterator = wrap_iterator<pointer>;
+    using const_iterator = wrap_iterator<const_pointer>;
+    using reverse_iterator = ds::reverse_iterator<pointer>;
+    using const_reverse_iterator = ds::reverse_iterator<const_pointer>;
+    static_assert(is_same_v<T, typename Allocator::value_type>,
+            "The value type of devector should be same as the allocator's value_type!");
+private:
+    struct reallocation_handler;
+    struct insertion_handler;
+private:
+    pointer first {};
+    pointer head {};
+    pointer cursor {};
+    __dsa::allocator_compressor<pointer, Allocator> last {};
+private:
+    static constexpr void relocate(pointer, pointer, pointer) noexcept(is_nothrow_move_constructible_v<T>);
+    constexpr void reallocate(size_type, size_type);
+    constexpr void make_room_at_front(size_type);
+    constexpr void make_room_at_back(size_type);
+    constexpr pointer open_gap(size_type, size_type);
+    constexpr void close_gap(size_type, size_type) noexcept(is_nothrow_move_constructible_v<T>);
+    constexpr void reset_for_assignment(size_type);
+    [[nodiscard]]
+    constexpr size_type next_capacity(size_type) const noexcept;
+public:
+    constexpr devector() noexcept(is_nothrow_default_constructible_v<Allocator>) = default;
+    explicit constexpr devector(const Allocator &) noexcept;
+    explicit constexpr devector(size_type, const Allocator & = {});
+    constexpr devector(size_type, const_reference, const Allocator & = {});
+    template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+    constexpr devector(InputIterator, InputIterator, const Allocator & = {}, size_type = 64);
+    template <IsForwardIterator ForwardIterator>
+    constexpr devector(ForwardIterator, ForwardIterator, const Allocator & = {});
+    constexpr devector(initializer_list<T>, const Allocator & = {});
+    constexpr devector(const devector &);
+    constexpr devector(const devector &, const Allocator &);
+    constexpr devector(devector &&) noexcept;
+    constexpr devector(devector &&, const Allocator &) noexcept;
+    constexpr ~devector() noexcept;
+public:
+    constexpr devector &operator=(const devector &);
+    constexpr devector &operator=(devector &&) noexcept;
+    constexpr devector &operator=(initializer_list<T>);
+    [[nodiscard]]
+    constexpr reference operator[](size_type) noexcept;
+    [[nodiscard]]
+    constexpr const_reference operator[](size_type) const noexcept;
+public:
+    constexpr void assign(size_type, const_reference = {});
+    template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+    constexpr void assign(InputIterator, InputIterator, size_type = 64);
+    template <IsForwardIterator ForwardIterator>
+    constexpr void assign(ForwardIterator, ForwardIterator);
+    constexpr void assign(initializer_list<T>);
+    [[nodiscard]]
+    constexpr iterator begin() noexcept;
+    [[nodiscard]]
+    constexpr const_iterator begin() const noexcept;
+    [[nodiscard]]
+    constexpr const_iterator cbegin() const noexcept;
+    [[nodiscard]]
+    constexpr iterator end() noexcept;
+    [[nodiscard]]
+    constexpr const_iterator end() const noexcept;
+    [[nodiscard]]
+    constexpr const_iterator cend() const noexcept;
+    [[nodiscard]]
+    constexpr reverse_iterator rbegin() noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator rbegin() const noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator crbegin() const noexcept;
+    [[nodiscard]]
+    constexpr reverse_iterator rend() noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator rend() const noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator crend() const noexcept;
+    [[nodiscard]]
+    constexpr size_type size() const noexcept;
+    [[nodiscard]]
+    constexpr bool empty() const noexcept;
+    [[nodiscard]]
+    constexpr size_type capacity() const noexcept;
+    [[nodiscard]]
+    constexpr size_type front_spare() const noexcept;
+    [[nodiscard]]
+    constexpr size_type back_spare() const noexcept;
+    [[nodiscard]]
+    constexpr size_type spare() const noexcept;
+    constexpr void reserve_front(size_type);
+    constexpr void reserve_back(size_type);
+    constexpr void shrink_to_fit();
+    constexpr void resize(size_type);
+    constexpr void resize(size_type, const_reference);
+    [[nodiscard]]
+    constexpr reference front() noexcept;
+    [[nodiscard]]
+    constexpr const_reference front() const noexcept;
+    [[nodiscard]]
+    constexpr reference back() noexcept;
+    [[nodiscard]]
+    constexpr const_reference back() const noexcept;
+    [[nodiscard]]
+    constexpr pointer data() noexcept;
+    [[nodiscard]]
+    constexpr const_pointer data() const noexcept;
+    [[nodiscard]]
+    constexpr Allocator allocator() const noexcept;
+    constexpr void push_back(const_reference);
+    constexpr void push_back(rvalue_reference);
+    template <typename ...Args>
+    constexpr void emplace_back(Args &&...);
+    constexpr void push_front(const_reference);
+    constexpr void push_front(rvalue_reference);
+    template <typename ...Args>
+    constexpr void emplace_front(Args &&...);
+    constexpr void pop_back() noexcept;
+    constexpr void pop_front() noexcept;
+    constexpr void clear() noexcept;
+    constexpr void swap(devector &) noexcept;
+    constexpr iterator insert(size_type, const_reference, size_type = 1);
+    constexpr iterator insert(const_iterator, const_reference, size_type = 1);
+    template <typename ...Args>
+    constexpr iterator emplace(size_type, Args &&...);
+    template <typename ...Args>
+    constexpr iterator emplace(const_iterator, Args &&...);
+    constexpr iterator insert(size_type, rvalue_reference);
+    constexpr iterator insert(const_iterator, rvalue_reference);
+    template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+    constexpr iterator insert(size_type, InputIterator, InputIterator, size_type = 64);
+    template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+    constexpr iterator insert(const_iterator, InputIterator, InputIterator, size_type = 64);
+    template <IsForwardIterator ForwardIterator>
+    constexpr iterator insert(size_type, ForwardIterator, ForwardIterator);
+    template <IsForwardIterator ForwardIterator>
+    constexpr iterator insert(const_iterator, ForwardIterator, ForwardIterator);
+    constexpr iterator insert(size_type, initializer_list<T>);
+    constexpr iterator insert(const_iterator, initializer_list<T>);
+    template <IsRange Range>
+    constexpr void append_range(Range &&);
+    constexpr iterator erase(size_type, size_type = 1);
+    constexpr iterator erase(const_iterator, size_type);
+    constexpr iterator erase(const_iterator);
+    constexpr iterator erase(const_iterator, const_iterator);
+};
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline constexpr void swap(devector<T, Allocator, GrowthPolicy> &, devector<T, Allocator, GrowthPolicy> &) noexcept;
+__DATA_STRUCTURE_END(devector declaration)
+
+__DATA_STRUCTURE_START(devector implementation)
+
+/* private types */
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct devector<T, Allocator, GrowthPolicy>::reallocation_handler {
+    Allocator &allocator;
+    pointer new_first;
+    size_type new_capacity;
+    pointer begin;
+    size_type i {0};
+    constexpr void operator()() noexcept {
+        ds::destroy(this->begin, this->begin + this->i);
+        this->allocator.deallocate(this->new_first, this->new_capacity);
+    }
+};
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct devector<T, Allocator, GrowthPolicy>::insertion_handler {
+    devector &d;
+    size_type pos;
+    size_type n;
+    size_type i {0};
+    constexpr void operator()() noexcept(is_nothrow_move_constructible_v<T>) {
+        const auto gap {this->d.head + this->pos};
+        ds::destroy(gap, gap + this->i);
+        this->d.close_gap(this->pos, this->n);
+    }
+};
+
+/* private functions */
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::relocate(pointer destination, pointer begin, pointer end)
+        noexcept(is_nothrow_move_constructible_v<T>) {
+    // the ranges may overlap, the objects in [begin, end) are ended after relocation
+    if(destination == begin) {
+        return;
+    }
+    if constexpr(is_trivially_relocatable_v<T>) {
+        ds::memory_move(destination, begin, sizeof(T) * static_cast<size_t>(end - begin));
+    }else if(destination < begin) {
+        for(; begin not_eq end; ++begin, static_cast<void>(++destination)) {
+            ds::construct(destination, ds::move(*begin));
+            ds::destroy(begin);
+        }
+    }else {
+        for(destination += end - begin; end not_eq begin;) {
+            ds::construct(--destination, ds::move(*--end));
+            ds::destroy(end);
+        }
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::reallocate(size_type new_capacity, size_type new_front_spare) {
+    auto &allocator {this->last.allocator()};
+    const auto size {this->size()};
+    const auto new_first {allocator.allocate(new_capacity)};
+    const auto new_head {new_first + new_front_spare};
+    if constexpr(is_trivially_relocatable_v<T>) {
+        if(size not_eq 0) {
+            ds::memory_copy(new_head, this->head, sizeof(T) * size);
+        }
+    }else {
+        auto trans {transaction {reallocation_handler {allocator, new_first, new_capacity, new_head}}};
+        for(auto &i {trans.get_rollback().i}; i < size; ++i) {
+            ds::construct(new_head + i, ds::move_if<is_nothrow_move_constructible_v<T> or
+                    not is_copy_constructible_v<T>>(this->head[i]));
+        }
+        trans.complete();
+        ds::destroy(this->head, this->cursor);
+    }
+    allocator.deallocate(this->first, this->capacity());
+    this->first = new_first;
+    this->head = new_head;
+    this->cursor = new_head + size;
+    this->last() = new_first + new_capacity;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::make_room_at_front(size_type n) {
+    if(n <= this->front_spare()) {
+        return;
+    }
+    const auto size {this->size()};
+    const auto spare {this->spare()};
+    if(spare >= n and spare - n >= size / 2) {
+        // there is enough spare memory at the back, so the elements are moved to the middle instead of growing,
+        //  the spare memory left at each end is at least a quarter of the size, so the moving is amortized O(1)
+        const auto new_head {this->first + (n + (spare - n) / 2)};
+        devector::relocate(new_head, this->head, this->cursor);
+        this->head = new_head;
+        this->cursor = new_head + size;
+        return;
+    }
+    const auto back_spare {this->back_spare()};
+    const auto new_capacity {this->next_capacity(n + size + back_spare)};
+    this->reallocate(new_capacity, new_capacity - size - back_spare);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::make_room_at_back(size_type n) {
+    if(n <= this->back_spare()) {
+        return;
+    }
+    const auto size {this->size()};
+    const auto spare {this->spare()};
+    if(spare >= n and spare - n >= size / 2) {
+        // there is enough spare memory at the front, so the elements are moved to the middle instead of growing
+        const auto new_head {this->first + (spare - n) / 2};
+        devector::relocate(new_head, this->head, this->cursor);
+        this->head = new_head;
+        this->cursor = new_head + size;
+        return;
+    }
+    const auto front_spare {this->front_spare()};
+    this->reallocate(this->next_capacity(front_spare + size + n), front_spare);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::pointer
+devector<T, Allocator, GrowthPolicy>::open_gap(size_type pos, size_type n) {
+    // opens n uninitialized slots before the element pos by moving the elements of the nearer end
+    if(pos < this->size() - pos) {
+        this->make_room_at_front(n);
+        const auto new_head {this->head - n};
+        devector::relocate(new_head, this->head, this->head + pos);
+        this->head = new_head;
+    }else {
+        this->make_room_at_back(n);
+        const auto gap {this->head + pos};
+        devector::relocate(gap + n, gap, this->cursor);
+        this->cursor += n;
+    }
+    return this->head + pos;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::close_gap(size_type pos, size_type n)
+        noexcept(is_nothrow_move_constructible_v<T>) {
+    // the n slots after the element pos are uninitialized, they are closed by moving the elements of the nearer end
+    if(pos < this->size() - pos - n) {
+        devector::relocate(this->head + n, this->head, this->head + pos);
+        this->head += n;
+    }else {
+        const auto gap {this->head + pos};
+        devector::relocate(gap, gap + n, this->cursor);
+        this->cursor -= n;
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::reset_for_assignment(size_type n) {
+    this->clear();
+    if(n > this->capacity()) {
+        this->reallocate(n, 0);
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::size_type
+devector<T, Allocator, GrowthPolicy>::next_capacity(size_type n) const noexcept {
+    return GrowthPolicy::template next_capacity<T>(this->capacity(), n);
+}
+
+/* public functions */
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(const Allocator &allocator) noexcept :
+        first {}, head {}, cursor {}, last(allocator) {}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(size_type n, const Allocator &allocator) :
+        devector(allocator) {
+    this->resize(n);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(size_type n, const_reference value,
+        const Allocator &allocator) : devector(allocator) {
+    this->resize(n, value);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+constexpr devector<T, Allocator, GrowthPolicy>::devector(InputIterator begin, InputIterator end,
+        const Allocator &allocator, size_type default_size) : devector(allocator) {
+    this->assign(begin, end, default_size);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsForwardIterator ForwardIterator>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(ForwardIterator begin, ForwardIterator end,
+        const Allocator &allocator) : devector(allocator) {
+    this->assign(begin, end);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(initializer_list<T> init_list, const Allocator &allocator) :
+        devector(init_list.begin(), init_list.end(), allocator) {}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(const devector &rhs) :
+        devector(rhs.cbegin(), rhs.cend(), rhs.allocator()) {}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(const devector &rhs, const Allocator &allocator) :
+        devector(rhs.cbegin(), rhs.cend(), allocator) {}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(devector &&rhs) noexcept : first {ds::move(rhs.first)},
+        head {ds::move(rhs.head)}, cursor {ds::move(rhs.cursor)}, last {ds::move(rhs.last)} {
+    rhs.first = rhs.head = rhs.cursor = rhs.last() = nullptr;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::devector(devector &&rhs, const Allocator &allocator) noexcept :
+        first {ds::move(rhs.first)}, head {ds::move(rhs.head)}, cursor {ds::move(rhs.cursor)},
+        last(ds::move(rhs.last()), allocator) {
+    rhs.first = rhs.head = rhs.cursor = rhs.last() = nullptr;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy>::~devector() noexcept {
+    ds::destroy(this->head, this->cursor);
+    this->last.allocator().deallocate(this->first, this->capacity());
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy> &
+devector<T, Allocator, GrowthPolicy>::operator=(const devector &rhs) {
+    if(this not_eq &rhs) {
+        this->assign(rhs.cbegin(), rhs.cend());
+    }
+    return *this;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy> &
+devector<T, Allocator, GrowthPolicy>::operator=(devector &&rhs) noexcept {
+    if(this not_eq &rhs) {
+        this->~devector();
+        this->first = ds::move(rhs.first);
+        this->head = ds::move(rhs.head);
+        this->cursor = ds::move(rhs.cursor);
+        this->last = ds::move(rhs.last);
+        rhs.first = rhs.head = rhs.cursor = rhs.last() = nullptr;
+    }
+    return *this;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr devector<T, Allocator, GrowthPolicy> &
+devector<T, Allocator, GrowthPolicy>::operator=(initializer_list<T> init_list) {
+    this->assign(init_list.begin(), init_list.end());
+    return *this;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::reference
+devector<T, Allocator, GrowthPolicy>::operator[](size_type n) noexcept {
+    return this->head[n];
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_reference
+devector<T, Allocator, GrowthPolicy>::operator[](size_type n) const noexcept {
+    return this->head[n];
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::assign(size_type n, const_reference value) {
+    if(ds::address_of(value) >= this->head and ds::address_of(value) < this->cursor) {
+        const T copy {value};
+        this->assign(n, copy);
+        return;
+    }
+    this->reset_for_assignment(n);
+    for(const auto end {this->head + n}; this->cursor not_eq end; ++this->cursor) {
+        ds::construct(this->cursor, value);
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+constexpr void devector<T, Allocator, GrowthPolicy>::assign(InputIterator begin, InputIterator end,
+        size_type default_size) {
+    buffer<T, Allocator, GrowthPolicy> b(begin, end, this->last.allocator(), default_size);
+    this->assign(b.mbegin(), b.mend());
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsForwardIterator ForwardIterator>
+constexpr void devector<T, Allocator, GrowthPolicy>::assign(ForwardIterator begin, ForwardIterator end) {
+    this->reset_for_assignment(static_cast<size_type>(ds::distance(begin, end)));
+    for(; begin not_eq end; ++begin, static_cast<void>(++this->cursor)) {
+        ds::construct(this->cursor, *begin);
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::assign(initializer_list<T> init_list) {
+    this->assign(init_list.begin(), init_list.end());
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::begin() noexcept {
+    return iterator {this->head};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_iterator
+devector<T, Allocator, GrowthPolicy>::begin() const noexcept {
+    return const_iterator {this->head};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_iterator
+devector<T, Allocator, GrowthPolicy>::cbegin() const noexcept {
+    return this->begin();
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::end() noexcept {
+    return iterator {this->cursor};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_iterator
+devector<T, Allocator, GrowthPolicy>::end() const noexcept {
+    return const_iterator {this->cursor};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_iterator
+devector<T, Allocator, GrowthPolicy>::cend() const noexcept {
+    return this->end();
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::reverse_iterator
+devector<T, Allocator, GrowthPolicy>::rbegin() noexcept {
+    return reverse_iterator {this->cursor - 1};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+devector<T, Allocator, GrowthPolicy>::rbegin() const noexcept {
+    return const_reverse_iterator {this->cursor - 1};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+devector<T, Allocator, GrowthPolicy>::crbegin() const noexcept {
+    return this->rbegin();
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::reverse_iterator
+devector<T, Allocator, GrowthPolicy>::rend() noexcept {
+    return reverse_iterator {this->head - 1};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+devector<T, Allocator, GrowthPolicy>::rend() const noexcept {
+    return const_reverse_iterator {this->head - 1};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+devector<T, Allocator, GrowthPolicy>::crend() const noexcept {
+    return this->rend();
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::size_type
+devector<T, Allocator, GrowthPolicy>::size() const noexcept {
+    return static_cast<size_type>(this->cursor - this->head);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr bool devector<T, Allocator, GrowthPolicy>::empty() const noexcept {
+    return this->head == this->cursor;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::size_type
+devector<T, Allocator, GrowthPolicy>::capacity() const noexcept {
+    return static_cast<size_type>(this->last() - this->first);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::size_type
+devector<T, Allocator, GrowthPolicy>::front_spare() const noexcept {
+    return static_cast<size_type>(this->head - this->first);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::size_type
+devector<T, Allocator, GrowthPolicy>::back_spare() const noexcept {
+    return static_cast<size_type>(this->last() - this->cursor);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::size_type
+devector<T, Allocator, GrowthPolicy>::spare() const noexcept {
+    return this->capacity() - this->size();
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::reserve_front(size_type n) {
+    if(const auto front_spare {this->front_spare()}; n > front_spare) {
+        const auto back_spare {this->back_spare()};
+        this->reallocate(n + this->size() + back_spare, n);
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::reserve_back(size_type n) {
+    if(n > this->back_spare()) {
+        const auto front_spare {this->front_spare()};
+        this->reallocate(front_spare + this->size() + n, front_spare);
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::shrink_to_fit() {
+    if(this->first == this->head and this->cursor == this->last()) {
+        return;
+    }
+    if(this->empty()) {
+        this->last.allocator().deallocate(this->first, this->capacity());
+        this->first = this->head = this->cursor = this->last() = nullptr;
+        return;
+    }
+    this->reallocate(this->size(), 0);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::resize(size_type n) {
+    const auto size {this->size()};
+    if(n <= size) {
+        const auto new_cursor {this->head + n};
+        ds::destroy(new_cursor, this->cursor);
+        this->cursor = new_cursor;
+        return;
+    }
+    this->make_room_at_back(n - size);
+    const auto end {this->head + n};
+    if constexpr(is_pointer_v<pointer> and is_trivially_default_constructible_v<T>) {
+        ds::memory_default_initialization(this->cursor, sizeof(T) * (n - size));
+        this->cursor = end;
+    }else {
+        for(; this->cursor not_eq end; ++this->cursor) {
+            ds::construct(this->cursor);
+        }
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::resize(size_type n, const_reference value) {
+    const auto size {this->size()};
+    if(n <= size) {
+        const auto new_cursor {this->head + n};
+        ds::destroy(new_cursor, this->cursor);
+        this->cursor = new_cursor;
+        return;
+    }
+    if(ds::address_of(value) >= this->head and ds::address_of(value) < this->cursor) {
+        const T copy {value};
+        this->resize(n, copy);
+        return;
+    }
+    this->make_room_at_back(n - size);
+    for(const auto end {this->head + n}; this->cursor not_eq end; ++this->cursor) {
+        ds::construct(this->cursor, value);
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::reference
+devector<T, Allocator, GrowthPolicy>::front() noexcept {
+    return *this->head;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_reference
+devector<T, Allocator, GrowthPolicy>::front() const noexcept {
+    return *this->head;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::reference
+devector<T, Allocator, GrowthPolicy>::back() noexcept {
+    return this->cursor[-1];
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_reference
+devector<T, Allocator, GrowthPolicy>::back() const noexcept {
+    return this->cursor[-1];
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::pointer
+devector<T, Allocator, GrowthPolicy>::data() noexcept {
+    return this->head;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::const_pointer
+devector<T, Allocator, GrowthPolicy>::data() const noexcept {
+    return this->head;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr Allocator devector<T, Allocator, GrowthPolicy>::allocator() const noexcept {
+    return this->last.allocator();
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::push_back(const_reference value) {
+    this->emplace_back(value);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::push_back(rvalue_reference value) {
+    this->emplace_back(ds::move(value));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename ...Args>
+constexpr void devector<T, Allocator, GrowthPolicy>::emplace_back(Args &&...args) {
+    if(this->cursor == this->last()) [[unlikely]] {
+        // the arguments may refer to an element, so the value is constructed before moving the elements
+        T value(ds::forward<Args>(args)...);
+        this->make_room_at_back(1);
+        ds::construct(this->cursor, ds::move(value));
+    }else {
+        ds::construct(this->cursor, ds::forward<Args>(args)...);
+    }
+    ++this->cursor;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::push_front(const_reference value) {
+    this->emplace_front(value);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::push_front(rvalue_reference value) {
+    this->emplace_front(ds::move(value));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename ...Args>
+constexpr void devector<T, Allocator, GrowthPolicy>::emplace_front(Args &&...args) {
+    if(this->head == this->first) [[unlikely]] {
+        T value(ds::forward<Args>(args)...);
+        this->make_room_at_front(1);
+        ds::construct(this->head - 1, ds::move(value));
+    }else {
+        ds::construct(this->head - 1, ds::forward<Args>(args)...);
+    }
+    --this->head;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::pop_back() noexcept {
+    ds::destroy(--this->cursor);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::pop_front() noexcept {
+    ds::destroy(this->head++);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::clear() noexcept {
+    ds::destroy(this->head, this->cursor);
+    this->head = this->cursor = this->first;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void devector<T, Allocator, GrowthPolicy>::swap(devector &rhs) noexcept {
+    using ds::swap;
+    swap(this->first, rhs.first);
+    swap(this->head, rhs.head);
+    swap(this->cursor, rhs.cursor);
+    swap(this->last, rhs.last);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(size_type pos, const_reference value, size_type n) {
+    if(n == 0) {
+        return this->begin() + pos;
+    }
+    if(ds::address_of(value) >= this->head and ds::address_of(value) < this->cursor) {
+        const T copy {value};
+        return this->insert(pos, copy, n);
+    }
+    const auto gap {this->open_gap(pos, n)};
+    auto trans {transaction {insertion_handler {*this, pos, n}}};
+    for(auto &i {trans.get_rollback().i}; i < n; ++i) {
+        ds::construct(gap + i, value);
+    }
+    trans.complete();
+    return iterator {gap};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, const_reference value, size_type n) {
+    return this->insert(static_cast<size_type>(pos - this->cbegin()), value, n);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename ...Args>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::emplace(size_type pos, Args &&...args) {
+    if(pos == 0) {
+        this->emplace_front(ds::forward<Args>(args)...);
+        return this->begin();
+    }
+    if(pos == this->size()) {
+        this->emplace_back(ds::forward<Args>(args)...);
+        return this->end() - 1;
+    }
+    T value(ds::forward<Args>(args)...);
+    const auto gap {this->open_gap(pos, 1)};
+    auto trans {transaction {insertion_handler {*this, pos, 1}}};
+    ds::construct(gap, ds::move(value));
+    trans.complete();
+    return iterator {gap};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename ...Args>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::emplace(const_iterator pos, Args &&...args) {
+    return this->emplace(static_cast<size_type>(pos - this->cbegin()), ds::forward<Args>(args)...);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(size_type pos, rvalue_reference value) {
+    return this->emplace(pos, ds::move(value));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, rvalue_reference value) {
+    return this->emplace(static_cast<size_type>(pos - this->cbegin()), ds::move(value));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(size_type pos, InputIterator begin, InputIterator end,
+        size_type default_size) {
+    buffer<T, Allocator, GrowthPolicy> b(begin, end, this->last.allocator(), default_size);
+    return this->insert(pos, b.mbegin(), b.mend());
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, InputIterator begin, InputIterator end,
+        size_type default_size) {
+    return this->insert(static_cast<size_type>(pos - this->cbegin()), begin, end, default_size);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsForwardIterator ForwardIterator>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(size_type pos, ForwardIterator begin, ForwardIterator end) {
+    // the range should not refer to the elements of this devector
+    const auto n {static_cast<size_type>(ds::distance(begin, end))};
+    if(n == 0) {
+        return this->begin() + pos;
+    }
+    const auto gap {this->open_gap(pos, n)};
+    auto trans {transaction {insertion_handler {*this, pos, n}}};
+    for(auto &i {trans.get_rollback().i}; i < n; ++i, static_cast<void>(++begin)) {
+        ds::construct(gap + i, *begin);
+    }
+    trans.complete();
+    return iterator {gap};
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsForwardIterator ForwardIterator>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, ForwardIterator begin, ForwardIterator end) {
+    return this->insert(static_cast<size_type>(pos - this->cbegin()), begin, end);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(size_type pos, initializer_list<T> init_list) {
+    return this->insert(pos, init_list.begin(), init_list.end());
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, initializer_list<T> init_list) {
+    return this->insert(static_cast<size_type>(pos - this->cbegin()), init_list.begin(), init_list.end());
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsRange Range>
+constexpr void devector<T, Allocator, GrowthPolicy>::append_range(Range &&range) {
+    // the range should not refer to the elements of this devector
+    if constexpr(is_forward_iterator_v<range_iterator_t<Range>>) {
+        const auto n {static_cast<size_type>(ds::range_size(range))};
+        this->make_room_at_back(n);
+        auto begin {ds::begin(range)};
+        for(const auto end {this->cursor + n}; this->cursor not_eq end; ++this->cursor) {
+            ds::construct(this->cursor, *begin);
+            ++begin;
+        }
+    }else {
+        const auto end {ds::end(range)};
+        for(auto begin {ds::begin(range)}; begin not_eq end; ++begin) {
+            this->emplace_back(*begin);
+        }
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::erase(size_type pos, size_type n) {
+    if(n not_eq 0) {
+        const auto erasion_begin {this->head + pos};
+        ds::destroy(erasion_begin, erasion_begin + n);
+        this->close_gap(pos, n);
+    }
+    return this->begin() + pos;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::erase(const_iterator pos, size_type n) {
+    return this->erase(static_cast<size_type>(pos - this->cbegin()), n);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::erase(const_iterator pos) {
+    return this->erase(static_cast<size_type>(pos - this->cbegin()), 1);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename devector<T, Allocator, GrowthPolicy>::iterator
+devector<T, Allocator, GrowthPolicy>::erase(const_iterator begin, const_iterator end) {
+    return this->erase(static_cast<size_type>(begin - this->cbegin()), static_cast<size_type>(end - begin));
+}
+
+/* global functions */
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline constexpr void swap(devector<T, Allocator, GrowthPolicy> &lhs,
+        devector<T, Allocator, GrowthPolicy> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+__DATA_STRUCTURE_END(devector implementation)
+
+__DATA_STRUCTURE_START(devector traits)
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct is_trivially_relocatable<devector<T, Allocator, GrowthPolicy>> : is_trivially_relocatable<Allocator> {};
+__DATA_STRUCTURE_END(devector traits)
+
+}       // namespace data_structure
+
+#endif      //DATA_STRUCTURE_DEVECTOR_HPP
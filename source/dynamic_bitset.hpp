@@ -0,0 +1,722 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_DYNAMIC_BITSET_HPP
+#define DATA_STRUCTURE_DYNAMIC_BITSET_HPP
+
+#include "allocator.hpp"
+#include "iterator.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(dynamic_bitset declaration)
+/*
+ * A packed sequence of bits, the bits are stored in the words allocated by Allocator, the bit i is the bit
+ * (i % word_bits) of the word (i / word_bits). The bits after size() in the last word are always zero, so the
+ * bitwise operations, count and find_first work on whole words.
+ */
+template <typename Allocator = allocator<unsigned long long>, typename GrowthPolicy = doubling_growth_policy>
+class dynamic_bitset {
+public:
+    using allocator_type = Allocator;
+    using size_type = typename Allocator::size_type;
+    using difference_type = typename Allocator::difference_type;
+    using value_type = bool;
+    using word_type = typename Allocator::value_type;
+    using reference = __dsa::bit_reference<word_type>;
+    using const_reference = bool;
+    using pointer = typename allocator_traits<Allocator>::pointer;
+    using const_pointer = typename allocator_traits<Allocator>::const_pointer;
+    using iterator = __dsa::bit_iterator<word_type, false>;
+    using const_iterator = __dsa::bit_iterator<word_type, true>;
+    using reverse_iterator = ds::reverse_iterator<iterator>;
+    using const_reverse_iterator = ds::reverse_iterator<const_iterator>;
+    static_assert(is_unsigned_v<word_type> and sizeof(word_type) <= sizeof(unsigned long long),
+            "The value_type of the allocator for dynamic_bitset should be an unsigned integer!");
+public:
+    static constexpr size_type word_bits {sizeof(word_type) * 8};
+    static constexpr size_type npos {static_cast<size_type>(-1)};
+private:
+    pointer first {};
+    size_type bits {};
+    __dsa::allocator_compressor<size_type, Allocator> word_capacity {};
+private:
+    [[nodiscard]]
+    static constexpr size_type word_count(size_type) noexcept;
+    [[nodiscard]]
+    static constexpr word_type low_mask(size_type) noexcept;
+    constexpr void reallocate(size_type);
+    constexpr void clear_unused_bits() noexcept;
+    constexpr void fill(size_type, size_type, bool) noexcept;
+public:
+    constexpr dynamic_bitset() noexcept(is_nothrow_default_constructible_v<Allocator>) = default;
+    explicit constexpr dynamic_bitset(const Allocator &) noexcept;
+    explicit constexpr dynamic_bitset(size_type, bool = false, const Allocator & = {});
+    constexpr dynamic_bitset(initializer_list<bool>, const Allocator & = {});
+    constexpr dynamic_bitset(const dynamic_bitset &);
+    constexpr dynamic_bitset(const dynamic_bitset &, const Allocator &);
+    constexpr dynamic_bitset(dynamic_bitset &&) noexcept;
+    constexpr dynamic_bitset(dynamic_bitset &&, const Allocator &) noexcept;
+    constexpr ~dynamic_bitset() noexcept;
+public:
+    constexpr dynamic_bitset &operator=(const dynamic_bitset &);
+    constexpr dynamic_bitset &operator=(dynamic_bitset &&) noexcept;
+    [[nodiscard]]
+    constexpr reference operator[](size_type) noexcept;
+    [[nodiscard]]
+    constexpr const_reference operator[](size_type) const noexcept;
+    constexpr dynamic_bitset &operator&=(const dynamic_bitset &) noexcept;
+    constexpr dynamic_bitset &operator|=(const dynamic_bitset &) noexcept;
+    constexpr dynamic_bitset &operator^=(const dynamic_bitset &) noexcept;
+    [[nodiscard]]
+    constexpr dynamic_bitset operator~() const;
+public:
+    [[nodiscard]]
+    constexpr iterator begin() noexcept;
+    [[nodiscard]]
+    constexpr const_iterator begin() const noexcept;
+    [[nodiscard]]
+    constexpr const_iterator cbegin() const noexcept;
+    [[nodiscard]]
+    constexpr iterator end() noexcept;
+    [[nodiscard]]
+    constexpr const_iterator end() const noexcept;
+    [[nodiscard]]
+    constexpr const_iterator cend() const noexcept;
+    [[nodiscard]]
+    constexpr reverse_iterator rbegin() noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator rbegin() const noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator crbegin() const noexcept;
+    [[nodiscard]]
+    constexpr reverse_iterator rend() noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator rend() const noexcept;
+    [[nodiscard]]
+    constexpr const_reverse_iterator crend() const noexcept;
+    [[nodiscard]]
+    constexpr size_type size() const noexcept;
+    [[nodiscard]]
+    constexpr bool empty() const noexcept;
+    [[nodiscard]]
+    constexpr size_type capacity() const noexcept;
+    [[nodiscard]]
+    constexpr size_type word_size() const noexcept;
+    constexpr void reserve(size_type);
+    constexpr void shrink_to_fit();
+    constexpr void resize(size_type, bool = false);
+    [[nodiscard]]
+    constexpr reference front() noexcept;
+    [[nodiscard]]
+    constexpr const_reference front() const noexcept;
+    [[nodiscard]]
+    constexpr reference back() noexcept;
+    [[nodiscard]]
+    constexpr const_reference back() const noexcept;
+    [[nodiscard]]
+    constexpr pointer data() noexcept;
+    [[nodiscard]]
+    constexpr const_pointer data() const noexcept;
+    [[nodiscard]]
+    constexpr Allocator allocator() const noexcept;
+    constexpr void push_back(bool);
+    constexpr void pop_back() noexcept;
+    constexpr void clear() noexcept;
+    constexpr void swap(dynamic_bitset &) noexcept;
+    [[nodiscard]]
+    constexpr bool test(size_type) const noexcept;
+    constexpr dynamic_bitset &set() noexcept;
+    constexpr dynamic_bitset &set(size_type, bool = true) noexcept;
+    constexpr dynamic_bitset &set(size_type, size_type, bool) noexcept;
+    constexpr dynamic_bitset &reset() noexcept;
+    constexpr dynamic_bitset &reset(size_type) noexcept;
+    constexpr dynamic_bitset &reset(size_type, size_type) noexcept;
+    constexpr dynamic_bitset &flip() noexcept;
+    constexpr dynamic_bitset &flip(size_type) noexcept;
+    [[nodiscard]]
+    constexpr size_type count() const noexcept;
+    [[nodiscard]]
+    constexpr bool all() const noexcept;
+    [[nodiscard]]
+    constexpr bool any() const noexcept;
+    [[nodiscard]]
+    constexpr bool none() const noexcept;
+    [[nodiscard]]
+    constexpr size_type find_first() const noexcept;
+    [[nodiscard]]
+    constexpr size_type find_next(size_type) const noexcept;
+};
+template <typename Allocator, typename GrowthPolicy>
+inline constexpr void swap(dynamic_bitset<Allocator, GrowthPolicy> &,
+        dynamic_bitset<Allocator, GrowthPolicy> &) noexcept;
+template <typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr bool operator==(const dynamic_bitset<Allocator, GrowthPolicy> &,
+        const dynamic_bitset<Allocator, GrowthPolicy> &) noexcept;
+template <typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr bool operator!=(const dynamic_bitset<Allocator, GrowthPolicy> &,
+        const dynamic_bitset<Allocator, GrowthPolicy> &) noexcept;
+template <typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr dynamic_bitset<Allocator, GrowthPolicy> operator&(const dynamic_bitset<Allocator, GrowthPolicy> &,
+        const dynamic_bitset<Allocator, GrowthPolicy> &);
+template <typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr dynamic_bitset<Allocator, GrowthPolicy> operator|(const dynamic_bitset<Allocator, GrowthPolicy> &,
+        const dynamic_bitset<Allocator, GrowthPolicy> &);
+template <typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr dynamic_bitset<Allocator, GrowthPolicy> operator^(const dynamic_bitset<Allocator, GrowthPolicy> &,
+        const dynamic_bitset<Allocator, GrowthPolicy> &);
+__DATA_STRUCTURE_END(dynamic_bitset declaration)
+
+__DATA_STRUCTURE_START(dynamic_bitset implementation)
+
+/* private functions */
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::size_type
+dynamic_bitset<Allocator, GrowthPolicy>::word_count(size_type bits) noexcept {
+    return (bits + (dynamic_bitset::word_bits - 1)) / dynamic_bitset::word_bits;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::word_type
+dynamic_bitset<Allocator, GrowthPolicy>::low_mask(size_type n) noexcept {
+    // the lowest n bits are set, n should be less than word_bits
+    return static_cast<word_type>((static_cast<word_type>(1) << n) - 1);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::reallocate(size_type new_word_capacity) {
+    auto &allocator {this->word_capacity.allocator()};
+    const auto new_first {allocator.allocate(new_word_capacity)};
+    if(const auto words {this->word_size()}; words not_eq 0) {
+        ds::memory_copy(new_first, this->first, sizeof(word_type) * words);
+    }
+    allocator.deallocate(this->first, this->word_capacity());
+    this->first = new_first;
+    this->word_capacity() = new_word_capacity;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::clear_unused_bits() noexcept {
+    if(const auto used {this->bits % dynamic_bitset::word_bits}; used not_eq 0) {
+        this->first[this->bits / dynamic_bitset::word_bits] &= dynamic_bitset::low_mask(used);
+    }
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::fill(size_type begin, size_type end, bool value) noexcept {
+    // the partial words at both ends are masked, the whole words between them are written directly
+    if(begin >= end) {
+        return;
+    }
+    const auto fill_word {[value](word_type &word, word_type mask) noexcept {
+        if(value) {
+            word |= mask;
+        }else {
+            word &= static_cast<word_type>(~mask);
+        }
+    }};
+    auto begin_word {begin / dynamic_bitset::word_bits};
+    const auto end_word {end / dynamic_bitset::word_bits};
+    const auto begin_offset {begin % dynamic_bitset::word_bits};
+    const auto end_offset {end % dynamic_bitset::word_bits};
+    if(begin_word == end_word) {
+        fill_word(this->first[begin_word], static_cast<word_type>(dynamic_bitset::low_mask(end_offset) &
+                ~dynamic_bitset::low_mask(begin_offset)));
+        return;
+    }
+    if(begin_offset not_eq 0) {
+        fill_word(this->first[begin_word++], static_cast<word_type>(~dynamic_bitset::low_mask(begin_offset)));
+    }
+    const auto whole_word {value ? static_cast<word_type>(~word_type {}) : word_type {}};
+    for(; begin_word < end_word; ++begin_word) {
+        this->first[begin_word] = whole_word;
+    }
+    if(end_offset not_eq 0) {
+        fill_word(this->first[end_word], dynamic_bitset::low_mask(end_offset));
+    }
+}
+
+/* public functions */
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::dynamic_bitset(const Allocator &allocator) noexcept :
+        first {}, bits {}, word_capacity(allocator) {}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::dynamic_bitset(size_type n, bool value,
+        const Allocator &allocator) : dynamic_bitset(allocator) {
+    this->resize(n, value);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::dynamic_bitset(initializer_list<bool> init_list,
+        const Allocator &allocator) : dynamic_bitset(allocator) {
+    this->reserve(init_list.size());
+    for(auto value : init_list) {
+        this->push_back(value);
+    }
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::dynamic_bitset(const dynamic_bitset &rhs) :
+        dynamic_bitset(rhs, rhs.allocator()) {}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::dynamic_bitset(const dynamic_bitset &rhs,
+        const Allocator &allocator) : dynamic_bitset(allocator) {
+    if(const auto words {rhs.word_size()}; words not_eq 0) {
+        this->first = this->word_capacity.allocator().allocate(words);
+        this->word_capacity() = words;
+        ds::memory_copy(this->first, rhs.first, sizeof(word_type) * words);
+    }
+    this->bits = rhs.bits;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::dynamic_bitset(dynamic_bitset &&rhs) noexcept :
+        first {rhs.first}, bits {rhs.bits}, word_capacity {ds::move(rhs.word_capacity)} {
+    rhs.first = nullptr;
+    rhs.bits = rhs.word_capacity() = 0;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::dynamic_bitset(dynamic_bitset &&rhs,
+        const Allocator &allocator) noexcept : first {rhs.first}, bits {rhs.bits},
+        word_capacity(rhs.word_capacity(), allocator) {
+    rhs.first = nullptr;
+    rhs.bits = rhs.word_capacity() = 0;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy>::~dynamic_bitset() noexcept {
+    this->word_capacity.allocator().deallocate(this->first, this->word_capacity());
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::operator=(const dynamic_bitset &rhs) {
+    if(this not_eq &rhs) {
+        const auto words {rhs.word_size()};
+        if(words > this->word_capacity()) {
+            this->bits = 0;
+            this->reallocate(words);
+        }
+        if(words not_eq 0) {
+            ds::memory_copy(this->first, rhs.first, sizeof(word_type) * words);
+        }
+        this->bits = rhs.bits;
+    }
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::operator=(dynamic_bitset &&rhs) noexcept {
+    if(this not_eq &rhs) {
+        this->~dynamic_bitset();
+        this->first = rhs.first;
+        this->bits = rhs.bits;
+        this->word_capacity = ds::move(rhs.word_capacity);
+        rhs.first = nullptr;
+        rhs.bits = rhs.word_capacity() = 0;
+    }
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::reference
+dynamic_bitset<Allocator, GrowthPolicy>::operator[](size_type n) noexcept {
+    return reference {this->first + n / dynamic_bitset::word_bits, n % dynamic_bitset::word_bits};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_reference
+dynamic_bitset<Allocator, GrowthPolicy>::operator[](size_type n) const noexcept {
+    return this->test(n);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::operator&=(const dynamic_bitset &rhs) noexcept {
+    __DATA_STRUCTURE_DEBUG_ASSERT(this->bits == rhs.bits, "The sizes of the bitsets should be same!");
+    for(auto i {0uz}, words {this->word_size()}; i < words; ++i) {
+        this->first[i] &= rhs.first[i];
+    }
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::operator|=(const dynamic_bitset &rhs) noexcept {
+    __DATA_STRUCTURE_DEBUG_ASSERT(this->bits == rhs.bits, "The sizes of the bitsets should be same!");
+    for(auto i {0uz}, words {this->word_size()}; i < words; ++i) {
+        this->first[i] |= rhs.first[i];
+    }
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::operator^=(const dynamic_bitset &rhs) noexcept {
+    __DATA_STRUCTURE_DEBUG_ASSERT(this->bits == rhs.bits, "The sizes of the bitsets should be same!");
+    for(auto i {0uz}, words {this->word_size()}; i < words; ++i) {
+        this->first[i] ^= rhs.first[i];
+    }
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> dynamic_bitset<Allocator, GrowthPolicy>::operator~() const {
+    auto result {*this};
+    result.flip();
+    return result;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::iterator
+dynamic_bitset<Allocator, GrowthPolicy>::begin() noexcept {
+    return iterator {this->first, 0};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::begin() const noexcept {
+    return const_iterator {this->first, 0};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::cbegin() const noexcept {
+    return this->begin();
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::iterator
+dynamic_bitset<Allocator, GrowthPolicy>::end() noexcept {
+    return iterator {this->first + this->bits / dynamic_bitset::word_bits, this->bits % dynamic_bitset::word_bits};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::end() const noexcept {
+    return const_iterator {this->first + this->bits / dynamic_bitset::word_bits,
+            this->bits % dynamic_bitset::word_bits};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::cend() const noexcept {
+    return this->end();
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::reverse_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::rbegin() noexcept {
+    return reverse_iterator {this->end() - 1};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_reverse_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::rbegin() const noexcept {
+    return const_reverse_iterator {this->end() - 1};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_reverse_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::crbegin() const noexcept {
+    return this->rbegin();
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::reverse_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::rend() noexcept {
+    return reverse_iterator {this->begin() - 1};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_reverse_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::rend() const noexcept {
+    return const_reverse_iterator {this->begin() - 1};
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_reverse_iterator
+dynamic_bitset<Allocator, GrowthPolicy>::crend() const noexcept {
+    return this->rend();
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::size_type
+dynamic_bitset<Allocator, GrowthPolicy>::size() const noexcept {
+    return this->bits;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr bool dynamic_bitset<Allocator, GrowthPolicy>::empty() const noexcept {
+    return this->bits == 0;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::size_type
+dynamic_bitset<Allocator, GrowthPolicy>::capacity() const noexcept {
+    return this->word_capacity() * dynamic_bitset::word_bits;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::size_type
+dynamic_bitset<Allocator, GrowthPolicy>::word_size() const noexcept {
+    return dynamic_bitset::word_count(this->bits);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::reserve(size_type n) {
+    if(const auto words {dynamic_bitset::word_count(n)}; words > this->word_capacity()) {
+        this->reallocate(words);
+    }
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::shrink_to_fit() {
+    const auto words {this->word_size()};
+    if(words == this->word_capacity()) {
+        return;
+    }
+    if(words == 0) {
+        this->word_capacity.allocator().deallocate(this->first, this->word_capacity());
+        this->first = nullptr;
+        this->word_capacity() = 0;
+        return;
+    }
+    this->reallocate(words);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::resize(size_type n, bool value) {
+    if(n <= this->bits) {
+        this->bits = n;
+        this->clear_unused_bits();
+        return;
+    }
+    const auto words {dynamic_bitset::word_count(n)};
+    if(words > this->word_capacity()) {
+        this->reallocate(GrowthPolicy::template next_capacity<word_type>(this->word_capacity(), words));
+    }
+    // the unused bits of the last word are zero already, so only the new words should be cleared
+    if(const auto old_words {this->word_size()}; words > old_words) {
+        ds::memory_default_initialization<word_type>(this->first + old_words, words - old_words);
+    }
+    const auto old_size {this->bits};
+    this->bits = n;
+    if(value) {
+        this->fill(old_size, n, true);
+    }
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::reference
+dynamic_bitset<Allocator, GrowthPolicy>::front() noexcept {
+    return (*this)[0];
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_reference
+dynamic_bitset<Allocator, GrowthPolicy>::front() const noexcept {
+    return this->test(0);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::reference
+dynamic_bitset<Allocator, GrowthPolicy>::back() noexcept {
+    return (*this)[this->bits - 1];
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_reference
+dynamic_bitset<Allocator, GrowthPolicy>::back() const noexcept {
+    return this->test(this->bits - 1);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::pointer
+dynamic_bitset<Allocator, GrowthPolicy>::data() noexcept {
+    return this->first;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::const_pointer
+dynamic_bitset<Allocator, GrowthPolicy>::data() const noexcept {
+    return this->first;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr Allocator dynamic_bitset<Allocator, GrowthPolicy>::allocator() const noexcept {
+    return this->word_capacity.allocator();
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::push_back(bool value) {
+    const auto word {this->bits / dynamic_bitset::word_bits};
+    const auto offset {this->bits % dynamic_bitset::word_bits};
+    if(offset == 0) {
+        if(word == this->word_capacity()) [[unlikely]] {
+            this->reallocate(GrowthPolicy::template next_capacity<word_type>(this->word_capacity(), word + 1));
+        }
+        this->first[word] = 0;
+    }
+    this->first[word] |= static_cast<word_type>(static_cast<word_type>(value) << offset);
+    ++this->bits;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::pop_back() noexcept {
+    --this->bits;
+    this->clear_unused_bits();
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::clear() noexcept {
+    this->bits = 0;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr void dynamic_bitset<Allocator, GrowthPolicy>::swap(dynamic_bitset &rhs) noexcept {
+    using ds::swap;
+    swap(this->first, rhs.first);
+    swap(this->bits, rhs.bits);
+    swap(this->word_capacity, rhs.word_capacity);
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr bool dynamic_bitset<Allocator, GrowthPolicy>::test(size_type pos) const noexcept {
+    return this->first[pos / dynamic_bitset::word_bits] >> pos % dynamic_bitset::word_bits & 1;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &dynamic_bitset<Allocator, GrowthPolicy>::set() noexcept {
+    this->fill(0, this->bits, true);
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::set(size_type pos, bool value) noexcept {
+    (*this)[pos] = value;
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::set(size_type pos, size_type n, bool value) noexcept {
+    this->fill(pos, pos + n, value);
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &dynamic_bitset<Allocator, GrowthPolicy>::reset() noexcept {
+    this->fill(0, this->bits, false);
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::reset(size_type pos) noexcept {
+    (*this)[pos] = false;
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::reset(size_type pos, size_type n) noexcept {
+    this->fill(pos, pos + n, false);
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &dynamic_bitset<Allocator, GrowthPolicy>::flip() noexcept {
+    for(auto i {0uz}, words {this->word_size()}; i < words; ++i) {
+        this->first[i] = static_cast<word_type>(~this->first[i]);
+    }
+    this->clear_unused_bits();
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr dynamic_bitset<Allocator, GrowthPolicy> &
+dynamic_bitset<Allocator, GrowthPolicy>::flip(size_type pos) noexcept {
+    (*this)[pos].flip();
+    return *this;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::size_type
+dynamic_bitset<Allocator, GrowthPolicy>::count() const noexcept {
+    auto result {0uz};
+    for(auto i {0uz}, words {this->word_size()}; i < words; ++i) {
+        result += static_cast<size_type>(ds::popcount(this->first[i]));
+    }
+    return result;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr bool dynamic_bitset<Allocator, GrowthPolicy>::all() const noexcept {
+    const auto whole_words {this->bits / dynamic_bitset::word_bits};
+    for(auto i {0uz}; i < whole_words; ++i) {
+        if(this->first[i] not_eq static_cast<word_type>(~word_type {})) {
+            return false;
+        }
+    }
+    if(const auto used {this->bits % dynamic_bitset::word_bits}; used not_eq 0) {
+        return this->first[whole_words] == dynamic_bitset::low_mask(used);
+    }
+    return true;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr bool dynamic_bitset<Allocator, GrowthPolicy>::any() const noexcept {
+    for(auto i {0uz}, words {this->word_size()}; i < words; ++i) {
+        if(this->first[i] not_eq 0) {
+            return true;
+        }
+    }
+    return false;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr bool dynamic_bitset<Allocator, GrowthPolicy>::none() const noexcept {
+    return not this->any();
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::size_type
+dynamic_bitset<Allocator, GrowthPolicy>::find_first() const noexcept {
+    for(auto i {0uz}, words {this->word_size()}; i < words; ++i) {
+        if(const auto word {this->first[i]}; word not_eq 0) {
+            return i * dynamic_bitset::word_bits + static_cast<size_type>(ds::countr_zero(word));
+        }
+    }
+    return dynamic_bitset::npos;
+}
+template <typename Allocator, typename GrowthPolicy>
+constexpr typename dynamic_bitset<Allocator, GrowthPolicy>::size_type
+dynamic_bitset<Allocator, GrowthPolicy>::find_next(size_type pos) const noexcept {
+    // returns the first set bit after pos, or npos if there is no such bit
+    if(++pos >= this->bits) {
+        return dynamic_bitset::npos;
+    }
+    auto i {pos / dynamic_bitset::word_bits};
+    auto word {static_cast<word_type>(this->first[i] & ~dynamic_bitset::low_mask(pos % dynamic_bitset::word_bits))};
+    for(const auto words {this->word_size()}; word == 0;) {
+        if(++i == words) {
+            return dynamic_bitset::npos;
+        }
+        word = this->first[i];
+    }
+    return i * dynamic_bitset::word_bits + static_cast<size_type>(ds::countr_zero(word));
+}
+
+/* global functions */
+template <typename Allocator, typename GrowthPolicy>
+inline constexpr void swap(dynamic_bitset<Allocator, GrowthPolicy> &lhs,
+        dynamic_bitset<Allocator, GrowthPolicy> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+template <typename Allocator, typename GrowthPolicy>
+inline constexpr bool operator==(const dynamic_bitset<Allocator, GrowthPolicy> &lhs,
+        const dynamic_bitset<Allocator, GrowthPolicy> &rhs) noexcept {
+    if(lhs.size() not_eq rhs.size()) {
+        return false;
+    }
+    const auto words {lhs.word_size()};
+    return words == 0 or
+            ds::memory_comparison(lhs.data(), rhs.data(), sizeof(typename Allocator::value_type) * words) == 0;
+}
+template <typename Allocator, typename GrowthPolicy>
+inline constexpr bool operator!=(const dynamic_bitset<Allocator, GrowthPolicy> &lhs,
+        const dynamic_bitset<Allocator, GrowthPolicy> &rhs) noexcept {
+    return not(lhs == rhs);
+}
+template <typename Allocator, typename GrowthPolicy>
+inline constexpr dynamic_bitset<Allocator, GrowthPolicy> operator&(const dynamic_bitset<Allocator, GrowthPolicy> &lhs,
+        const dynamic_bitset<Allocator, GrowthPolicy> &rhs) {
+    auto result {lhs};
+    result &= rhs;
+    return result;
+}
+template <typename Allocator, typename GrowthPolicy>
+inline constexpr dynamic_bitset<Allocator, GrowthPolicy> operator|(const dynamic_bitset<Allocator, GrowthPolicy> &lhs,
+        const dynamic_bitset<Allocator, GrowthPolicy> &rhs) {
+    auto result {lhs};
+    result |= rhs;
+    return result;
+}
+template <typename Allocator, typename GrowthPolicy>
+inline constexpr dynamic_bitset<Allocator, GrowthPolicy> operator^(const dynamic_bitset<Allocator, GrowthPolicy> &lhs,
+        const dynamic_bitset<Allocator, GrowthPolicy> &rhs) {
+    auto result {lhs};
+    result ^= rhs;
+    return result;
+}
+__DATA_STRUCTURE_END(dynamic_bitset implementation)
+
+__DATA_STRUCTURE_START(dynamic_bitset traits)
+template <typename Allocator, typename GrowthPolicy>
+struct is_trivially_relocatable<dynamic_bitset<Allocator, GrowthPolicy>> : is_trivially_relocatable<Allocator> {};
+__DATA_STRUCTURE_END(dynamic_bitset traits)
+
+}       // namespace data_structure
+
+#endif      //DATA_STRUCTURE_DYNAMIC_BITSET_HPP
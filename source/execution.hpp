@@ -0,0 +1,380 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_EXECUTION_HPP
+#define DATA_STRUCTURE_EXECUTION_HPP
+
+#include "thread_pool.hpp"
+#include "sort.hpp"
+#include "vector.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(execution policy)
+namespace execution {
+/*
+ * The parallel algorithms are executed by the global thread pool or the pool given by on(pool). A range is split
+ * into at most 8 chunks per participant and each chunk has grain elements at least, so the short ranges are
+ * processed by the calling thread alone.
+ */
+class parallel_policy {
+public:
+    using size_type = size_t;
+private:
+    static constexpr size_type default_grain {2048};
+private:
+    thread_pool *pool;
+    size_type grain;
+public:
+    constexpr parallel_policy() noexcept : pool {}, grain {parallel_policy::default_grain} {}
+public:
+    [[nodiscard]]
+    constexpr parallel_policy on(thread_pool &pool) const noexcept {
+        auto result {*this};
+        result.pool = ds::address_of(pool);
+        return result;
+    }
+    [[nodiscard]]
+    constexpr parallel_policy with_grain(size_type grain) const noexcept {
+        auto result {*this};
+        result.grain = grain == 0 ? 1 : grain;
+        return result;
+    }
+    [[nodiscard]]
+    thread_pool &executor() const {
+        return this->pool ? *this->pool : thread_pool::global();
+    }
+    [[nodiscard]]
+    constexpr size_type grain_size() const noexcept {
+        return this->grain;
+    }
+};
+inline constexpr parallel_policy par {};
+}
+__DATA_STRUCTURE_END(execution policy)
+
+__DATA_STRUCTURE_START(parallel partition)
+namespace __data_structure_implement {
+/*
+ * The chunks of a segmented range (e.g. deque's) start at the segment boundaries, so two participants never write
+ * to the same block. The chunk i is [offset(i), offset(i + 1)).
+ */
+template <typename RandomAccessIterator>
+class parallel_partition {
+private:
+    size_t size;
+    size_t chunks;
+    size_t segment_size;
+    size_t head;
+    size_t segments;
+public:
+    parallel_partition(RandomAccessIterator begin, size_t size, size_t participants, size_t grain) noexcept :
+            size {size}, chunks {size / grain}, segment_size {}, head {}, segments {} {
+        // a single participant processes the range as a whole
+        const auto max_chunks {participants == 1 ? 1 : participants * 8};
+        if(this->chunks > max_chunks) {
+            this->chunks = max_chunks;
+        }
+        if constexpr(__dsa::is_segmented_iterator_v<RandomAccessIterator>) {
+            using traits = __dsa::segmented_iterator_traits<RandomAccessIterator>;
+            if(size not_eq 0) {
+                const auto segment {traits::segment(begin)};
+                this->segment_size = static_cast<size_t>(traits::end(segment) - traits::begin(segment));
+                this->head = static_cast<size_t>(traits::local(begin) - traits::begin(segment));
+                this->segments = (this->head + size + this->segment_size - 1) / this->segment_size;
+                if(this->chunks > this->segments) {
+                    this->chunks = this->segments;
+                }
+            }
+        }
+        if(this->chunks == 0) {
+            this->chunks = 1;
+        }
+    }
+public:
+    [[nodiscard]]
+    size_t count() const noexcept {
+        return this->chunks;
+    }
+    [[nodiscard]]
+    size_t offset(size_t i) const noexcept {
+        if(i == 0) {
+            return 0;
+        }
+        if(i >= this->chunks) {
+            return this->size;
+        }
+        if(this->segment_size == 0) {
+            return i * this->size / this->chunks;
+        }
+        return i * this->segments / this->chunks * this->segment_size - this->head;
+    }
+    // rounds the offset down to the segment boundary
+    [[nodiscard]]
+    size_t align(size_t offset) const noexcept {
+        if(this->segment_size == 0) {
+            return offset;
+        }
+        const auto aligned {(this->head + offset) / this->segment_size * this->segment_size};
+        return aligned < this->head ? 0 : aligned - this->head;
+    }
+};
+template <typename RandomAccessIterator, typename Function>
+void parallel_chunks(const execution::parallel_policy &policy, RandomAccessIterator begin, size_t size,
+        Function &&f) {
+    auto &pool {policy.executor()};
+    const parallel_partition<RandomAccessIterator> partition {begin, size, pool.concurrency(), policy.grain_size()};
+    pool.run(partition.count(), [&](size_t i) {
+        f(i, partition.offset(i), partition.offset(i + 1));
+    });
+}
+
+/*
+ * The position of the k-th output of the stable merging of [a, a + m) and [b, b + n) in the first run, which is
+ * found by the binary search on the merge path, so the merging is split into the independent parts.
+ */
+template <typename Iterator, typename Compare>
+size_t merge_path(Iterator a, size_t m, Iterator b, size_t n, size_t k, Compare &compare) {
+    auto low {k > n ? k - n : 0};
+    auto high {k < m ? k : m};
+    while(low < high) {
+        const auto i {low + (high - low) / 2};
+        const auto j {k - i};
+        if(j > 0 and not compare(*(b + static_cast<ptrdiff_t>(j - 1)), *(a + static_cast<ptrdiff_t>(i)))) {
+            low = i + 1;
+        }else {
+            high = i;
+        }
+    }
+    return low;
+}
+struct merge_task {
+    size_t first;
+    size_t first_end;
+    size_t second;
+    size_t second_end;
+    size_t out;
+};
+/*
+ * The runs [offset(i), offset(i + width)) and [offset(i + width), offset(i + 2 * width)) are merged for every i of
+ * the multiples of 2 * width, a merging is split into as many parts as the runs it covers. The split positions are
+ * found before any element is moved, because the merging leaves the moved-from elements in the source.
+ */
+template <typename Partition, typename Source, typename Destination, typename Compare>
+void parallel_merge_pass(thread_pool &pool, const Partition &partition, size_t runs, size_t width, Source source,
+        Destination destination, vector<merge_task> &tasks, Compare &compare) {
+    tasks.clear();
+    for(auto i {0uz}; i < runs; i += 2 * width) {
+        const auto run_begin {partition.offset(i)};
+        const auto middle {partition.offset(i + width)};
+        const auto run_end {partition.offset(i + 2 * width)};
+        const auto first {source + static_cast<ptrdiff_t>(run_begin)};
+        const auto second {source + static_cast<ptrdiff_t>(middle)};
+        const auto m {middle - run_begin}, n {run_end - middle};
+        const auto parts {i + 2 * width < runs ? 2 * width : runs - i};
+        auto from {run_begin};
+        auto from_first {0uz};
+        for(auto part {1uz}; part <= parts; ++part) {
+            // the parts are aligned to the segments of the output as the chunks
+            const auto to {part == parts ? run_end : partition.align(run_begin + (run_end - run_begin) * part / parts)};
+            if(to > from) {
+                const auto to_first {__dsi::merge_path(first, m, second, n, to - run_begin, compare)};
+                tasks.push_back({run_begin + from_first, run_begin + to_first,
+                        middle + (from - run_begin - from_first), middle + (to - run_begin - to_first), from});
+                from = to;
+                from_first = to_first;
+            }
+        }
+    }
+    pool.run(tasks.size(), [&](size_t i) {
+        const auto &task {tasks[i]};
+        __dsi::merge_runs(source + static_cast<ptrdiff_t>(task.first), source + static_cast<ptrdiff_t>(task.first_end),
+                source + static_cast<ptrdiff_t>(task.second), source + static_cast<ptrdiff_t>(task.second_end),
+                destination + static_cast<ptrdiff_t>(task.out), compare);
+    });
+}
+/*
+ * The chunks are sorted by ds::sort in parallel, then the sorted runs are merged pairwise, the elements go back and
+ * forth between the range and a scratch buffer. Every pairwise merging is split into the parts of similar size by
+ * the merge path, so all participants work on every round, and the parts are aligned to the segments as the chunks.
+ */
+template <typename RandomAccessIterator, typename Compare>
+void parallel_sort(const execution::parallel_policy &policy, RandomAccessIterator begin, RandomAccessIterator end,
+        Compare &compare) {
+    using value_type = remove_cv_t<typename iterator_traits<RandomAccessIterator>::value_type>;
+    const auto size {static_cast<size_t>(end - begin)};
+    auto &pool {policy.executor()};
+    const parallel_partition<RandomAccessIterator> partition {begin, size, pool.concurrency(), policy.grain_size()};
+    const auto runs {partition.count()};
+    if(runs < 2 or not is_nothrow_move_constructible_v<value_type>) {
+        ds::sort(begin, end, compare);
+        return;
+    }
+    pool.run(runs, [&](size_t i) {
+        ds::sort(begin + static_cast<ptrdiff_t>(partition.offset(i)),
+                begin + static_cast<ptrdiff_t>(partition.offset(i + 1)), compare);
+    });
+    const auto scratch {allocator<value_type>::allocate(size)};
+    // the transaction is never completed, the scratch buffer is released on both the return and the exception
+    transaction trans {[&]() noexcept {
+        if constexpr(not is_trivially_copyable_v<value_type>) {
+            ds::destroy(scratch, scratch + size);
+        }
+        allocator<value_type>::deallocate(scratch, size);
+    }};
+    // the elements are moved to the scratch buffer first unless the uninitialized buffer is able to be assigned
+    auto in_scratch {not is_trivially_copyable_v<value_type>};
+    if constexpr(not is_trivially_copyable_v<value_type>) {
+        pool.run(runs, [&](size_t i) {
+            auto out {scratch + partition.offset(i)};
+            const auto last {begin + static_cast<ptrdiff_t>(partition.offset(i + 1))};
+            for(auto it {begin + static_cast<ptrdiff_t>(partition.offset(i))}; it not_eq last; ++it, ++out) {
+                ds::construct(out, ds::move(*it));
+            }
+        });
+    }
+    vector<merge_task> tasks {};
+    for(auto width {1uz}; width < runs; width *= 2, in_scratch = not in_scratch) {
+        if(in_scratch) {
+            __dsi::parallel_merge_pass(pool, partition, runs, width, scratch, begin, tasks, compare);
+        }else {
+            __dsi::parallel_merge_pass(pool, partition, runs, width, begin, scratch, tasks, compare);
+        }
+    }
+    if(in_scratch) {
+        pool.run(runs, [&](size_t i) {
+            auto source {scratch + partition.offset(i)};
+            const auto last {begin + static_cast<ptrdiff_t>(partition.offset(i + 1))};
+            for(auto it {begin + static_cast<ptrdiff_t>(partition.offset(i))}; it not_eq last; ++it, ++source) {
+                *it = ds::move(*source);
+            }
+        });
+    }
+}
+}
+__DATA_STRUCTURE_END(parallel partition)
+
+__DATA_STRUCTURE_START(parallel algorithms)
+/*
+ * The parallel overloads of for_each, transform, reduce, fill, copy and sort, the functions are called concurrently
+ * on the different elements, so they should not modify the shared states without synchronization. The exception
+ * thrown by a function is rethrown after the other chunks are finished or skipped. The overloads of the random
+ * access ranges (e.g. ds::vector, ds::array and ds::deque) are equivalent to the ones of their iterators. A chunk is
+ * processed by the serial algorithm, so the chunks of ds::deque are walked block by block as well.
+ */
+template <IsRandomAccessIterator RandomAccessIterator, typename Function>
+void for_each(const execution::parallel_policy &policy, RandomAccessIterator begin, RandomAccessIterator end,
+        Function f) {
+    __dsi::parallel_chunks(policy, begin, static_cast<size_t>(end - begin), [&](size_t, size_t from, size_t to) {
+        ds::for_each(begin + static_cast<ptrdiff_t>(from), begin + static_cast<ptrdiff_t>(to), [&f](auto &&value) {
+            f(value);
+        });
+    });
+}
+template <IsRandomAccessIterator RandomAccessIterator, IsRandomAccessIterator OutputIterator, typename Operation>
+OutputIterator transform(const execution::parallel_policy &policy, RandomAccessIterator begin,
+        RandomAccessIterator end, OutputIterator out, Operation op) {
+    const auto size {end - begin};
+    __dsi::parallel_chunks(policy, begin, static_cast<size_t>(size), [&](size_t, size_t from, size_t to) {
+        const auto last {begin + static_cast<ptrdiff_t>(to)};
+        auto result {out + static_cast<ptrdiff_t>(from)};
+        for(auto it {begin + static_cast<ptrdiff_t>(from)}; it not_eq last; ++it, static_cast<void>(++result)) {
+            *result = op(*it);
+        }
+    });
+    return out + size;
+}
+/*
+ * The operation should be associative, the partial results of the chunks are combined in order, so it's not
+ * necessary to be commutative.
+ */
+template <IsRandomAccessIterator RandomAccessIterator, typename T, typename Operation = plus<>>
+T reduce(const execution::parallel_policy &policy, RandomAccessIterator begin, RandomAccessIterator end, T init,
+        Operation op = {}) {
+    const auto size {static_cast<size_t>(end - begin)};
+    if(size == 0) {
+        return init;
+    }
+    auto &pool {policy.executor()};
+    const __dsi::parallel_partition<RandomAccessIterator> partition {begin, size, pool.concurrency(),
+            policy.grain_size()};
+    vector<T> partial_results(partition.count(), init);
+    pool.run(partition.count(), [&](size_t i) {
+        const auto it {begin + static_cast<ptrdiff_t>(partition.offset(i))};
+        const auto last {begin + static_cast<ptrdiff_t>(partition.offset(i + 1))};
+        partial_results[i] = ds::accumulate(it + 1, last, T(*it), op);
+    });
+    for(auto &result : partial_results) {
+        init = op(ds::move(init), ds::move(result));
+    }
+    return init;
+}
+template <IsRandomAccessIterator RandomAccessIterator, typename T>
+void fill(const execution::parallel_policy &policy, RandomAccessIterator begin, RandomAccessIterator end,
+        const T &value) {
+    __dsi::parallel_chunks(policy, begin, static_cast<size_t>(end - begin), [&](size_t, size_t from, size_t to) {
+        ds::fill(begin + static_cast<ptrdiff_t>(from), begin + static_cast<ptrdiff_t>(to), value);
+    });
+}
+template <IsRandomAccessIterator RandomAccessIterator, IsRandomAccessIterator OutputIterator>
+OutputIterator copy(const execution::parallel_policy &policy, RandomAccessIterator begin, RandomAccessIterator end,
+        OutputIterator out) {
+    const auto size {end - begin};
+    __dsi::parallel_chunks(policy, begin, static_cast<size_t>(size), [&](size_t, size_t from, size_t to) {
+        ds::copy(begin + static_cast<ptrdiff_t>(from), begin + static_cast<ptrdiff_t>(to),
+                out + static_cast<ptrdiff_t>(from));
+    });
+    return out + size;
+}
+template <IsRandomAccessIterator RandomAccessIterator, typename Compare = less<>>
+void sort(const execution::parallel_policy &policy, RandomAccessIterator begin, RandomAccessIterator end,
+        Compare compare = {}) {
+    __dsi::parallel_sort(policy, begin, end, compare);
+}
+
+template <IsRange Range, typename Function> requires IsRandomAccessIterator<range_iterator_t<Range>>
+inline void for_each(const execution::parallel_policy &policy, Range &&range, Function f) {
+    ds::for_each(policy, ds::begin(range), ds::end(range), ds::move(f));
+}
+template <IsRange Range, IsRandomAccessIterator OutputIterator, typename Operation>
+        requires IsRandomAccessIterator<range_iterator_t<Range>>
+inline OutputIterator transform(const execution::parallel_policy &policy, Range &&range, OutputIterator out,
+        Operation op) {
+    return ds::transform(policy, ds::begin(range), ds::end(range), out, ds::move(op));
+}
+template <IsRange Range, typename T, typename Operation = plus<>>
+        requires IsRandomAccessIterator<range_iterator_t<Range>>
+inline T reduce(const execution::parallel_policy &policy, Range &&range, T init, Operation op = {}) {
+    return ds::reduce(policy, ds::begin(range), ds::end(range), ds::move(init), ds::move(op));
+}
+template <IsRange Range, typename T> requires IsRandomAccessIterator<range_iterator_t<Range>>
+inline void fill(const execution::parallel_policy &policy, Range &&range, const T &value) {
+    ds::fill(policy, ds::begin(range), ds::end(range), value);
+}
+template <IsRange Range, IsRandomAccessIterator OutputIterator>
+        requires IsRandomAccessIterator<range_iterator_t<Range>>
+inline OutputIterator copy(const execution::parallel_policy &policy, Range &&range, OutputIterator out) {
+    return ds::copy(policy, ds::begin(range), ds::end(range), out);
+}
+template <IsRange Range, typename Compare = less<>> requires IsRandomAccessIterator<range_iterator_t<Range>>
+inline void sort(const execution::parallel_policy &policy, Range &&range, Compare compare = {}) {
+    ds::sort(policy, ds::begin(range), ds::end(range), ds::move(compare));
+}
+__DATA_STRUCTURE_END(parallel algorithms)
+
+}       // namespace data_structure
+
+#endif      // DATA_STRUCTURE_EXECUTION_HPP
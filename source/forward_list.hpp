@@ -22,13 +22,16 @@
 namespace data_structure {
 
 __DATA_STRUCTURE_START(forward_list declaration)
-template <typename T, typename Allocator = allocator<T>>
+template <typename T, typename Allocator = allocator<T>,
+        typename NodeAllocator = __dsa::forward_list_node_allocator<T, __dsa::forward_list_node, Allocator>>
 class forward_list {
 private:
     using node_type = __dsa::forward_list_node<T> *;
-    using real_allocator = __dsa::forward_list_node_allocator<T, __dsa::forward_list_node, Allocator>;
+    using real_allocator = conditional_t<is_void_v<NodeAllocator>,
+            typename allocator_traits<Allocator>::template rebind<__dsa::forward_list_node<T>>, NodeAllocator>;
 public:
     using allocator_type = Allocator;
+    using node_allocator_type = real_allocator;
     using size_type = typename Allocator::size_type;
     using difference_type = typename Allocator::difference_type;
     using value_type = T;
@@ -56,6 +59,7 @@ public:
     constexpr forward_list()  noexcept(is_nothrow_default_constructible_v<real_allocator>) = default;
     explicit constexpr forward_list(const Allocator &)
             noexcept(is_nothrow_constructible_v<real_allocator, const Allocator &>);
+    explicit constexpr forward_list(const node_allocator_type &) noexcept;
     explicit constexpr forward_list(size_type, const Allocator & = {});
     constexpr forward_list(size_type, const_reference, const Allocator & = {});
     template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
@@ -109,6 +113,8 @@ public:
     constexpr const_reference front() const noexcept;
     [[nodiscard]]
     constexpr Allocator allocator() const noexcept;
+    [[nodiscard]]
+    constexpr node_allocator_type node_allocator() const noexcept;
     constexpr void push_front(const_reference);
     constexpr void push_front(rvalue_reference);
     template <typename ...Args>
@@ -134,16 +140,20 @@ public:
     constexpr iterator insert_after(const_iterator, ForwardIterator, ForwardIterator);
     constexpr iterator insert(size_type, initializer_list<T>);
     constexpr iterator insert_after(const_iterator, initializer_list<T>);
+    template <IsRange Range>
+    constexpr void append_range(Range &&);
     constexpr iterator erase(size_type, size_type = 1);
     constexpr iterator erase_after(const_iterator, size_type);
     constexpr iterator erase_after(const_iterator);
     constexpr iterator erase_after(const_iterator, const_iterator);
 };
-template <typename T, typename Allocator>
-inline constexpr void swap(forward_list<T, Allocator> &, forward_list<T, Allocator> &) noexcept;
+template <typename T, typename Allocator, typename NodeAllocator>
+inline constexpr void swap(forward_list<T, Allocator, NodeAllocator> &,
+        forward_list<T, Allocator, NodeAllocator> &) noexcept;
 // Todo : wait for header "compare.hpp"?
-/*template <typename T, typename Allocator>
-inline constexpr some_ordering operator<=>(forward_list<T, Allocator> &, forward_list<T, Allocator> &)
+/*template <typename T, typename Allocator, typename NodeAllocator>
+inline constexpr some_ordering operator<=>(forward_list<T, Allocator, NodeAllocator> &,
+        forward_list<T, Allocator, NodeAllocator> &)
         noexcept(is_nothrow_three_way_comparable_v<T>);*/
 __DATA_STRUCTURE_END(forward_list declaration)
 
@@ -199,10 +209,10 @@ struct forward_list_allocation_handler<NodeType, Allocator, false> {
 }
 
 /* private functions */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
-constexpr typename forward_list<T, Allocator>::node_type
-forward_list<T, Allocator>::allocate_values(size_type n, node_type link_to, Args &&...args) {
+constexpr typename forward_list<T, Allocator, NodeAllocator>::node_type
+forward_list<T, Allocator, NodeAllocator>::allocate_values(size_type n, node_type link_to, Args &&...args) {
     auto &allocator {this->node_size.allocator()};
     if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
         return allocator.allocate_with_value(n, link_to, ds::forward<Args>(args)...);
@@ -223,10 +233,10 @@ forward_list<T, Allocator>::allocate_values(size_type n, node_type link_to, Args
     trans.complete();
     return result_node;
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator>
-constexpr typename forward_list<T, Allocator>::node_type
-forward_list<T, Allocator>::allocate_range(size_type n, node_type link_to, InputIterator begin) {
+constexpr typename forward_list<T, Allocator, NodeAllocator>::node_type
+forward_list<T, Allocator, NodeAllocator>::allocate_range(size_type n, node_type link_to, InputIterator begin) {
     auto &allocator {this->node_size.allocator()};
     if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
         return allocator.allocate_with_range(n, link_to, begin);
@@ -247,8 +257,8 @@ forward_list<T, Allocator>::allocate_range(size_type n, node_type link_to, Input
     trans.complete();
     return result_node;
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::deallocate_nodes(node_type begin, node_type end) noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::deallocate_nodes(node_type begin, node_type end) noexcept {
     if constexpr(is_trivially_destructible_v<T>) {
         this->node_size.allocator().deallocate(begin, end);
     }else {
@@ -259,21 +269,26 @@ constexpr void forward_list<T, Allocator>::deallocate_nodes(node_type begin, nod
         this->node_size.allocator().deallocate(begin, end, n);
     }
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::deallocate_nodes(node_type begin, size_type n) noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::deallocate_nodes(node_type begin, size_type n) noexcept {
+    if(n == 0) {
+        return;
+    }
     if constexpr(is_trivially_destructible_v<T>) {
         this->node_size.allocator().deallocate(begin, n);
     }else {
         auto end {begin};
-        for(auto i {1}; i < n; ++i, static_cast<void>(end = end->next->node())) {
+        ds::destroy(ds::address_of(end->value));
+        for(auto i {1uz}; i < n; ++i) {
+            end = end->next->node();
             ds::destroy(ds::address_of(end->value));
         }
         this->node_size.allocator().deallocate(begin, end, n);
     }
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::erase(const_iterator begin, const_iterator end, size_type n) noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::erase(const_iterator begin, const_iterator end, size_type n) noexcept {
     if(n == 0) {
         return iterator {begin.node->next};
     }
@@ -285,72 +300,80 @@ forward_list<T, Allocator>::erase(const_iterator begin, const_iterator end, size
 }
 
 /* public functions */
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(const Allocator &allocator)
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(const Allocator &allocator)
         noexcept(is_nothrow_constructible_v<real_allocator, const Allocator &>) :
         head {}, node_size(real_allocator {allocator}) {}
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(size_type n, const Allocator &allocator) :
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(const node_allocator_type &allocator) noexcept :
+        head {}, node_size(0, allocator) {}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(size_type n, const Allocator &allocator) :
         head {}, node_size(n, real_allocator {allocator}) {
     auto first_node {this->allocate_values(n, nullptr)};
     this->head.next = first_node;
 }
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(size_type n, const_reference value, const Allocator &allocator) :
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(size_type n, const_reference value,
+        const Allocator &allocator) :
         head {}, node_size(n, real_allocator {allocator}) {
     auto first_node {this->allocate_values(n, nullptr, value)};
     this->head.next = first_node;
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr forward_list<T, Allocator>::forward_list(InputIterator begin, InputIterator end,
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(InputIterator begin, InputIterator end,
         const Allocator &allocator, size_type default_size) : head {}, node_size(real_allocator {allocator}) {
     buffer<T, Allocator> b(begin, end, allocator, default_size);
     auto first_node {this->allocate_range(this->node_size() = b.size(), nullptr, b.mbegin())};
     this->head.next = first_node;
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
-constexpr forward_list<T, Allocator>::forward_list(ForwardIterator begin, ForwardIterator end,
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(ForwardIterator begin, ForwardIterator end,
         const Allocator &allocator) : head {}, node_size(real_allocator {allocator}) {
     auto first_node {this->allocate_range(this->node_size() = static_cast<size_type>(ds::distance(begin, end)),
             nullptr, begin)};
     this->head.next = first_node;
 }
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(initializer_list<T> init_list, const Allocator &allocator) :
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(initializer_list<T> init_list,
+        const Allocator &allocator) :
         forward_list(init_list.begin(), init_list.end(), allocator) {}
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(const forward_list &rhs) :
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(const forward_list &rhs) :
         forward_list(rhs.cbegin(), rhs.cend(), rhs.node_size.allocator()) {}
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(const forward_list &rhs, const Allocator &allocator) :
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(const forward_list &rhs, const Allocator &allocator) :
         forward_list(rhs.cbegin(), rhs.cend(), allocator) {}
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(forward_list &&rhs) noexcept : head {ds::move(rhs.head)},
-        node_size {ds::move(rhs.node_size)} {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(forward_list &&rhs) noexcept :
+        head {ds::move(rhs.head)}, node_size {ds::move(rhs.node_size)} {
     rhs.head.next = nullptr;
     rhs.node_size() = 0;
 }
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::forward_list(forward_list &&rhs, const Allocator &allocator) noexcept :
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::forward_list(forward_list &&rhs,
+        const Allocator &allocator) noexcept :
         head {ds::move(rhs.head)}, node_size(ds::move(rhs.node_size()), allocator) {
     rhs.head = nullptr;
     rhs.node_size() = 0;
 }
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator>::~forward_list() noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator>::~forward_list() noexcept {
     this->deallocate_nodes(this->head.next->node(), this->node_size());
 }
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(const forward_list &rhs) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator> &
+forward_list<T, Allocator, NodeAllocator>::operator=(const forward_list &rhs) {
     if(this not_eq &rhs) {
         this->assign(rhs.cbegin(), rhs.cend());
     }
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(forward_list &&rhs) noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator> &
+forward_list<T, Allocator, NodeAllocator>::operator=(forward_list &&rhs) noexcept {
     if (this not_eq &rhs) {
         this->deallocate_nodes(this->head.next->node(), this->node_size());
         this->head = ds::move(rhs.head);
@@ -360,13 +383,14 @@ constexpr forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(forw
     }
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr forward_list<T, Allocator> &forward_list<T, Allocator>::operator=(initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr forward_list<T, Allocator, NodeAllocator> &
+forward_list<T, Allocator, NodeAllocator>::operator=(initializer_list<T> init_list) {
     this->assign(init_list.begin(), init_list.end());
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::assign(size_type n, const_reference value) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::assign(size_type n, const_reference value) {
     const auto size {this->node_size()};
     if(n >= size) {
         for(auto it {this->head.next}; it; it = it->next) {
@@ -386,15 +410,16 @@ constexpr void forward_list<T, Allocator>::assign(size_type n, const_reference v
         it->next = nullptr;
     }
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr void forward_list<T, Allocator>::assign(InputIterator begin, InputIterator end, size_type default_size) {
+constexpr void forward_list<T, Allocator, NodeAllocator>::assign(InputIterator begin, InputIterator end,
+        size_type default_size) {
     buffer<T, Allocator> b(begin, end, static_cast<Allocator &>(this->node_size.allocator()), default_size);
     this->assign(b.mbegin(), b.mend());
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
-constexpr void forward_list<T, Allocator>::assign(ForwardIterator begin, ForwardIterator end) {
+constexpr void forward_list<T, Allocator, NodeAllocator>::assign(ForwardIterator begin, ForwardIterator end) {
     const auto n {static_cast<size_type>(ds::distance(begin, end))};
     const auto size {this->node_size()};
     if(n >= size) {
@@ -416,62 +441,70 @@ constexpr void forward_list<T, Allocator>::assign(ForwardIterator begin, Forward
         it->next = nullptr;
     }
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::assign(initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::assign(initializer_list<T> init_list) {
     this->assign(init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::before_begin() noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::before_begin() noexcept {
     return iterator {&this->head};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::const_iterator
-forward_list<T, Allocator>::before_begin() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::const_iterator
+forward_list<T, Allocator, NodeAllocator>::before_begin() const noexcept {
     return const_iterator {const_cast<__dsa::forward_list_base_node<__dsa::forward_list_node<T>> *>(&this->head)};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::const_iterator
-forward_list<T, Allocator>::cbefore_begin() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::const_iterator
+forward_list<T, Allocator, NodeAllocator>::cbefore_begin() const noexcept {
     return const_iterator {const_cast<__dsa::forward_list_base_node<__dsa::forward_list_node<T>> *>(&this->head)};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::begin() noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::begin() noexcept {
     return iterator {this->head.next};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::begin() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::const_iterator
+forward_list<T, Allocator, NodeAllocator>::begin() const noexcept {
     return const_iterator {this->head.next};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cbegin() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::const_iterator
+forward_list<T, Allocator, NodeAllocator>::cbegin() const noexcept {
     return const_iterator {this->head.next};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::end() noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::end() noexcept {
     return {};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::end() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::const_iterator
+forward_list<T, Allocator, NodeAllocator>::end() const noexcept {
     return {};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::const_iterator forward_list<T, Allocator>::cend() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::const_iterator
+forward_list<T, Allocator, NodeAllocator>::cend() const noexcept {
     return {};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::size_type forward_list<T, Allocator>::size() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::size_type
+forward_list<T, Allocator, NodeAllocator>::size() const noexcept {
     return this->node_size();
 }
-template <typename T, typename Allocator>
-constexpr bool forward_list<T, Allocator>::empty() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr bool forward_list<T, Allocator, NodeAllocator>::empty() const noexcept {
     return this->node_size() == 0;
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::resize(size_type n) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::resize(size_type n) {
     this->resize(n, {});
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::resize(size_type n, const_reference value) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::resize(size_type n, const_reference value) {
     const auto size {this->node_size()};
     if(n > size) {
         const auto new_first_node {this->allocate_values(n - size, nullptr, value)};
@@ -486,64 +519,71 @@ constexpr void forward_list<T, Allocator>::resize(size_type n, const_reference v
     }
     this->node_size() = n;
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::reference forward_list<T, Allocator>::front() noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::reference
+forward_list<T, Allocator, NodeAllocator>::front() noexcept {
     return this->head.next->value();
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::const_reference forward_list<T, Allocator>::front() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::const_reference
+forward_list<T, Allocator, NodeAllocator>::front() const noexcept {
     return this->head.next->value();
 }
-template <typename T, typename Allocator>
-constexpr Allocator forward_list<T, Allocator>::allocator() const noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr Allocator forward_list<T, Allocator, NodeAllocator>::allocator() const noexcept {
     if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
         return this->node_size.allocator();
     }
     return {};
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::push_front(const_reference value) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::node_allocator_type
+forward_list<T, Allocator, NodeAllocator>::node_allocator() const noexcept {
+    return this->node_size.allocator();
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::push_front(const_reference value) {
     this->emplace_front(value);
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::push_front(rvalue_reference value) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::push_front(rvalue_reference value) {
     this->emplace_front(ds::move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
-constexpr void forward_list<T, Allocator>::emplace_front(Args &&...args) {
+constexpr void forward_list<T, Allocator, NodeAllocator>::emplace_front(Args &&...args) {
     this->head.next = this->allocate_values(1, this->head.next->node(), ds::forward<Args>(args)...);
     this->node_size() += 1;
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::pop_front() noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::pop_front() noexcept {
     auto backup {this->head.next};
     this->head.next = backup->next;
     this->deallocate_nodes(backup->node(), 1);
     this->node_size() -= 1;
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::clear() noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::clear() noexcept {
     this->deallocate_nodes(this->head.next->node(), this->node_size());
     this->head.next = nullptr;
     this->node_size() = 0;
 }
-template <typename T, typename Allocator>
-constexpr void forward_list<T, Allocator>::swap(forward_list &rhs) noexcept {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void forward_list<T, Allocator, NodeAllocator>::swap(forward_list &rhs) noexcept {
     using ds::swap;
     swap(this->head, rhs.head);
     swap(this->node_size, rhs.node_size);
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert(size_type pos, const_reference value, size_type n) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert(size_type pos, const_reference value, size_type n) {
     auto begin {this->cbefore_begin()};
     for(; pos not_eq 0; --pos, static_cast<void>(++begin));
     return this->insert_after(begin, value, n);
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert_after(const_iterator pos, const_reference value, size_type n) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert_after(const_iterator pos, const_reference value, size_type n) {
     if(n == 0) {
         return iterator {pos.node->next->node()};
     }
@@ -552,51 +592,54 @@ forward_list<T, Allocator>::insert_after(const_iterator pos, const_reference val
     this->node_size() += n;
     return iterator {new_first_node};
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::emplace(size_type pos, Args &&...args) {
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::emplace(size_type pos, Args &&...args) {
     auto begin {this->cbefore_begin()};
     for(; pos not_eq 0; --pos, static_cast<void>(++begin));
     return this->emplace_after(begin, ds::forward<Args>(args)...);
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::emplace_after(const_iterator pos, Args &&...args) {
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::emplace_after(const_iterator pos, Args &&...args) {
     const auto new_first_node {this->allocate_values(1, pos.node->next->node(), ds::forward<Args>(args)...)};
     pos.node->next = new_first_node;
     ++this->node_size();
     return iterator {new_first_node};
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert(
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert(
         size_type pos, InputIterator begin, InputIterator end, size_type default_size) {
     auto list_begin {this->cbefore_begin()};
     for(; pos not_eq 0; --pos, static_cast<void>(++list_begin));
     buffer<T, Allocator> b(begin, end, static_cast<Allocator &>(this->node_size.allocator()), default_size);
     return this->insert_after(list_begin, b.mbegin(), b.mend());
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr typename forward_list<T, Allocator>::iterator forward_list<T, Allocator>::insert_after(
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert_after(
         const_iterator pos, InputIterator begin, InputIterator end, size_type default_size) {
     buffer<T, Allocator> b(begin, end, static_cast<Allocator &>(this->node_size.allocator()), default_size);
     return this->insert_after(pos, b.mbegin(), b.mend());
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert(size_type pos, ForwardIterator begin, ForwardIterator end) {
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert(size_type pos, ForwardIterator begin, ForwardIterator end) {
     auto list_begin {this->cbefore_begin()};
     for(; pos not_eq 0; --pos, static_cast<void>(++list_begin));
     return this->insert_after(list_begin, begin, end);
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert_after(const_iterator pos, ForwardIterator begin, ForwardIterator end) {
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert_after(const_iterator pos, ForwardIterator begin,
+        ForwardIterator end) {
     if(begin == end) {
         return iterator {pos.node->next->node()};
     }
@@ -606,43 +649,59 @@ forward_list<T, Allocator>::insert_after(const_iterator pos, ForwardIterator beg
     this->node_size() += n;
     return iterator {new_first_node};
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert(size_type pos, initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert(size_type pos, initializer_list<T> init_list) {
     auto begin {this->cbefore_begin()};
     for(; pos not_eq 0; --pos, static_cast<void>(++begin));
     return this->insert_after(begin, init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::insert_after(const_iterator pos, initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::insert_after(const_iterator pos, initializer_list<T> init_list) {
     return this->insert_after(pos, init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::erase(size_type pos, size_type n) {
+template <typename T, typename Allocator, typename NodeAllocator>
+template <IsRange Range>
+constexpr void forward_list<T, Allocator, NodeAllocator>::append_range(Range &&range) {
+    // forward_list doesn't record the last node, so finding it is linear
+    auto last {this->cbefore_begin()};
+    for(auto size {this->size()}; size not_eq 0; --size, static_cast<void>(++last));
+    if constexpr(is_forward_iterator_v<range_iterator_t<Range>>) {
+        const auto n {static_cast<size_type>(ds::range_size(range))};
+        if(n not_eq 0) {
+            last.node->next = this->allocate_range(n, nullptr, ds::begin(range));
+            this->node_size() += n;
+        }
+    }else {
+        this->insert_after(last, ds::begin(range), ds::end(range));
+    }
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::erase(size_type pos, size_type n) {
     auto begin {this->cbefore_begin()};
     for(size_type i {0}; i not_eq pos; ++i, static_cast<void>(++begin));
     auto end {begin};
     for(size_type i {0}; i not_eq n; ++i, static_cast<void>(++end));
     return this->erase(begin, end, n);
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::erase_after(const_iterator pos, size_type n) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::erase_after(const_iterator pos, size_type n) {
     auto end_pos {pos};
     for(size_type i {0}; i not_eq n; ++i, static_cast<void>(++end_pos));
     return this->erase(pos, end_pos, n);
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::erase_after(const_iterator pos) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::erase_after(const_iterator pos) {
     auto end_pos {pos};
     return this->erase(pos, ++end_pos, 1);
 }
-template <typename T, typename Allocator>
-constexpr typename forward_list<T, Allocator>::iterator
-forward_list<T, Allocator>::erase_after(const_iterator begin, const_iterator end) {
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename forward_list<T, Allocator, NodeAllocator>::iterator
+forward_list<T, Allocator, NodeAllocator>::erase_after(const_iterator begin, const_iterator end) {
     return this->erase(begin, end, static_cast<size_type>(ds::distance(begin, end)));
 }
 __DATA_STRUCTURE_END(forward_list implementation)
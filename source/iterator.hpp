@@ -182,6 +182,51 @@ inline constexpr InputIterator advance(InputIterator begin, typename iterator_tr
 }
 __DATA_STRUCTURE_END(iterator functions)
 
+__DATA_STRUCTURE_START(range)
+template <typename Range>
+[[nodiscard]]
+inline constexpr auto begin(Range &range) noexcept(noexcept(range.begin())) -> decltype(range.begin()) {
+    return range.begin();
+}
+template <typename T, size_t N>
+[[nodiscard]]
+inline constexpr T *begin(T (&array)[N]) noexcept {
+    return array;
+}
+template <typename Range>
+[[nodiscard]]
+inline constexpr auto end(Range &range) noexcept(noexcept(range.end())) -> decltype(range.end()) {
+    return range.end();
+}
+template <typename T, size_t N>
+[[nodiscard]]
+inline constexpr T *end(T (&array)[N]) noexcept {
+    return array + N;
+}
+template <typename Range>
+using range_iterator_t = decltype(ds::begin(declval<Range &>()));
+template <typename Range>
+concept IsRange = requires(Range &range) {
+    ds::begin(range);
+    ds::end(range);
+} and is_input_iterator_v<range_iterator_t<Range>>;
+template <typename Range>
+concept IsForwardRange = IsRange<Range> and is_forward_iterator_v<range_iterator_t<Range>>;
+/*
+ * The count of elements of a forward range, it's constant time for the range with member function size or
+ * with random access iterator
+ */
+template <IsForwardRange Range>
+[[nodiscard]]
+inline constexpr size_t range_size(Range &range) {
+    if constexpr(requires { range.size(); }) {
+        return static_cast<size_t>(range.size());
+    }else {
+        return static_cast<size_t>(ds::distance(ds::begin(range), ds::end(range)));
+    }
+}
+__DATA_STRUCTURE_END(range)
+
 __DATA_STRUCTURE_START(wrap iterator)
 template <typename Iterator> requires is_pointer_v<Iterator>
 class wrap_iterator {
@@ -252,11 +297,11 @@ public:
         this->iterator += -n;
         return *this;
     }
-    constexpr wrap_iterator operator+(difference_type n) noexcept {
+    constexpr wrap_iterator operator+(difference_type n) const noexcept {
         auto backup {*this};
         return backup += n;
     }
-    constexpr wrap_iterator operator-(difference_type n) noexcept {
+    constexpr wrap_iterator operator-(difference_type n) const noexcept {
         auto backup {*this};
         return backup += -n;
     }
@@ -599,12 +644,76 @@ inline constexpr auto operator-(const move_iterator<Iterator> &lhs, const move_i
 }
 __DATA_STRUCTURE_END(move iterator)
 
+__DATA_STRUCTURE_START(reserved back insert iterator)
+/*
+ * An output iterator which appends elements by Container::unchecked_push_back, the capacity should be
+ * reserved before writing, so reserved_back_inserter is preferred to construct it. reserved_back_inserter
+ * grows the capacity by Container::growth_policy if there is, otherwise by doubling
+ */
+template <typename Container>
+class reserved_back_insert_iterator {
+public:
+    using container_type = Container;
+    using size_type = typename Container::size_type;
+    using difference_type = typename Container::difference_type;
+    using value_type = typename Container::value_type;
+    using iterator_category = output_iterator_tag;
+private:
+    Container *container;
+public:
+    explicit constexpr reserved_back_insert_iterator(Container &container) noexcept :
+            container {ds::address_of(container)} {}
+    constexpr reserved_back_insert_iterator(const reserved_back_insert_iterator &) noexcept = default;
+    constexpr reserved_back_insert_iterator(reserved_back_insert_iterator &&) noexcept = default;
+    constexpr ~reserved_back_insert_iterator() noexcept = default;
+public:
+    constexpr reserved_back_insert_iterator &operator=(const reserved_back_insert_iterator &) noexcept = default;
+    constexpr reserved_back_insert_iterator &operator=(reserved_back_insert_iterator &&) noexcept = default;
+    constexpr reserved_back_insert_iterator &operator=(const value_type &value) {
+        this->container->unchecked_push_back(value);
+        return *this;
+    }
+    constexpr reserved_back_insert_iterator &operator=(value_type &&value) {
+        this->container->unchecked_push_back(ds::move(value));
+        return *this;
+    }
+    [[nodiscard]]
+    constexpr reserved_back_insert_iterator &operator*() noexcept {
+        return *this;
+    }
+    constexpr reserved_back_insert_iterator &operator++() & noexcept {
+        return *this;
+    }
+    constexpr reserved_back_insert_iterator &operator++(int) & noexcept {
+        return *this;
+    }
+};
+template <typename Container>
+[[nodiscard]]
+inline constexpr reserved_back_insert_iterator<Container>
+reserved_back_inserter(Container &container, typename Container::size_type n) {
+    // the capacity grows geometrically, so the repeated batches are appended in amortized constant time
+    const auto size {container.size()};
+    const auto capacity {container.capacity()};
+    if(capacity - size < n) {
+        if constexpr(requires {typename Container::growth_policy;}) {
+            container.reserve(Container::growth_policy::template next_capacity<typename Container::value_type>(
+                    capacity, size + n));
+        }else {
+            container.reserve(capacity * 2 < size + n ? size + n : capacity * 2);
+        }
+    }
+    return reserved_back_insert_iterator<Container> {container};
+}
+__DATA_STRUCTURE_END(reserved back insert iterator)
+
 __DATA_STRUCTURE_START(inner tools for data structure)
 
 __DATA_STRUCTURE_START(container forward declaration)
-template <typename, typename> class forward_list;
+template <typename, typename, typename> class forward_list;
 template <typename, typename, typename> class list;
-template <typename, typename> class deque;
+template <typename, typename, size_t> class deque;
+template <typename, typename> class dynamic_bitset;
 __DATA_STRUCTURE_END(container forward declaration)
 
 namespace __data_structure_auxiliary {
@@ -632,7 +741,7 @@ class forward_list_iterator {
     template <typename ValueType, bool IsConstLHS, bool IsConstRHS>
     friend constexpr bool operator==(const forward_list_iterator<ValueType, IsConstLHS> &,
             const forward_list_iterator<ValueType, IsConstRHS> &) noexcept;
-    template <typename, typename> friend class forward_list;
+    template <typename, typename, typename> friend class data_structure::forward_list;
 private:
     using node_type = forward_list_base_node<forward_list_node<T>> *;
 public:
@@ -751,7 +860,7 @@ class list_iterator {
     template <typename ValueType, bool IsConstLHS, bool IsConstRHS>
     friend constexpr bool operator==(const list_iterator<ValueType, IsConstLHS> &,
             const list_iterator<ValueType, IsConstRHS> &) noexcept;
-    template <typename, typename> friend class list;
+    template <typename, typename, typename> friend class data_structure::list;
 private:
     using node_type = list_base_node<list_node<T>> *;
 public:
@@ -832,15 +941,24 @@ inline constexpr bool operator!=(const list_iterator<T, IsConstLHS> &lhs,
 __DATA_STRUCTURE_END(data structure special iterator, list iterator)
 
 __DATA_STRUCTURE_START(data structure special iterator, deque_iterator)
-template <typename T, bool IsConst = false>
+template <typename> struct segmented_iterator_traits;
+/*
+ * The default count of elements of a block of deque, the blocks of the elements less than 256 bytes are 4 KiB
+ */
+template <typename T>
+inline constexpr size_t deque_default_block_size {sizeof(T) < 256 ? 4096 / sizeof(T) : 16};
+template <typename T, bool IsConst = false, size_t BlockSize = deque_default_block_size<T>>
 class deque_iterator {
-    template <typename Type, bool IsConstLHS, bool IsConstRHS>
-    friend constexpr bool operator==(const deque_iterator<Type, IsConstLHS> &,
-            const deque_iterator<Type, IsConstRHS> &) noexcept;
-    template <typename Type, bool IsConstLHS, bool IsConstRHS>
-    friend constexpr bool operator<(const deque_iterator<Type, IsConstLHS> &,
-            const deque_iterator<Type, IsConstRHS> &) noexcept;
-    template <typename, typename> friend class deque;
+    static_assert(BlockSize > 0, "The block size of deque should be positive!");
+    template <typename Type, bool IsConstLHS, bool IsConstRHS, size_t Size>
+    friend constexpr bool operator==(const deque_iterator<Type, IsConstLHS, Size> &,
+            const deque_iterator<Type, IsConstRHS, Size> &) noexcept;
+    template <typename Type, bool IsConstLHS, bool IsConstRHS, size_t Size>
+    friend constexpr ptrdiff_t operator-(const deque_iterator<Type, IsConstLHS, Size> &,
+            const deque_iterator<Type, IsConstRHS, Size> &) noexcept;
+    template <typename, typename, size_t> friend class data_structure::deque;
+    template <typename, bool, size_t> friend class deque_iterator;
+    template <typename> friend struct segmented_iterator_traits;
 public:
     using iterator_type = deque_iterator;
     using size_type = size_t;
@@ -848,16 +966,15 @@ public:
     using value_type = T;
     using iterator_category = random_access_iterator_tag;
 private:
-    static constexpr auto block_size {sizeof(T) < 256 ? 4096 / sizeof(T) : 16};
+    static constexpr auto block_size {BlockSize};
 private:
     T **map;
     T *now;
 public:
     constexpr deque_iterator() noexcept = default;
     constexpr deque_iterator(T **map, T *now) noexcept : map {map}, now {now} {}
-    template <typename U> requires is_same_v<U, deque_iterator<T, false>>
-    constexpr deque_iterator(enable_if_t<IsConst, const U &> non_const_iterator) : map {non_const_iterator.map},
-            now {non_const_iterator.now} {}
+    constexpr deque_iterator(const deque_iterator<T, false, BlockSize> &non_const_iterator) noexcept requires IsConst :
+            map {non_const_iterator.map}, now {non_const_iterator.now} {}
     constexpr deque_iterator(const deque_iterator &) noexcept = default;
     constexpr deque_iterator(deque_iterator &&) noexcept = default;
     constexpr ~deque_iterator() noexcept = default;
@@ -917,17 +1034,18 @@ public:
         return backup;
     }
     constexpr deque_iterator &operator+=(difference_type n) noexcept {
-        if(n not_eq 0) {
-            n += this->now - *this->map;
-            if(n > 0) {
-                this->map += n / this->block_size;
-                this->now = *this->map + n % this->block_size;
-            }else {
-                if(n < 0) {
-                    this->map += n / this->block_size - 1;
-                }
-                this->now = *this->map + (this->block_size + n % this->block_size);
-            }
+        constexpr auto block_size {static_cast<difference_type>(deque_iterator::block_size)};
+        if(n == 0) {
+            return *this;
+        }
+        const auto offset {n + (this->now - *this->map)};
+        if(offset >= 0 and offset < block_size) {
+            this->now += n;
+        }else {
+            // rounding towards negative infinity, so the offset in the new block is never negative
+            const auto blocks {offset > 0 ? offset / block_size : -((-offset - 1) / block_size) - 1};
+            this->map += blocks;
+            this->now = *this->map + (offset - blocks * block_size);
         }
         return *this;
     }
@@ -948,48 +1066,423 @@ public:
     explicit operator bool() const noexcept {
         return this->now;
     }
+};
+template <typename T, bool IsConstLHS, bool IsConstRHS, size_t BlockSize>
+[[nodiscard]]
+inline constexpr ptrdiff_t operator-(const deque_iterator<T, IsConstLHS, BlockSize> &lhs,
+        const deque_iterator<T, IsConstRHS, BlockSize> &rhs) noexcept {
+    if(lhs.now == rhs.now) {
+        return 0;       // the iterators of an empty deque have no block
+    }
+    constexpr auto block_size {static_cast<ptrdiff_t>(BlockSize)};
+    return (lhs.map - rhs.map) * block_size + (lhs.now - *lhs.map) - (rhs.now - *rhs.map);
+}
+template <typename T, bool IsConstLHS, bool IsConstRHS, size_t BlockSize>
+[[nodiscard]]
+inline constexpr bool operator==(const deque_iterator<T, IsConstLHS, BlockSize> &lhs,
+        const deque_iterator<T, IsConstRHS, BlockSize> &rhs) noexcept {
+    return lhs.now == rhs.now;
+}
+template <typename T, bool IsConstLHS, bool IsConstRHS, size_t BlockSize>
+[[nodiscard]]
+inline constexpr bool operator!=(const deque_iterator<T, IsConstLHS, BlockSize> &lhs,
+        const deque_iterator<T, IsConstRHS, BlockSize> &rhs) noexcept {
+    return not(lhs == rhs);
+}
+template <typename T, bool IsConstLHS, bool IsConstRHS, size_t BlockSize>
+[[nodiscard]]
+inline constexpr bool operator<(const deque_iterator<T, IsConstLHS, BlockSize> &lhs,
+        const deque_iterator<T, IsConstRHS, BlockSize> &rhs) noexcept {
+    return lhs - rhs < 0;
+}
+template <typename T, bool IsConstLHS, bool IsConstRHS, size_t BlockSize>
+[[nodiscard]]
+inline constexpr bool operator<=(const deque_iterator<T, IsConstLHS, BlockSize> &lhs,
+        const deque_iterator<T, IsConstRHS, BlockSize> &rhs) noexcept {
+    return not(rhs < lhs);
+}
+template <typename T, bool IsConstLHS, bool IsConstRHS, size_t BlockSize>
+[[nodiscard]]
+inline constexpr bool operator>(const deque_iterator<T, IsConstLHS, BlockSize> &lhs,
+        const deque_iterator<T, IsConstRHS, BlockSize> &rhs) noexcept {
+    return rhs < lhs;
+}
+template <typename T, bool IsConstLHS, bool IsConstRHS, size_t BlockSize>
+[[nodiscard]]
+inline constexpr bool operator>=(const deque_iterator<T, IsConstLHS, BlockSize> &lhs,
+        const deque_iterator<T, IsConstRHS, BlockSize> &rhs) noexcept {
+    return not(lhs < rhs);
+}
+
+/*
+ * An iterator is segmented if its range is made of contiguous segments (e.g. the blocks of deque), the algorithms
+ * could run on the local iterators (which are pointers) of each segment instead of the slower segmented iterator
+ */
+template <typename Iterator>
+struct segmented_iterator_traits {
+    static constexpr bool is_segmented {false};
+};
+template <typename T, bool IsConst, size_t BlockSize>
+struct segmented_iterator_traits<deque_iterator<T, IsConst, BlockSize>> {
+    using iterator = deque_iterator<T, IsConst, BlockSize>;
+    using segment_iterator = T **;
+    using local_iterator = conditional_t<IsConst, const T *, T *>;
+    static constexpr bool is_segmented {true};
+    [[nodiscard]]
+    static constexpr segment_iterator segment(const iterator &it) noexcept {
+        return it.map;
+    }
     [[nodiscard]]
-    operator list_iterator<T, true>() const noexcept {
-        return list_iterator<T, true>(this->map, this->now);
+    static constexpr local_iterator local(const iterator &it) noexcept {
+        return it.now;
+    }
+    [[nodiscard]]
+    static constexpr local_iterator begin(segment_iterator segment) noexcept {
+        return *segment;
+    }
+    [[nodiscard]]
+    static constexpr local_iterator end(segment_iterator segment) noexcept {
+        return *segment + iterator::block_size;
+    }
+    [[nodiscard]]
+    static constexpr iterator compose(segment_iterator segment, local_iterator local) noexcept {
+        return iterator(segment, const_cast<T *>(local));
+    }
+};
+template <typename Iterator>
+inline constexpr bool is_segmented_iterator_v {segmented_iterator_traits<Iterator>::is_segmented};
+__DATA_STRUCTURE_END(data structure special iterator, deque_iterator)
+
+__DATA_STRUCTURE_START(data structure special iterator, circular buffer iterator)
+/*
+ * The index of circular_buffer_iterator is not wrapped, so the iterators of a circular_buffer are ordered as the
+ * elements, and the element is at (index & mask) of the storage whose capacity is a power of two
+ */
+template <typename T, bool IsConst = false>
+class circular_buffer_iterator {
+    template <typename Type, bool IsConstLHS, bool IsConstRHS>
+    friend constexpr bool operator==(const circular_buffer_iterator<Type, IsConstLHS> &,
+            const circular_buffer_iterator<Type, IsConstRHS> &) noexcept;
+    template <typename Type, bool IsConstLHS, bool IsConstRHS>
+    friend constexpr ptrdiff_t operator-(const circular_buffer_iterator<Type, IsConstLHS> &,
+            const circular_buffer_iterator<Type, IsConstRHS> &) noexcept;
+    template <typename, bool> friend class circular_buffer_iterator;
+public:
+    using iterator_type = circular_buffer_iterator;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using value_type = T;
+    using iterator_category = random_access_iterator_tag;
+private:
+    T *first;
+    size_t mask;
+    size_t index;
+public:
+    constexpr circular_buffer_iterator() noexcept = default;
+    constexpr circular_buffer_iterator(T *first, size_t mask, size_t index) noexcept :
+            first {first}, mask {mask}, index {index} {}
+    constexpr circular_buffer_iterator(const circular_buffer_iterator<T, false> &non_const_iterator) noexcept
+            requires IsConst : first {non_const_iterator.first}, mask {non_const_iterator.mask},
+            index {non_const_iterator.index} {}
+    constexpr circular_buffer_iterator(const circular_buffer_iterator &) noexcept = default;
+    constexpr circular_buffer_iterator(circular_buffer_iterator &&) noexcept = default;
+    constexpr ~circular_buffer_iterator() noexcept = default;
+public:
+    constexpr circular_buffer_iterator &operator=(const circular_buffer_iterator &) noexcept = default;
+    constexpr circular_buffer_iterator &operator=(circular_buffer_iterator &&) noexcept = default;
+    [[nodiscard]]
+    constexpr conditional_t<IsConst, const T &, T &> operator*() noexcept {
+        return this->first[this->index & this->mask];
+    }
+    [[nodiscard]]
+    constexpr const T &operator*() const noexcept {
+        return this->first[this->index & this->mask];
+    }
+    [[nodiscard]]
+    constexpr conditional_t<IsConst, const T *, T *> operator->() noexcept {
+        return ds::address_of(**this);
+    }
+    [[nodiscard]]
+    constexpr const T *operator->() const noexcept {
+        return ds::address_of(**this);
+    }
+    [[nodiscard]]
+    constexpr conditional_t<IsConst, const T &, T &> operator[](difference_type n) noexcept {
+        return this->first[(this->index + n) & this->mask];
+    }
+    [[nodiscard]]
+    constexpr const T &operator[](difference_type n) const noexcept {
+        return this->first[(this->index + n) & this->mask];
+    }
+    constexpr circular_buffer_iterator &operator++() & noexcept {
+        ++this->index;
+        return *this;
+    }
+    constexpr circular_buffer_iterator operator++(int) & noexcept {
+        auto backup {*this};
+        ++*this;
+        return backup;
+    }
+    constexpr circular_buffer_iterator &operator--() & noexcept {
+        --this->index;
+        return *this;
+    }
+    constexpr circular_buffer_iterator operator--(int) & noexcept {
+        auto backup {*this};
+        --*this;
+        return backup;
+    }
+    constexpr circular_buffer_iterator &operator+=(difference_type n) noexcept {
+        this->index += n;
+        return *this;
+    }
+    constexpr circular_buffer_iterator &operator-=(difference_type n) noexcept {
+        this->index -= n;
+        return *this;
+    }
+    constexpr circular_buffer_iterator operator+(difference_type n) const noexcept {
+        auto backup {*this};
+        backup += n;
+        return backup;
+    }
+    constexpr circular_buffer_iterator operator-(difference_type n) const noexcept {
+        auto backup {*this};
+        backup -= n;
+        return backup;
+    }
+    [[nodiscard]]
+    explicit operator bool() const noexcept {
+        return this->first;
     }
 };
 template <typename T, bool IsConstLHS, bool IsConstRHS>
 [[nodiscard]]
-inline constexpr bool operator==(const deque_iterator<T, IsConstLHS> &lhs,
-        const deque_iterator<T, IsConstRHS> &rhs) noexcept {
-    return lhs.now == rhs.now;
+inline constexpr ptrdiff_t operator-(const circular_buffer_iterator<T, IsConstLHS> &lhs,
+        const circular_buffer_iterator<T, IsConstRHS> &rhs) noexcept {
+    return static_cast<ptrdiff_t>(lhs.index - rhs.index);
 }
 template <typename T, bool IsConstLHS, bool IsConstRHS>
 [[nodiscard]]
-inline constexpr bool operator!=(const deque_iterator<T, IsConstLHS> &lhs,
-        const deque_iterator<T, IsConstRHS> &rhs) noexcept {
+inline constexpr bool operator==(const circular_buffer_iterator<T, IsConstLHS> &lhs,
+        const circular_buffer_iterator<T, IsConstRHS> &rhs) noexcept {
+    return lhs.index == rhs.index;
+}
+template <typename T, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr bool operator!=(const circular_buffer_iterator<T, IsConstLHS> &lhs,
+        const circular_buffer_iterator<T, IsConstRHS> &rhs) noexcept {
     return not(lhs == rhs);
 }
 template <typename T, bool IsConstLHS, bool IsConstRHS>
 [[nodiscard]]
-inline constexpr bool operator<(const deque_iterator<T, IsConstLHS> &lhs,
-        const deque_iterator<T, IsConstRHS> &rhs) noexcept {
+inline constexpr bool operator<(const circular_buffer_iterator<T, IsConstLHS> &lhs,
+        const circular_buffer_iterator<T, IsConstRHS> &rhs) noexcept {
     return lhs - rhs < 0;
 }
 template <typename T, bool IsConstLHS, bool IsConstRHS>
 [[nodiscard]]
-inline constexpr bool operator<=(const deque_iterator<T, IsConstLHS> &lhs,
-        const deque_iterator<T, IsConstRHS> &rhs) noexcept {
-    return  not(rhs < lhs);
+inline constexpr bool operator<=(const circular_buffer_iterator<T, IsConstLHS> &lhs,
+        const circular_buffer_iterator<T, IsConstRHS> &rhs) noexcept {
+    return not(rhs < lhs);
 }
 template <typename T, bool IsConstLHS, bool IsConstRHS>
 [[nodiscard]]
-inline constexpr bool operator>(const deque_iterator<T, IsConstLHS> &lhs,
-        const deque_iterator<T, IsConstRHS> &rhs) noexcept {
+inline constexpr bool operator>(const circular_buffer_iterator<T, IsConstLHS> &lhs,
+        const circular_buffer_iterator<T, IsConstRHS> &rhs) noexcept {
     return rhs < lhs;
 }
 template <typename T, bool IsConstLHS, bool IsConstRHS>
 [[nodiscard]]
-inline constexpr bool operator>=(const deque_iterator<T, IsConstLHS> &lhs,
-        const deque_iterator<T, IsConstRHS> &rhs) noexcept {
+inline constexpr bool operator>=(const circular_buffer_iterator<T, IsConstLHS> &lhs,
+        const circular_buffer_iterator<T, IsConstRHS> &rhs) noexcept {
     return not(lhs < rhs);
 }
-__DATA_STRUCTURE_END(data structure special iterator, deque_iterator)
+__DATA_STRUCTURE_END(data structure special iterator, circular buffer iterator)
+
+__DATA_STRUCTURE_START(data structure special iterator, bit iterator)
+template <typename Word>
+class bit_reference {
+    template <typename, bool> friend class bit_iterator;
+private:
+    Word *word;
+    Word mask;
+public:
+    constexpr bit_reference(Word *word, size_t offset) noexcept :
+            word {word}, mask {static_cast<Word>(static_cast<Word>(1) << offset)} {}
+    constexpr bit_reference(const bit_reference &) noexcept = default;
+    constexpr ~bit_reference() noexcept = default;
+public:
+    constexpr bit_reference &operator=(bool value) noexcept {
+        if(value) {
+            *this->word |= this->mask;
+        }else {
+            *this->word &= static_cast<Word>(~this->mask);
+        }
+        return *this;
+    }
+    constexpr bit_reference &operator=(const bit_reference &rhs) noexcept {
+        return *this = static_cast<bool>(rhs);
+    }
+    [[nodiscard]]
+    constexpr operator bool() const noexcept {
+        return *this->word & this->mask;
+    }
+    [[nodiscard]]
+    constexpr bool operator~() const noexcept {
+        return not static_cast<bool>(*this);
+    }
+    constexpr bit_reference &flip() noexcept {
+        *this->word ^= this->mask;
+        return *this;
+    }
+};
+template <typename Word>
+inline constexpr void swap(bit_reference<Word> lhs, bit_reference<Word> rhs) noexcept {
+    const bool backup {lhs};
+    lhs = rhs;
+    rhs = backup;
+}
+
+template <typename Word, bool IsConst = false>
+class bit_iterator {
+    template <typename, bool> friend class bit_iterator;
+    template <typename, typename> friend class data_structure::dynamic_bitset;
+    template <typename Type, bool IsConstLHS, bool IsConstRHS>
+    friend constexpr ptrdiff_t operator-(const bit_iterator<Type, IsConstLHS> &,
+            const bit_iterator<Type, IsConstRHS> &) noexcept;
+public:
+    using iterator_type = bit_iterator;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using value_type = bool;
+    using reference = conditional_t<IsConst, bool, bit_reference<Word>>;
+    using const_reference = bool;
+    using iterator_category = random_access_iterator_tag;
+private:
+    static constexpr auto word_bits {static_cast<difference_type>(sizeof(Word) * 8)};
+private:
+    conditional_t<IsConst, const Word *, Word *> word {};
+    size_t offset {};
+public:
+    constexpr bit_iterator() noexcept = default;
+    constexpr bit_iterator(conditional_t<IsConst, const Word *, Word *> word, size_t offset) noexcept :
+            word {word}, offset {offset} {}
+    constexpr bit_iterator(const bit_iterator<Word, false> &non_const_iterator) noexcept requires IsConst :
+            word {non_const_iterator.word}, offset {non_const_iterator.offset} {}
+    constexpr bit_iterator(const bit_iterator &) noexcept = default;
+    constexpr bit_iterator(bit_iterator &&) noexcept = default;
+    constexpr ~bit_iterator() noexcept = default;
+public:
+    constexpr bit_iterator &operator=(const bit_iterator &) noexcept = default;
+    constexpr bit_iterator &operator=(bit_iterator &&) noexcept = default;
+    [[nodiscard]]
+    constexpr reference operator*() const noexcept {
+        if constexpr(IsConst) {
+            return *this->word >> this->offset & 1;
+        }else {
+            return reference {this->word, this->offset};
+        }
+    }
+    [[nodiscard]]
+    constexpr reference operator[](difference_type n) const noexcept {
+        return *(*this + n);
+    }
+    constexpr bit_iterator &operator++() & noexcept {
+        if(++this->offset == bit_iterator::word_bits) {
+            ++this->word;
+            this->offset = 0;
+        }
+        return *this;
+    }
+    constexpr bit_iterator operator++(int) & noexcept {
+        auto backup {*this};
+        ++*this;
+        return backup;
+    }
+    constexpr bit_iterator &operator--() & noexcept {
+        if(this->offset == 0) {
+            --this->word;
+            this->offset = bit_iterator::word_bits - 1;
+        }else {
+            --this->offset;
+        }
+        return *this;
+    }
+    constexpr bit_iterator operator--(int) & noexcept {
+        auto backup {*this};
+        --*this;
+        return backup;
+    }
+    constexpr bit_iterator &operator+=(difference_type n) & noexcept {
+        n += static_cast<difference_type>(this->offset);
+        auto words {n / bit_iterator::word_bits};
+        auto offset {n % bit_iterator::word_bits};
+        if(offset < 0) {
+            offset += bit_iterator::word_bits;
+            --words;
+        }
+        this->word += words;
+        this->offset = static_cast<size_t>(offset);
+        return *this;
+    }
+    constexpr bit_iterator &operator-=(difference_type n) & noexcept {
+        return *this += -n;
+    }
+    [[nodiscard]]
+    constexpr bit_iterator operator+(difference_type n) const noexcept {
+        auto backup {*this};
+        return backup += n;
+    }
+    [[nodiscard]]
+    constexpr bit_iterator operator-(difference_type n) const noexcept {
+        auto backup {*this};
+        return backup += -n;
+    }
+};
+template <typename Word, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr ptrdiff_t operator-(const bit_iterator<Word, IsConstLHS> &lhs,
+        const bit_iterator<Word, IsConstRHS> &rhs) noexcept {
+    return (lhs.word - rhs.word) * bit_iterator<Word, IsConstLHS>::word_bits +
+            (static_cast<ptrdiff_t>(lhs.offset) - static_cast<ptrdiff_t>(rhs.offset));
+}
+template <typename Word, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr bool operator==(const bit_iterator<Word, IsConstLHS> &lhs,
+        const bit_iterator<Word, IsConstRHS> &rhs) noexcept {
+    return lhs - rhs == 0;
+}
+template <typename Word, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr bool operator!=(const bit_iterator<Word, IsConstLHS> &lhs,
+        const bit_iterator<Word, IsConstRHS> &rhs) noexcept {
+    return not(lhs == rhs);
+}
+template <typename Word, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr bool operator<(const bit_iterator<Word, IsConstLHS> &lhs,
+        const bit_iterator<Word, IsConstRHS> &rhs) noexcept {
+    return lhs - rhs < 0;
+}
+template <typename Word, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr bool operator<=(const bit_iterator<Word, IsConstLHS> &lhs,
+        const bit_iterator<Word, IsConstRHS> &rhs) noexcept {
+    return not(rhs < lhs);
+}
+template <typename Word, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr bool operator>(const bit_iterator<Word, IsConstLHS> &lhs,
+        const bit_iterator<Word, IsConstRHS> &rhs) noexcept {
+    return rhs < lhs;
+}
+template <typename Word, bool IsConstLHS, bool IsConstRHS>
+[[nodiscard]]
+inline constexpr bool operator>=(const bit_iterator<Word, IsConstLHS> &lhs,
+        const bit_iterator<Word, IsConstRHS> &rhs) noexcept {
+    return not(lhs < rhs);
+}
+__DATA_STRUCTURE_END(data structure special iterator, bit iterator)
 
 }       // namespace data_structure::__data_structure_auxiliary
 __DATA_STRUCTURE_END(inner tools for data structure)
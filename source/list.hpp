@@ -23,11 +23,18 @@
 namespace data_structure {
 
 __DATA_STRUCTURE_START(list declaration)
-template <typename T, typename Allocator = allocator<T>,typename NodeAllocator = __dsa::node_allocator<Allocator,
-        __dsa::list_node, __dsa::list_node_linker>>
+/*
+ * NodeAllocator is the node pool of forward_list by default, which takes the nodes in batch and links them through
+ * next, so list only sets the previous links. The copies and the moves of a list share its pool. If NodeAllocator is
+ * void, the nodes are allocated one by one from the element allocator rebound to the node type.
+ * tail is the sentinel of a circular list, so an empty list links tail to itself.
+ */
+template <typename T, typename Allocator = allocator<T>,
+        typename NodeAllocator = __dsa::forward_list_node_allocator<T, __dsa::list_node, Allocator>>
 class list {
 private:
     using node_type = __dsa::list_node<T> *;
+    using base_node_type = __dsa::list_base_node<__dsa::list_node<T>> *;
     using real_allocator = conditional_t<is_void_v<NodeAllocator>,
             typename allocator_traits<Allocator>::template rebind<__dsa::list_node<T>>, NodeAllocator>;
 public:
@@ -42,19 +49,38 @@ public:
     using const_pointer = typename allocator_traits<Allocator>::const_pointer;
     using iterator = __dsa::list_iterator<T>;
     using const_iterator = __dsa::list_iterator<T, true>;
-    using reverse_iterator = reverse_iterator<iterator>;
+    using reverse_iterator = ds::reverse_iterator<iterator>;
     using const_reverse_iterator = ds::reverse_iterator<const_iterator>;
     static_assert(is_same_v<T, typename Allocator::value_type>,
             "The value type of list should be same as the allocator's value_type!");
 private:
-    __dsa::list_base_node<__dsa::list_node<T>> tail {};
+    struct node_pair {
+        node_type first_node;
+        node_type last_node;
+    };
+private:
+    __dsa::list_base_node<__dsa::list_node<T>> tail {&this->tail, &this->tail};
     __dsa::allocator_compressor<size_type, real_allocator> node_size {};
 private:
+    [[nodiscard]]
+    static constexpr real_allocator make_node_allocator(const Allocator &)
+            noexcept(noexcept(__dsa::rebind_allocator<real_allocator>(declval<const Allocator &>())));
+    static constexpr node_pair link_previous(node_type, size_type) noexcept;
+    [[nodiscard]]
+    static constexpr real_allocator adopted_node_allocator(const list &, const Allocator &) noexcept;
     template <typename ...Args>
-    constexpr auto allocate_values(size_type, Args &&...);
+    constexpr node_pair allocate_values(size_type, Args &&...);
     template <IsInputIterator InputIterator>
-    constexpr auto allocate_range(size_type, InputIterator);
-    constexpr void erase(node_type, node_type, size_type) noexcept;
+    constexpr node_pair allocate_range(size_type, InputIterator);
+    template <typename ...Args>
+    constexpr iterator insert_values(base_node_type, size_type, Args &&...);
+    template <IsInputIterator InputIterator>
+    constexpr iterator insert_range(base_node_type, size_type, InputIterator);
+    constexpr void deallocate_nodes(base_node_type, base_node_type) noexcept;
+    constexpr void erase(base_node_type, base_node_type, size_type) noexcept;
+    [[nodiscard]]
+    constexpr base_node_type node_at(size_type) noexcept;
+    constexpr void relink_tail() noexcept;
 public:
     constexpr list() noexcept(is_nothrow_default_constructible_v<real_allocator>) = default;
     explicit constexpr list(const Allocator &) noexcept(is_nothrow_constructible_v<real_allocator, const Allocator &>);
@@ -151,6 +177,8 @@ public:
     constexpr iterator insert(const_iterator, ForwardIterator, ForwardIterator);
     constexpr iterator insert(size_type, initializer_list<T>);
     constexpr iterator insert(const_iterator, initializer_list<T>);
+    template <IsRange Range>
+    constexpr void append_range(Range &&);
     constexpr iterator erase(size_type, size_type = 1);
     constexpr iterator erase(const_iterator, size_type);
     constexpr iterator erase(const_iterator);
@@ -161,28 +189,8 @@ __DATA_STRUCTURE_END(list declaration)
 __DATA_STRUCTURE_START(list implementation)
 /* exceptional handler */
 namespace __data_structure_auxiliary {
-template <typename NodeType, typename Allocator, bool>
-struct list_allocation_handler {
-    NodeType begin;
-    NodeType now;
-    Allocator &allocator;
-    constexpr list_allocation_handler(NodeType begin, Allocator &allocator) noexcept :
-            begin {begin}, now {begin}, allocator {allocator} {}
-    constexpr void operator()() noexcept {
-        this->now->next = nullptr;
-        while(this->begin->next) {
-            ds::destroy(ds::address_of(this->begin->value));
-            const auto backup {this->begin};
-            this->begin = this->begin->next->node();
-            this->allocator.deallocate(backup);
-        }
-        this->allocator.deallocate(this->begin);
-    }
-    constexpr void done() const noexcept {}
-    constexpr void doing() const noexcept {}
-};
 template <typename NodeType, typename Allocator>
-struct list_allocation_handler<NodeType, Allocator, false> {
+struct list_allocation_handler {
     NodeType begin;
     NodeType now;
     Allocator &allocator;
@@ -190,17 +198,17 @@ struct list_allocation_handler<NodeType, Allocator, false> {
     constexpr list_allocation_handler(NodeType begin, Allocator &allocator) noexcept :
             begin {begin}, now {begin}, allocator {allocator} {}
     constexpr void operator()() noexcept {
-        this->now->next = nullptr;
-        while(this->begin->next) {
-            ds::destroy(ds::address_of(this->begin->value));
+        // the values of the nodes before now have been constructed, the value of now may not
+        while(this->begin not_eq this->now) {
             const auto backup {this->begin};
             this->begin = this->begin->next->node();
-            this->allocator.deallocate(backup);
+            ds::destroy(ds::address_of(backup->value));
+            this->allocator.deallocate(backup, 1);
         }
         if(this->value_construction_done) {
-            ds::destroy(ds::address_of(this->begin->value));
+            ds::destroy(ds::address_of(this->now->value));
         }
-        this->allocator.deallocate(this->begin);
+        this->allocator.deallocate(this->now, 1);
     }
     constexpr void done() noexcept {
         this->value_construction_done = true;
@@ -213,163 +221,221 @@ struct list_allocation_handler<NodeType, Allocator, false> {
 
 /* private functions */
 template <typename T, typename Allocator, typename NodeAllocator>
-template <typename ...Args>
-constexpr auto list<T, Allocator, NodeAllocator>::allocate_values(size_type n, Args &&...args) {
+constexpr typename list<T, Allocator, NodeAllocator>::real_allocator
+list<T, Allocator, NodeAllocator>::make_node_allocator(const Allocator &allocator)
+        noexcept(noexcept(__dsa::rebind_allocator<real_allocator>(declval<const Allocator &>()))) {
+    static_assert(is_constructible_v<real_allocator, const Allocator &> or is_empty_v<Allocator>,
+            "The node allocator of list should be constructible from the allocator!");
+    return __dsa::rebind_allocator<real_allocator>(allocator);
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename list<T, Allocator, NodeAllocator>::real_allocator
+list<T, Allocator, NodeAllocator>::adopted_node_allocator(const list &rhs, const Allocator &allocator) noexcept {
+    // the nodes taken over from rhs belong to the pool of rhs, they can't be returned to another pool
     if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
-        return this->node_size.allocator().allocate_with_value(n, ds::forward<Args>(args)...);
+        return rhs.node_size.allocator();
     }else {
-        struct return_pair {
-            node_type first_node;
-            node_type last_node;
-            constexpr operator node_type() noexcept {
-                return this>first_node;
-            }
-        };
-        auto &allocator {this->node_size.allocator()};
-        auto trans {transaction {__dsa::list_allocation_handler<node_type, real_allocator,
-                is_trivially_destructible_v<T>>(allocator.allocate(1), allocator)}};
-        auto handler {trans.get_rollback()};
-        while(--n not_eq 0) {
-            ds::construct(ds::address_of(handler.now->value()), ds::forward<Args>(args)...);
-            handler.done();
-            handler.now->next = allocator.allocate(1);
-            handler.doing();
-        }
-        ds::construct(ds::address_of(handler.now->value()), ds::forward<Args>(args)...);
+        return list::make_node_allocator(allocator);
+    }
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename list<T, Allocator, NodeAllocator>::node_pair
+list<T, Allocator, NodeAllocator>::link_previous(node_type first_node, size_type n) noexcept {
+    // the n nodes are linked through next by NodeAllocator
+    auto last_node {first_node};
+    while(--n not_eq 0) {
+        const auto next_node {last_node->next->node()};
+        next_node->previous = last_node;
+        last_node = next_node;
+    }
+    return {first_node, last_node};
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+template <typename ...Args>
+constexpr typename list<T, Allocator, NodeAllocator>::node_pair
+list<T, Allocator, NodeAllocator>::allocate_values(size_type n, Args &&...args) {
+    // allocates n linked nodes, n should be positive
+    auto &allocator {this->node_size.allocator()};
+    if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
+        return list::link_previous(allocator.allocate_with_value(n, nullptr, ds::forward<Args>(args)...), n);
+    }
+    auto trans {transaction {__dsa::list_allocation_handler<node_type, real_allocator>(allocator.allocate(1),
+            allocator)}};
+    auto &handler {trans.get_rollback()};
+    while(--n not_eq 0) {
+        ds::construct(ds::address_of(handler.now->value), ds::forward<Args>(args)...);
         handler.done();
-        trans.complete();
-        return return_pair {handler.begin, handler.now};
+        const auto next_node {allocator.allocate(1)};
+        next_node->previous = handler.now;
+        handler.now->next = next_node;
+        handler.now = next_node;
+        handler.doing();
     }
+    ds::construct(ds::address_of(handler.now->value), ds::forward<Args>(args)...);
+    trans.complete();
+    return {handler.begin, handler.now};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator>
-constexpr auto list<T, Allocator, NodeAllocator>::allocate_range(size_type n, InputIterator begin) {
+constexpr typename list<T, Allocator, NodeAllocator>::node_pair
+list<T, Allocator, NodeAllocator>::allocate_range(size_type n, InputIterator begin) {
+    // allocates n linked nodes, n should be positive
+    auto &allocator {this->node_size.allocator()};
     if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
-        return this->node_size.allocator().allocate_with_range(n, begin);
-    }else {
-        struct return_pair {
-            node_type first_node;
-            node_type last_node;
-            constexpr operator node_type() noexcept {
-                return this>first_node;
-            }
-        };
-        auto &allocator {this->node_size.allocator()};
-        auto trans {transaction {__dsa::list_allocation_handler<node_type, real_allocator,
-                is_trivially_destructible_v<T>>(allocator.allocate(1), allocator)}};
-        auto handler {trans.get_rollback()};
-        while(--n not_eq 0) {
-            ds::construct(ds::address_of(handler.now->value()),
-                    ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
-            handler.done();
-            handler.now->next = allocator.allocate(1);
-            handler.doing();
-        }
-        ds::construct(ds::address_of(handler.now->value()),
-                ds::move_if<not IsForwardIterator<InputIterator>>(*begin++));
+        return list::link_previous(allocator.allocate_with_range(n, nullptr, ds::move(begin)), n);
+    }
+    auto trans {transaction {__dsa::list_allocation_handler<node_type, real_allocator>(allocator.allocate(1),
+            allocator)}};
+    auto &handler {trans.get_rollback()};
+    while(--n not_eq 0) {
+        ds::construct(ds::address_of(handler.now->value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin));
+        ++begin;
         handler.done();
-        trans.complete();
-        return return_pair {handler.begin, handler.now};
+        const auto next_node {allocator.allocate(1)};
+        next_node->previous = handler.now;
+        handler.now->next = next_node;
+        handler.now = next_node;
+        handler.doing();
     }
+    ds::construct(ds::address_of(handler.now->value), ds::move_if<not IsForwardIterator<InputIterator>>(*begin));
+    trans.complete();
+    return {handler.begin, handler.now};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
-constexpr void list<T, Allocator, NodeAllocator>::erase(node_type begin, node_type end, size_type size) noexcept {
+template <typename ...Args>
+constexpr typename list<T, Allocator, NodeAllocator>::iterator
+list<T, Allocator, NodeAllocator>::insert_values(base_node_type pos, size_type n, Args &&...args) {
+    if(n == 0) {
+        return iterator {pos};
+    }
+    const auto [first_node, last_node] {this->allocate_values(n, ds::forward<Args>(args)...)};
+    first_node->previous = pos->previous;
+    last_node->next = pos;
+    pos->previous->next = first_node;
+    pos->previous = last_node;
+    this->node_size() += n;
+    return iterator {first_node};
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+template <IsInputIterator InputIterator>
+constexpr typename list<T, Allocator, NodeAllocator>::iterator
+list<T, Allocator, NodeAllocator>::insert_range(base_node_type pos, size_type n, InputIterator begin) {
+    if(n == 0) {
+        return iterator {pos};
+    }
+    const auto [first_node, last_node] {this->allocate_range(n, ds::move(begin))};
+    first_node->previous = pos->previous;
+    last_node->next = pos;
+    pos->previous->next = first_node;
+    pos->previous = last_node;
+    this->node_size() += n;
+    return iterator {first_node};
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void list<T, Allocator, NodeAllocator>::deallocate_nodes(base_node_type begin, base_node_type end) noexcept {
+    // the links of [begin, end) are not restored
     auto &allocator {this->node_size.allocator()};
-    if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
-        end->next->previous = begin->previous;
-        begin->previous->next = end->next;
-        allocator.deallocate<true>(begin, end, size);
-    }else {
-        for(auto cursor {begin};;) {
-            auto backup {cursor->node()};
+    while(begin not_eq end) {
+        const auto node {begin->node()};
+        begin = begin->next;
+        ds::destroy(ds::address_of(node->value));
+        allocator.deallocate(node, 1);
+    }
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void list<T, Allocator, NodeAllocator>::erase(base_node_type begin, base_node_type end,
+        size_type n) noexcept {
+    if(n == 0) {
+        return;
+    }
+    begin->previous->next = end;
+    end->previous = begin->previous;
+    this->deallocate_nodes(begin, end);
+    this->node_size() -= n;
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr typename list<T, Allocator, NodeAllocator>::base_node_type
+list<T, Allocator, NodeAllocator>::node_at(size_type pos) noexcept {
+    // walks from the nearer end, node_at(size()) is the sentinel
+    const auto size {this->node_size()};
+    base_node_type cursor {&this->tail};
+    if(pos < size / 2) {
+        for(cursor = cursor->next; pos not_eq 0; --pos) {
             cursor = cursor->next;
-            ds::destroy(ds::address_of(backup->value));
-            allocator.deallocate(backup);
-            if(cursor == end) {
-                ds::destroy(ds::address_of(cursor->value));
-                allocator.deallocate(cursor);
-                this->node_size() -= size;
-                return;
-            }
+        }
+    }else {
+        for(auto i {size}; i not_eq pos; --i) {
+            cursor = cursor->previous;
         }
     }
+    return cursor;
+}
+template <typename T, typename Allocator, typename NodeAllocator>
+constexpr void list<T, Allocator, NodeAllocator>::relink_tail() noexcept {
+    // makes the first and the last node point to tail after tail has been copied from another list
+    if(this->node_size() == 0) {
+        this->tail.next = this->tail.previous = &this->tail;
+    }else {
+        this->tail.next->previous = &this->tail;
+        this->tail.previous->next = &this->tail;
+    }
 }
 
 /* public functions */
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator>::list(const Allocator &allocator)
-        noexcept(is_nothrow_constructible_v<real_allocator, const Allocator &>) : tail {},
-        node_size(real_allocator {allocator}) {}
+        noexcept(is_nothrow_constructible_v<real_allocator, const Allocator &>) :
+        node_size(list::make_node_allocator(allocator)) {}
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator>::list(size_type n, const Allocator &allocator) :
-        tail {}, node_size(n, real_allocator {allocator}) {
-    const auto [first_node, last_node] {this->allocate_values(n)};
-    this->tail.next = first_node;
-    this->tail.previous = last_node;
-    first_node->previous = this->tail;
-    last_node->next = this->tail;
+        node_size(list::make_node_allocator(allocator)) {
+    this->insert_values(&this->tail, n);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator>::list(size_type n, const_reference value, const Allocator &allocator) :
-        tail {}, node_size(n, real_allocator {allocator}) {
-    const auto [first_node, last_node] {this->allocate_values(n, value)};
-    this->tail.next = first_node;
-    this->tail.previous = last_node;
-    first_node->previous = this->tail;
-    last_node->next = this->tail;
+        node_size(list::make_node_allocator(allocator)) {
+    this->insert_values(&this->tail, n, value);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
 constexpr list<T, Allocator, NodeAllocator>::list(InputIterator begin, InputIterator end, const Allocator &allocator,
-        size_type default_size) : tail {}, node_size(real_allocator {allocator}) {
+        size_type default_size) : node_size(list::make_node_allocator(allocator)) {
     buffer<T, Allocator> b(begin, end, allocator, default_size);
-    const auto [first_node, last_node] {this->allocate_range(this->node_size() = b.size(), b.mbegin())};
-    this->tail.next = first_node;
-    this->tail.previous = last_node;
-    first_node->previous = this->tail;
-    last_node->next = this->tail;
+    this->insert_range(&this->tail, b.size(), b.mbegin());
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
 constexpr list<T, Allocator, NodeAllocator>::list(ForwardIterator begin, ForwardIterator end,
-        const Allocator &allocator) : tail {}, node_size(real_allocator {allocator}) {
-    const auto [first_node, last_node] {this->allocate_range(
-            this->node_size() = static_cast<size_type>(ds::distance(begin, end)), begin)};
-    this->tail.next = first_node;
-    this->tail.previous = last_node;
-    first_node->previous = this->tail;
-    last_node->next = this->tail;
+        const Allocator &allocator) : node_size(list::make_node_allocator(allocator)) {
+    this->insert_range(&this->tail, static_cast<size_type>(ds::distance(begin, end)), begin);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator>::list(initializer_list<T> init_list, const Allocator &allocator):
         list(init_list.begin(), init_list.end(), allocator) {}
 template <typename T, typename Allocator, typename NodeAllocator>
-constexpr list<T, Allocator, NodeAllocator>::list(const list &rhs) : tail {}, node_size(rhs.node_size) {
-    const auto [first_node, last_node] {this->allocate_range(rhs.size(), rhs.cbegin())};
-    this->tail.next = first_node;
-    this->tail.previous = last_node;
-    first_node->previous = this->tail;
-    last_node->next = this->tail;
+constexpr list<T, Allocator, NodeAllocator>::list(const list &rhs) : node_size(rhs.node_size.allocator()) {
+    this->insert_range(&this->tail, rhs.size(), rhs.cbegin());
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator>::list(const list &rhs, const Allocator &allocator) :
         list(rhs.cbegin(), rhs.cend(), allocator) {}
 template <typename T, typename Allocator, typename NodeAllocator>
-constexpr list<T, Allocator, NodeAllocator>::list(list &&rhs) noexcept : tail {ds::move(rhs.tail)},
-        node_size {ds::move(rhs.node_size)} {
-    rhs.tail.next = rhs.tail.previous = nullptr;
+constexpr list<T, Allocator, NodeAllocator>::list(list &&rhs) noexcept : tail {rhs.tail},
+        node_size {rhs.node_size} {
+    this->relink_tail();
     rhs.node_size() = 0;
+    rhs.relink_tail();
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator>::list(list &&rhs, const Allocator &allocator) noexcept :
-        tail {ds::move(rhs.tail)}, node_size(ds::move(rhs.node_size()), real_allocator {allocator}) {
-    rhs.tail.next = rhs.tail.previous = nullptr;
+        tail {rhs.tail}, node_size(rhs.node_size(), list::adopted_node_allocator(rhs, allocator)) {
+    this->relink_tail();
     rhs.node_size() = 0;
+    rhs.relink_tail();
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator>::~list() noexcept {
-    this->node_size.allocator().deallocate<true>(this->tail.next->node(), this->tail.previous->node(),
-            this->node_size());
+    this->deallocate_nodes(this->tail.next, &this->tail);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator> &list<T, Allocator, NodeAllocator>::operator=(const list &rhs) {
@@ -381,11 +447,12 @@ constexpr list<T, Allocator, NodeAllocator> &list<T, Allocator, NodeAllocator>::
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr list<T, Allocator, NodeAllocator> &list<T, Allocator, NodeAllocator>::operator=(list &&rhs) noexcept {
     if(this not_eq &rhs) {
-        this->~list();
-        this->tail = ds::move(rhs.tail);
-        this->node_size = ds::move(rhs.node_size);
-        rhs.tail.next = rhs.tail.previous = nullptr;
+        this->clear();
+        this->tail = rhs.tail;
+        this->node_size = rhs.node_size;
+        this->relink_tail();
         rhs.node_size() = 0;
+        rhs.relink_tail();
     }
     return *this;
 }
@@ -397,90 +464,40 @@ list<T, Allocator, NodeAllocator>::operator=(initializer_list<T> init_list) {
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::assign(size_type n, const_reference value) {
-    auto &size {this->node_size()};
-    if(n >= size) {
-        for(auto it {this->tail.next}; it; it = it->next) {
-            it->value() = value;
-        }
-        if(const auto allocation_size {n - size}; allocation_size not_eq 0) {
-            auto [first_node, last_node] {this->allocate_values(allocation_size, this->tail.next->node(), value)};
-            last_node->next = this->tail.next;
-            this->tail.next = first_node;
-            first_node->previous = this->tail.previous;
-            this->tail.previous = last_node;
-            size += allocation_size;
-        }
+    // the existing nodes are reused
+    const auto size {this->node_size()};
+    auto cursor {this->tail.next};
+    for(auto i {n < size ? n : size}; i not_eq 0; --i, static_cast<void>(cursor = cursor->next)) {
+        cursor->value() = value;
+    }
+    if(n > size) {
+        this->insert_values(&this->tail, n - size, value);
     }else {
-        const auto erasion_size {size - n};
-        auto cursor {this->tail};
-        auto &allocator {this->node_size.allocator()};
-        size = n;
-        if(erasion_size < n) {
-            for(auto i {0}; i < erasion_size; ++i) {
-                cursor = cursor->previous;
-            }
-            this->tail->previous = cursor->previous;
-            cursor->previous->next = &this->tail;
-            allocator.deallocate(cursor->node(), this->tail->previous->node(), erasion_size);
-        }else {
-            while(n-- not_eq 0) {
-                cursor = cursor->next;
-            }
-            this->tail->previous = cursor;
-            const auto backup {cursor->next};
-            cursor->next = &this->tail;
-            allocator.deallocate(backup->node(), this->tail->previous->node(), erasion_size);
-        }
+        this->erase(cursor, &this->tail, size - n);
     }
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
 constexpr void list<T, Allocator, NodeAllocator>::assign(InputIterator begin, InputIterator end,
         size_type default_size) {
-    buffer<T, Allocator> b(begin, end, default_size);
+    buffer<T, Allocator> b(begin, end, this->allocator(), default_size);
     this->assign(b.mbegin(), b.mend());
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
 constexpr void list<T, Allocator, NodeAllocator>::assign(ForwardIterator begin, ForwardIterator end) {
-    auto n {static_cast<size_type>(ds::distance(begin, end))};
-    auto &size {this->node_size()};
-    if(n >= size) {
-        for(auto it {this->tail.next}; it; it = it->next) {
-            it->value() = *begin++;
-        }
-        if(const auto allocation_size {n - size}; allocation_size not_eq 0) {
-            auto [first_node, last_node] {this->allocate_values(allocation_size, this->tail.next->node(), begin)};
-            last_node->next = this->tail.next;
-            this->tail.next = first_node;
-            first_node->previous = this->tail.previous;
-            this->tail.previous = last_node;
-            size += allocation_size;
-        }
+    // the existing nodes are reused
+    const auto n {static_cast<size_type>(ds::distance(begin, end))};
+    const auto size {this->node_size()};
+    auto cursor {this->tail.next};
+    for(auto i {n < size ? n : size}; i not_eq 0; --i, static_cast<void>(cursor = cursor->next)) {
+        cursor->value() = *begin;
+        ++begin;
+    }
+    if(n > size) {
+        this->insert_range(&this->tail, n - size, begin);
     }else {
-        for(auto it {this->tail.next}; begin not_eq end; it = it->next) {
-            it->value() = *begin++;
-        }
-        const auto erasion_size {size - n};
-        auto cursor {this->tail};
-        auto &allocator {this->node_size.allocator()};
-        size = n;
-        if(erasion_size < n) {
-            for(auto i {0}; i < erasion_size; ++i) {
-                cursor = cursor->previous;
-            }
-            this->tail->previous = cursor->previous;
-            cursor->previous->next = &this->tail;
-            allocator.deallocate(cursor->node(), this->tail->previous->node(), erasion_size);
-        }else {
-            while(n-- not_eq 0) {
-                cursor = cursor->next;
-            }
-            this->tail->previous = cursor;
-            const auto backup {cursor->next};
-            cursor->next = &this->tail;
-            allocator.deallocate(backup->node(), this->tail->previous->node(), erasion_size);
-        }
+        this->erase(cursor, &this->tail, size - n);
     }
 }
 template <typename T, typename Allocator, typename NodeAllocator>
@@ -489,61 +506,61 @@ constexpr void list<T, Allocator, NodeAllocator>::assign(initializer_list<T> ini
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator list<T, Allocator, NodeAllocator>::begin() noexcept {
-    return iterator {this->tail->next};
+    return iterator {this->tail.next};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_iterator
 list<T, Allocator, NodeAllocator>::begin() const noexcept {
-    return const_iterator {this->tail->next};
+    return const_iterator {this->tail.next};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_iterator
 list<T, Allocator, NodeAllocator>::cbegin() const noexcept {
-    return const_iterator {this->tail->next};
+    return const_iterator {this->tail.next};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator list<T, Allocator, NodeAllocator>::end() noexcept {
-    return iterator {this->tail};
+    return iterator {&this->tail};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_iterator
 list<T, Allocator, NodeAllocator>::end() const noexcept {
-    return const_iterator {this->tail};
+    return const_iterator {const_cast<base_node_type>(&this->tail)};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_iterator
 list<T, Allocator, NodeAllocator>::cend() const noexcept {
-    return const_iterator {this->tail};
+    return const_iterator {const_cast<base_node_type>(&this->tail)};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::reverse_iterator
 list<T, Allocator, NodeAllocator>::rbegin() noexcept {
-    return reverse_iterator {this->tail->previous};
+    return reverse_iterator {iterator {this->tail.previous}};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_reverse_iterator
 list<T, Allocator, NodeAllocator>::rbegin() const noexcept {
-    return const_reverse_iterator {this->tail->previous};
+    return const_reverse_iterator {const_iterator {this->tail.previous}};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_reverse_iterator
 list<T, Allocator, NodeAllocator>::crbegin() const noexcept {
-    return const_reverse_iterator {this->tail->previous};
+    return const_reverse_iterator {const_iterator {this->tail.previous}};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::reverse_iterator
 list<T, Allocator, NodeAllocator>::rend() noexcept {
-    return reverse_iterator {this->tail};
+    return reverse_iterator {this->end()};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_reverse_iterator
 list<T, Allocator, NodeAllocator>::rend() const noexcept {
-    return const_reverse_iterator {this->tail};
+    return const_reverse_iterator {this->cend()};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::const_reverse_iterator
 list<T, Allocator, NodeAllocator>::crend() const noexcept {
-    return const_reverse_iterator {this->tail};
+    return const_reverse_iterator {this->cend()};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::size_type
@@ -556,39 +573,18 @@ constexpr bool list<T, Allocator, NodeAllocator>::empty() const noexcept {
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::resize(size_type n) {
-    this->resize(n, {});
+    if(const auto size {this->node_size()}; n > size) {
+        this->insert_values(&this->tail, n - size);
+    }else if(n < size) {
+        this->erase(this->node_at(n), &this->tail, size - n);
+    }
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::resize(size_type n, const_reference value) {
-    const auto size {this->node_size()};
-    if(n > size) {
-        const auto [first_node, last_node] {this->allocate_values(n - size, value)};
-        first_node->previous = this->tail->previous;
-        this->tail->previous->next = first_node;
-        last_node->next = &this->tail;
-        this->tail->previous = last_node;
-        this->node_size() = n;
+    if(const auto size {this->node_size()}; n > size) {
+        this->insert_values(&this->tail, n - size, value);
     }else if(n < size) {
-        this->node_size() = n;
-        const auto erasion_size {size - n};
-        auto cursor {this->tail};
-        auto &allocator {this->node_size.allocator()};
-        if(erasion_size < n) {
-            for(auto i {0}; i < erasion_size; ++i) {
-                cursor = cursor->previous;
-            }
-            this->tail->previous = cursor->previous;
-            cursor->previous->next = &this->tail;
-            allocator.deallocate(cursor->node(), this->tail->previous->node(), erasion_size);
-        }else {
-            while(n-- not_eq 0) {
-                cursor = cursor->next;
-            }
-            this->tail->previous = cursor;
-            const auto backup {cursor->next};
-            cursor->next = &this->tail;
-            allocator.deallocate(backup->node(), this->tail->previous->node(), erasion_size);
-        }
+        this->erase(this->node_at(n), &this->tail, size - n);
     }
 }
 template <typename T, typename Allocator, typename NodeAllocator>
@@ -611,10 +607,11 @@ list<T, Allocator, NodeAllocator>::back() const noexcept {
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr Allocator list<T, Allocator, NodeAllocator>::allocator() const noexcept {
-    if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
-        return this->node_size.allocator();
+    if constexpr(is_constructible_v<Allocator, const real_allocator &>) {
+        return Allocator(this->node_size.allocator());
+    }else {
+        return {};
     }
-    return {};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::push_front(const_reference value) {
@@ -627,11 +624,7 @@ constexpr void list<T, Allocator, NodeAllocator>::push_front(rvalue_reference va
 template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
 constexpr void list<T, Allocator, NodeAllocator>::emplace_front(Args &&...args) {
-    const node_type node {this->allocate_values(1, ds::forward<Args>(args)...)};
-    node->next = this->tail.next;
-    this->tail.next->previous = node;
-    node->previous = &this->tail;
-    this->tail.next = node;
+    this->insert_values(this->tail.next, 1, ds::forward<Args>(args)...);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::push_back(const_reference value) {
@@ -644,154 +637,93 @@ constexpr void list<T, Allocator, NodeAllocator>::push_back(rvalue_reference val
 template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
 constexpr void list<T, Allocator, NodeAllocator>::emplace_back(Args &&...args) {
-    const node_type node {this->allocate_values(1, ds::forward<Args>(args)...)};
-    node->previous = this->tail.previous;
-    node->next = &this->tail;
-    this->tail.previous->next = node;
-    this->tail.previous = node;
+    this->insert_values(&this->tail, 1, ds::forward<Args>(args)...);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::pop_front() noexcept {
-    const auto backup {this->tail.next};
-    backup->next->previous = &this->tail;
-    this->tail.next = backup->next;
-    this->node_size.allocator().deallocate(backup);
+    this->erase(this->tail.next, this->tail.next->next, 1);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::pop_back() noexcept {
-    const auto backup {this->tail.previous};
-    backup->previous->next = &this->tail;
-    this->tail.previous = backup->previous;
-    this->node_size.allocator().deallocate(backup);
+    this->erase(this->tail.previous, &this->tail, 1);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::clear() noexcept {
-    auto &size {this->node_size()};
-    if(size == 0) {
-        return;
-    }
-    this->node_size.allocator().deallocate(this->tail.next, this->tail.previous, size);
-    this->tail.next = &this->tail;
-    this->tail.previous = &this->tail;
-    size = 0;
+    this->deallocate_nodes(this->tail.next, &this->tail);
+    this->tail.next = this->tail.previous = &this->tail;
+    this->node_size() = 0;
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr void list<T, Allocator, NodeAllocator>::swap(list &rhs) noexcept {
     ds::swap(this->node_size, rhs.node_size);
     ds::swap(this->tail, rhs.tail);
+    this->relink_tail();
+    rhs.relink_tail();
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(size_type pos, const_reference value, size_type n) {
-    auto cursor {this->tail.next};
-    while(pos-- not_eq 0) {
-        cursor = cursor->next;
-    }
-    return this->insert(const_iterator {cursor->node()}, value, n);
+    return this->insert_values(this->node_at(pos), n, value);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(const_iterator pos, const_reference value, size_type n) {
-    if(n == 0) {
-        return iterator {pos.node};
-    }
-    const auto [first_node, last_node] {this->allocate_values(n, value)};
-    first_node->previous = pos.node->previous;
-    last_node->next = pos.node;
-    pos.node->previous->next = first_node;
-    pos.node->previous = last_node;
-    this->node_size() += n;
-    return iterator {first_node};
+    return this->insert_values(pos.node, n, value);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::emplace(size_type pos, Args &&...args) {
-    auto cursor {this->tail.next};
-    while(pos-- not_eq 0) {
-        cursor = cursor->next;
-    }
-    return this->emplace(const_iterator {cursor->node()}, ds::forward<Args>(args)...);
+    return this->insert_values(this->node_at(pos), 1, ds::forward<Args>(args)...);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <typename ...Args>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::emplace(const_iterator pos, Args &&...args) {
-    const node_type node {this->allocate_values(1, ds::forward<Args>(args)...)};
-    node->next = pos.node;
-    node->previous = pos.node->previous;
-    pos.node->previous->next = node;
-    pos.node->previous = node;
-    return iterator {pos.node};
+    return this->insert_values(pos.node, 1, ds::forward<Args>(args)...);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(size_type pos, rvalue_reference value) {
-    auto cursor {this->tail.next};
-    while(pos-- not_eq 0) {
-        cursor = cursor->next;
-    }
-    return this->emplace(const_iterator {cursor->node()}, ds::move(value));
+    return this->insert_values(this->node_at(pos), 1, ds::move(value));
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(const_iterator pos, rvalue_reference value) {
-    return this->emplace(pos, ds::move(value));
+    return this->insert_values(pos.node, 1, ds::move(value));
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(size_type pos, InputIterator begin, InputIterator end,
         size_type default_size) {
-    buffer<T, Allocator> b(begin, end, default_size);
-    auto cursor {this->tail.next};
-    while(pos-- not_eq 0) {
-        cursor = cursor->next;
-    }
-    return this->insert(const_iterator {cursor->node()}, b.mbegin(), b.mend());
+    buffer<T, Allocator> b(begin, end, this->allocator(), default_size);
+    return this->insert_range(this->node_at(pos), b.size(), b.mbegin());
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(const_iterator pos, InputIterator begin, InputIterator end,
         size_type default_size) {
-    buffer<T, Allocator> b(begin, end, default_size);
-    return this->insert(pos, b.mbegin(), b.mend());
+    buffer<T, Allocator> b(begin, end, this->allocator(), default_size);
+    return this->insert_range(pos.node, b.size(), b.mbegin());
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(size_type pos, ForwardIterator begin, ForwardIterator end) {
-    auto cursor {this->tail.next};
-    while(pos-- not_eq 0) {
-        cursor = cursor->next;
-    }
-    return this->insert(const_iterator {cursor->node()}, begin, end);
+    return this->insert_range(this->node_at(pos), static_cast<size_type>(ds::distance(begin, end)), begin);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 template <IsForwardIterator ForwardIterator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(const_iterator pos, ForwardIterator begin, ForwardIterator end) {
-    if(begin == end) {
-        return iterator {pos.node};
-    }
-    const auto n {static_cast<size_type>(ds::distance(begin, end))};
-    const auto [first_node, last_node] {this->allocate_values(n, begin)};
-    first_node->previous = pos.node->previous;
-    last_node->next = pos.node;
-    pos.node->previous->next = first_node;
-    pos.node->previous = last_node;
-    this->node_size() += n;
-    return iterator {first_node};
+    return this->insert_range(pos.node, static_cast<size_type>(ds::distance(begin, end)), begin);
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::insert(size_type pos, initializer_list<T> init_list) {
-    auto cursor {this->tail.next};
-    while(pos-- not_eq 0) {
-        cursor = cursor->next;
-    }
-    return this->insert(const_iterator {cursor->node()}, init_list.begin(), init_list.end());
+    return this->insert(pos, init_list.begin(), init_list.end());
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
@@ -799,43 +731,49 @@ list<T, Allocator, NodeAllocator>::insert(const_iterator pos, initializer_list<T
     return this->insert(pos, init_list.begin(), init_list.end());
 }
 template <typename T, typename Allocator, typename NodeAllocator>
+template <IsRange Range>
+constexpr void list<T, Allocator, NodeAllocator>::append_range(Range &&range) {
+    // the range is sized once, so the pool of NodeAllocator takes all the nodes in one batch
+    if constexpr(is_forward_iterator_v<range_iterator_t<Range>>) {
+        this->insert_range(&this->tail, static_cast<size_type>(ds::range_size(range)), ds::begin(range));
+    }else {
+        buffer<T, Allocator> b(ds::begin(range), ds::end(range), this->allocator());
+        this->insert_range(&this->tail, b.size(), b.mbegin());
+    }
+}
+template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::erase(size_type pos, size_type n) {
-    auto begin {this->tail.next};
-    while(pos-- not_eq 0) {
-        begin = begin->next;
-    }
+    const auto begin {this->node_at(pos)};
     auto end {begin};
-    for(auto i {0}; i < n; ++i, static_cast<void>(end = end->next));
-    return this->erase(const_iterator {begin}, const_iterator {end}, n);
+    for(auto i {n}; i not_eq 0; --i) {
+        end = end->next;
+    }
+    this->erase(begin, end, n);
+    return iterator {end};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::erase(const_iterator begin, size_type n) {
-    auto end {begin};
-    for(auto i {0}; i < n; ++i, static_cast<void>(end = end->next));
-    return this->erase(const_iterator {begin}, const_iterator {end}, n);
+    auto end {begin.node};
+    for(auto i {n}; i not_eq 0; --i) {
+        end = end->next;
+    }
+    this->erase(begin.node, end, n);
+    return iterator {end};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::erase(const_iterator pos) {
-    const auto result_node {pos.node->next};
-    result_node->previous = pos.node->previous;
-    pos.node->previous->next = result_node;
-    if constexpr(__dsa::IsLinkedAfterAllocation<real_allocator>) {
-        ds::destroy(ds::address_of(pos.node->value));
-        this->node_size.allocator().deallocate(pos.node);
-    }else {
-        this->node_size.allocator().deallocate<true>(pos.node);
-    }
-    return iterator {result_node->node()};
+    const auto next {pos.node->next};
+    this->erase(pos.node, next, 1);
+    return iterator {next};
 }
 template <typename T, typename Allocator, typename NodeAllocator>
 constexpr typename list<T, Allocator, NodeAllocator>::iterator
 list<T, Allocator, NodeAllocator>::erase(const_iterator begin, const_iterator end) {
-    const auto result_node {end.node->next};
     this->erase(begin.node, end.node, static_cast<size_type>(ds::distance(begin, end)));
-    return iterator {result_node->node()};
+    return iterator {end.node};
 }
 __DATA_STRUCTURE_END(list implementation)
 
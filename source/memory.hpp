@@ -39,6 +39,11 @@ inline constexpr T *construct(T *p, Args &&...args) noexcept(is_nothrow_construc
     return p;
 }
 template <typename T>
+inline constexpr T *default_construct(T *p) noexcept(is_nothrow_default_constructible_v<T>) {
+    // default-initialization, the trivially default constructible object is left uninitialized
+    return new (static_cast<void *>(ds::address_of(*p))) T;
+}
+template <typename T>
 inline constexpr void destroy(T *p) noexcept(is_nothrow_destructible_v<T>) {
     if constexpr(not is_trivially_destructible_v<T>) {
         p->~T();
@@ -54,6 +59,13 @@ inline constexpr void destroy(T *begin, T *end) noexcept(is_nothrow_destructible
 }
 __DATA_STRUCTURE_END(object construction and destruction)
 
+__DATA_STRUCTURE_START(tag for construction which will be overwritten)
+struct for_overwrite_tag {
+    explicit for_overwrite_tag() = default;
+};
+inline constexpr for_overwrite_tag for_overwrite {};
+__DATA_STRUCTURE_END(tag for construction which will be overwritten)
+
 }       // namespace data_structure
 
 #endif      // DATA_STRUCTURE_MEMORY_HPP
\ No newline at end of file
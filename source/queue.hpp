@@ -22,7 +22,7 @@
 namespace data_structure {
 
 __DATA_STRUCTURE_START(queue implementation)
-template <typename T, typename Container>
+template <typename T, typename Container = deque<T>>
 class queue {
 public:
     using container_type = Container;
@@ -95,7 +95,7 @@ public:
         this->container.emplace_back(ds::forward<Args>(args)...);
     }
     constexpr void pop() noexcept {
-        this->container.pop_back();
+        this->container.pop_front();
     }
 };
 __DATA_STRUCTURE_END(queue implementation)
@@ -0,0 +1,278 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_SIMD_ALGORITHM_HPP
+#define DATA_STRUCTURE_SIMD_ALGORITHM_HPP
+
+#include "iterator.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define __DATA_STRUCTURE_X86_SIMD
+#define __DATA_STRUCTURE_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(vectorized kernels)
+namespace __data_structure_implement {
+/*
+ * The kernels of ds::find, ds::count, ds::min_element and ds::max_element on the integers of 1, 2, 4 or 8 bytes.
+ * Only algorithm.hpp includes this header, so the containers which just compare their elements (compare.hpp) do not
+ * parse <immintrin.h>. SSE2 is the baseline of x86-64, AVX2 is detected at runtime unless the library is compiled
+ * with it, the other platforms use the scalar loops.
+ */
+#ifdef __DATA_STRUCTURE_X86_SIMD
+[[nodiscard]]
+inline bool has_avx2() noexcept {
+#ifdef __AVX2__
+    return true;
+#else
+    static const auto result {__builtin_cpu_supports("avx2") not_eq 0};
+    return result;
+#endif
+}
+
+template <typename T>
+[[nodiscard]]
+inline __m128i sse2_broadcast(T value) noexcept {
+    if constexpr(sizeof(T) == 1) {
+        return _mm_set1_epi8(static_cast<char>(value));
+    }else if constexpr(sizeof(T) == 2) {
+        return _mm_set1_epi16(static_cast<short>(value));
+    }else if constexpr(sizeof(T) == 4) {
+        return _mm_set1_epi32(static_cast<int>(value));
+    }else {
+        return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+}
+template <typename T>
+[[nodiscard]]
+inline __m128i sse2_equal(__m128i lhs, __m128i rhs) noexcept {
+    if constexpr(sizeof(T) == 1) {
+        return _mm_cmpeq_epi8(lhs, rhs);
+    }else if constexpr(sizeof(T) == 2) {
+        return _mm_cmpeq_epi16(lhs, rhs);
+    }else if constexpr(sizeof(T) == 4) {
+        return _mm_cmpeq_epi32(lhs, rhs);
+    }else {
+        // SSE2 has no 64-bit comparison, both 32-bit halves should be equal
+        const auto result {_mm_cmpeq_epi32(lhs, rhs)};
+        return _mm_and_si128(result, _mm_shuffle_epi32(result, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+}
+template <typename T>
+[[nodiscard]]
+__DATA_STRUCTURE_TARGET_AVX2 inline __m256i avx2_broadcast(T value) noexcept {
+    if constexpr(sizeof(T) == 1) {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    }else if constexpr(sizeof(T) == 2) {
+        return _mm256_set1_epi16(static_cast<short>(value));
+    }else if constexpr(sizeof(T) == 4) {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    }else {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+}
+template <typename T>
+[[nodiscard]]
+__DATA_STRUCTURE_TARGET_AVX2 inline __m256i avx2_equal(__m256i lhs, __m256i rhs) noexcept {
+    if constexpr(sizeof(T) == 1) {
+        return _mm256_cmpeq_epi8(lhs, rhs);
+    }else if constexpr(sizeof(T) == 2) {
+        return _mm256_cmpeq_epi16(lhs, rhs);
+    }else if constexpr(sizeof(T) == 4) {
+        return _mm256_cmpeq_epi32(lhs, rhs);
+    }else {
+        return _mm256_cmpeq_epi64(lhs, rhs);
+    }
+}
+template <typename T, bool Min>
+[[nodiscard]]
+__DATA_STRUCTURE_TARGET_AVX2 inline __m256i avx2_select(__m256i lhs, __m256i rhs) noexcept {
+    if constexpr(sizeof(T) == 1) {
+        if constexpr(is_signed_v<T>) {
+            return Min ? _mm256_min_epi8(lhs, rhs) : _mm256_max_epi8(lhs, rhs);
+        }else {
+            return Min ? _mm256_min_epu8(lhs, rhs) : _mm256_max_epu8(lhs, rhs);
+        }
+    }else if constexpr(sizeof(T) == 2) {
+        if constexpr(is_signed_v<T>) {
+            return Min ? _mm256_min_epi16(lhs, rhs) : _mm256_max_epi16(lhs, rhs);
+        }else {
+            return Min ? _mm256_min_epu16(lhs, rhs) : _mm256_max_epu16(lhs, rhs);
+        }
+    }else {
+        if constexpr(is_signed_v<T>) {
+            return Min ? _mm256_min_epi32(lhs, rhs) : _mm256_max_epi32(lhs, rhs);
+        }else {
+            return Min ? _mm256_min_epu32(lhs, rhs) : _mm256_max_epu32(lhs, rhs);
+        }
+    }
+}
+
+template <typename T>
+[[nodiscard]]
+inline const T *sse2_find(const T *begin, const T *end, T value) noexcept {
+    constexpr auto lanes {16 / sizeof(T)};
+    const auto target {__dsi::sse2_broadcast(value)};
+    for(; static_cast<size_t>(end - begin) >= lanes; begin += lanes) {
+        const auto block {_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin))};
+        const auto mask {static_cast<unsigned>(_mm_movemask_epi8(__dsi::sse2_equal<T>(block, target)))};
+        if(mask not_eq 0) {
+            return begin + ds::countr_zero(mask) / sizeof(T);
+        }
+    }
+    while(begin not_eq end and *begin not_eq value) {
+        ++begin;
+    }
+    return begin;
+}
+template <typename T>
+[[nodiscard]]
+__DATA_STRUCTURE_TARGET_AVX2 inline const T *avx2_find(const T *begin, const T *end, T value) noexcept {
+    constexpr auto lanes {32 / sizeof(T)};
+    const auto target {__dsi::avx2_broadcast(value)};
+    for(; static_cast<size_t>(end - begin) >= lanes; begin += lanes) {
+        const auto block {_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin))};
+        const auto mask {static_cast<unsigned>(_mm256_movemask_epi8(__dsi::avx2_equal<T>(block, target)))};
+        if(mask not_eq 0) {
+            return begin + ds::countr_zero(mask) / sizeof(T);
+        }
+    }
+    while(begin not_eq end and *begin not_eq value) {
+        ++begin;
+    }
+    return begin;
+}
+template <typename T>
+[[nodiscard]]
+inline size_t sse2_count(const T *begin, const T *end, T value) noexcept {
+    constexpr auto lanes {16 / sizeof(T)};
+    const auto target {__dsi::sse2_broadcast(value)};
+    auto result {0uz};
+    for(; static_cast<size_t>(end - begin) >= lanes; begin += lanes) {
+        const auto block {_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin))};
+        const auto mask {static_cast<unsigned>(_mm_movemask_epi8(__dsi::sse2_equal<T>(block, target)))};
+        result += static_cast<size_t>(ds::popcount(mask)) / sizeof(T);
+    }
+    for(; begin not_eq end; ++begin) {
+        result += *begin == value;
+    }
+    return result;
+}
+template <typename T>
+[[nodiscard]]
+__DATA_STRUCTURE_TARGET_AVX2 inline size_t avx2_count(const T *begin, const T *end, T value) noexcept {
+    constexpr auto lanes {32 / sizeof(T)};
+    const auto target {__dsi::avx2_broadcast(value)};
+    auto result {0uz};
+    for(; static_cast<size_t>(end - begin) >= lanes; begin += lanes) {
+        const auto block {_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin))};
+        const auto mask {static_cast<unsigned>(_mm256_movemask_epi8(__dsi::avx2_equal<T>(block, target)))};
+        result += static_cast<size_t>(ds::popcount(mask)) / sizeof(T);
+    }
+    for(; begin not_eq end; ++begin) {
+        result += *begin == value;
+    }
+    return result;
+}
+template <typename T, bool Min>
+[[nodiscard]]
+__DATA_STRUCTURE_TARGET_AVX2 inline T avx2_extreme(const T *begin, const T *end) noexcept {
+    // the range should not be empty
+    constexpr auto lanes {32 / sizeof(T)};
+    auto result {*begin};
+    if(static_cast<size_t>(end - begin) >= lanes) {
+        auto extreme {_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin))};
+        for(begin += lanes; static_cast<size_t>(end - begin) >= lanes; begin += lanes) {
+            extreme = __dsi::avx2_select<T, Min>(extreme,
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin)));
+        }
+        T lane_values[lanes];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lane_values), extreme);
+        for(auto value : lane_values) {
+            if(Min ? value < result : result < value) {
+                result = value;
+            }
+        }
+    }
+    for(; begin not_eq end; ++begin) {
+        if(Min ? *begin < result : result < *begin) {
+            result = *begin;
+        }
+    }
+    return result;
+}
+#endif
+
+template <typename T>
+[[nodiscard]]
+inline const T *vectorized_find(const T *begin, const T *end, T value) noexcept {
+    if constexpr(sizeof(T) == 1) {
+        const auto result {ds::memory_character_search(begin, static_cast<unsigned char>(value),
+                static_cast<size_t>(end - begin))};
+        return result ? static_cast<const T *>(result) : end;
+    }else {
+#ifdef __DATA_STRUCTURE_X86_SIMD
+        return __dsi::has_avx2() ? __dsi::avx2_find(begin, end, value) : __dsi::sse2_find(begin, end, value);
+#else
+        while(begin not_eq end and *begin not_eq value) {
+            ++begin;
+        }
+        return begin;
+#endif
+    }
+}
+template <typename T>
+[[nodiscard]]
+inline size_t vectorized_count(const T *begin, const T *end, T value) noexcept {
+#ifdef __DATA_STRUCTURE_X86_SIMD
+    return __dsi::has_avx2() ? __dsi::avx2_count(begin, end, value) : __dsi::sse2_count(begin, end, value);
+#else
+    auto result {0uz};
+    for(; begin not_eq end; ++begin) {
+        result += *begin == value;
+    }
+    return result;
+#endif
+}
+template <typename T, bool Min>
+[[nodiscard]]
+inline T vectorized_extreme(const T *begin, const T *end) noexcept {
+    // the range should not be empty, SSE2 lacks most of the integer min/max instructions, so it is left to the
+    //  auto-vectorization of the scalar loop
+#ifdef __DATA_STRUCTURE_X86_SIMD
+    if constexpr(sizeof(T) <= 4) {
+        if(__dsi::has_avx2()) {
+            return __dsi::avx2_extreme<T, Min>(begin, end);
+        }
+    }
+#endif
+    auto result {*begin};
+    for(++begin; begin not_eq end; ++begin) {
+        if(Min ? *begin < result : result < *begin) {
+            result = *begin;
+        }
+    }
+    return result;
+}
+}
+__DATA_STRUCTURE_END(vectorized kernels)
+
+}       // namespace data_structure
+
+#endif      //DATA_STRUCTURE_SIMD_ALGORITHM_HPP
@@ -0,0 +1,647 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_SORT_HPP
+#define DATA_STRUCTURE_SORT_HPP
+
+#include "allocator.hpp"
+#include "algorithm.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(pattern-defeating quicksort)
+namespace __data_structure_implement {
+/*
+ * The pattern-defeating quicksort of Orson Peters. The ranges shorter than insertion_sort_threshold are sorted by
+ * insertion sort, the pivot is the median of 3 (or the ninther for the long ranges), the partitions which look
+ * already sorted are finished by a bounded insertion sort, and the recursion falls back to heap sort after
+ * log(n) highly unbalanced partitions, so the worst case is O(n log n). The arithmetic types compared by less or
+ * greater are partitioned by the branchless block partition (BlockQuicksort), which avoids the mispredictions.
+ */
+inline constexpr ptrdiff_t insertion_sort_threshold {24};
+inline constexpr ptrdiff_t ninther_threshold {128};
+inline constexpr ptrdiff_t partial_insertion_sort_limit {8};
+inline constexpr size_t partition_block_size {64};
+
+template <typename Iterator>
+struct partition_result {
+    Iterator pivot;
+    bool already_partitioned;
+};
+template <typename T, typename Compare>
+inline constexpr bool is_branchless_comparison_v {
+    is_arithmetic_v<T> and (is_same_v<Compare, less<>> or is_same_v<Compare, less<T>> or
+            is_same_v<Compare, greater<>> or is_same_v<Compare, greater<T>>)
+};
+
+template <typename Iterator>
+inline constexpr void iterator_swap(Iterator lhs, Iterator rhs) {
+    using ds::swap;
+    swap(*lhs, *rhs);
+}
+template <typename RandomAccessIterator, typename Compare>
+constexpr void insertion_sort(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    if(begin == end) {
+        return;
+    }
+    for(auto cursor {begin + 1}; cursor not_eq end; ++cursor) {
+        auto sift {cursor};
+        auto previous {cursor - 1};
+        if(compare(*sift, *previous)) {
+            auto value {ds::move(*sift)};
+            do {
+                *sift-- = ds::move(*previous);
+            }while(sift not_eq begin and compare(value, *--previous));
+            *sift = ds::move(value);
+        }
+    }
+}
+// *(begin - 1) should not be greater than any element of [begin, end), so it works as the sentinel
+template <typename RandomAccessIterator, typename Compare>
+constexpr void unguarded_insertion_sort(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    if(begin == end) {
+        return;
+    }
+    for(auto cursor {begin + 1}; cursor not_eq end; ++cursor) {
+        auto sift {cursor};
+        auto previous {cursor - 1};
+        if(compare(*sift, *previous)) {
+            auto value {ds::move(*sift)};
+            do {
+                *sift-- = ds::move(*previous);
+            }while(compare(value, *--previous));
+            *sift = ds::move(value);
+        }
+    }
+}
+// gives up (returns false) after partial_insertion_sort_limit elements are moved
+template <typename RandomAccessIterator, typename Compare>
+constexpr bool partial_insertion_sort(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    if(begin == end) {
+        return true;
+    }
+    ptrdiff_t limit {0};
+    for(auto cursor {begin + 1}; cursor not_eq end; ++cursor) {
+        auto sift {cursor};
+        auto previous {cursor - 1};
+        if(compare(*sift, *previous)) {
+            auto value {ds::move(*sift)};
+            do {
+                *sift-- = ds::move(*previous);
+            }while(sift not_eq begin and compare(value, *--previous));
+            *sift = ds::move(value);
+            limit += cursor - sift;
+        }
+        if(limit > partial_insertion_sort_limit) {
+            return false;
+        }
+    }
+    return true;
+}
+template <typename RandomAccessIterator, typename Compare>
+constexpr void sort2(RandomAccessIterator a, RandomAccessIterator b, Compare &compare) {
+    if(compare(*b, *a)) {
+        __dsi::iterator_swap(a, b);
+    }
+}
+template <typename RandomAccessIterator, typename Compare>
+constexpr void sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, Compare &compare) {
+    __dsi::sort2(a, b, compare);
+    __dsi::sort2(b, c, compare);
+    __dsi::sort2(a, b, compare);
+}
+template <typename RandomAccessIterator, typename Compare>
+constexpr void sift_down(RandomAccessIterator begin, ptrdiff_t size, ptrdiff_t hole, Compare &compare) {
+    auto value {ds::move(begin[hole])};
+    for(auto child {2 * hole + 1}; child < size; child = 2 * hole + 1) {
+        if(child + 1 < size and compare(begin[child], begin[child + 1])) {
+            ++child;
+        }
+        if(not compare(value, begin[child])) {
+            break;
+        }
+        begin[hole] = ds::move(begin[child]);
+        hole = child;
+    }
+    begin[hole] = ds::move(value);
+}
+template <typename RandomAccessIterator, typename Compare>
+constexpr void heap_sort(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    auto size {static_cast<ptrdiff_t>(end - begin)};
+    for(auto i {size / 2}; i > 0;) {
+        __dsi::sift_down(begin, size, --i, compare);
+    }
+    while(size > 1) {
+        __dsi::iterator_swap(begin, begin + --size);
+        __dsi::sift_down(begin, size, 0, compare);
+    }
+}
+/*
+ * Partitions [begin, end) around *begin, the elements equal to the pivot go to the right partition. The result is
+ * the position of the pivot and whether the range was already partitioned (no element was swapped).
+ */
+template <typename RandomAccessIterator, typename Compare>
+constexpr partition_result<RandomAccessIterator>
+partition_right(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    auto pivot {ds::move(*begin)};
+    auto first {begin};
+    auto last {end};
+    // the median of 3 guarantees an element not less than the pivot exists, so the first loop is unguarded
+    while(compare(*++first, pivot));
+    if(first - 1 == begin) {
+        while(first < last and not compare(*--last, pivot));
+    }else {
+        while(not compare(*--last, pivot));
+    }
+    const auto already_partitioned {first >= last};
+    while(first < last) {
+        __dsi::iterator_swap(first, last);
+        while(compare(*++first, pivot));
+        while(not compare(*--last, pivot));
+    }
+    auto pivot_position {first - 1};
+    *begin = ds::move(*pivot_position);
+    *pivot_position = ds::move(pivot);
+    return {pivot_position, already_partitioned};
+}
+template <typename RandomAccessIterator>
+constexpr void swap_offsets(RandomAccessIterator first, RandomAccessIterator last, const unsigned char *left_offsets,
+        const unsigned char *right_offsets, size_t n, bool use_swaps) {
+    if(use_swaps) {
+        // the two blocks are exhausted together, the cyclic permutation would leave one element in the wrong side
+        for(auto i {0uz}; i < n; ++i) {
+            __dsi::iterator_swap(first + left_offsets[i], last - right_offsets[i]);
+        }
+    }else if(n > 0) {
+        auto left {first + left_offsets[0]};
+        auto right {last - right_offsets[0]};
+        auto value {ds::move(*left)};
+        *left = ds::move(*right);
+        for(auto i {1uz}; i < n; ++i) {
+            left = first + left_offsets[i];
+            *right = ds::move(*left);
+            right = last - right_offsets[i];
+            *left = ds::move(*right);
+        }
+        *right = ds::move(value);
+    }
+}
+// the branchless version of partition_right, the comparison results are recorded as offsets in small blocks
+template <typename RandomAccessIterator, typename Compare>
+constexpr partition_result<RandomAccessIterator>
+partition_right_branchless(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    auto pivot {ds::move(*begin)};
+    auto first {begin};
+    auto last {end};
+    while(compare(*++first, pivot));
+    if(first - 1 == begin) {
+        while(first < last and not compare(*--last, pivot));
+    }else {
+        while(not compare(*--last, pivot));
+    }
+    const auto already_partitioned {first >= last};
+    if(not already_partitioned) {
+        __dsi::iterator_swap(first, last);
+        ++first;
+        alignas(64) unsigned char left_offsets[partition_block_size];
+        alignas(64) unsigned char right_offsets[partition_block_size];
+        auto left_base {first};
+        auto right_base {last};
+        size_t left_n {0}, right_n {0}, left_start {0}, right_start {0};
+        while(first < last) {
+            // fills the empty blocks, the last round splits the unknown elements between the blocks
+            const auto unknown {static_cast<size_t>(last - first)};
+            const auto left_split {left_n == 0 ? right_n == 0 ? unknown / 2 : unknown : 0};
+            const auto right_split {right_n == 0 ? unknown - left_split : 0};
+            const auto left_size {left_split < partition_block_size ? left_split : partition_block_size};
+            for(auto i {0uz}; i < left_size; ++i) {
+                left_offsets[left_n] = static_cast<unsigned char>(i);
+                left_n += not compare(*first, pivot);
+                ++first;
+            }
+            const auto right_size {right_split < partition_block_size ? right_split : partition_block_size};
+            for(auto i {0uz}; i < right_size;) {
+                right_offsets[right_n] = static_cast<unsigned char>(++i);
+                right_n += compare(*--last, pivot);
+            }
+            const auto n {left_n < right_n ? left_n : right_n};
+            __dsi::swap_offsets(left_base, right_base, left_offsets + left_start, right_offsets + right_start, n,
+                    left_n == right_n);
+            left_n -= n;
+            right_n -= n;
+            left_start += n;
+            right_start += n;
+            if(left_n == 0) {
+                left_start = 0;
+                left_base = first;
+            }
+            if(right_n == 0) {
+                right_start = 0;
+                right_base = last;
+            }
+        }
+        // one of the blocks may have the misplaced elements, which are moved to the boundary
+        if(left_n not_eq 0) {
+            const auto offsets {left_offsets + left_start};
+            while(left_n-- not_eq 0) {
+                __dsi::iterator_swap(left_base + offsets[left_n], --last);
+            }
+            first = last;
+        }
+        if(right_n not_eq 0) {
+            const auto offsets {right_offsets + right_start};
+            while(right_n-- not_eq 0) {
+                __dsi::iterator_swap(right_base - offsets[right_n], first);
+                ++first;
+            }
+        }
+    }
+    auto pivot_position {first - 1};
+    *begin = ds::move(*pivot_position);
+    *pivot_position = ds::move(pivot);
+    return {pivot_position, already_partitioned};
+}
+// the elements equal to the pivot go to the left partition, it's used when the pivot equals to *(begin - 1)
+template <typename RandomAccessIterator, typename Compare>
+constexpr RandomAccessIterator partition_left(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    auto pivot {ds::move(*begin)};
+    auto first {begin};
+    auto last {end};
+    while(compare(pivot, *--last));
+    if(last + 1 == end) {
+        while(first < last and not compare(pivot, *++first));
+    }else {
+        while(not compare(pivot, *++first));
+    }
+    while(first < last) {
+        __dsi::iterator_swap(first, last);
+        while(compare(pivot, *--last));
+        while(not compare(pivot, *++first));
+    }
+    *begin = ds::move(*last);
+    *last = ds::move(pivot);
+    return last;
+}
+template <bool Branchless, typename RandomAccessIterator, typename Compare>
+constexpr void pdqsort_loop(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare, int bad_allowed,
+        bool leftmost) {
+    while(true) {
+        const auto size {static_cast<ptrdiff_t>(end - begin)};
+        if(size < insertion_sort_threshold) {
+            if(leftmost) {
+                __dsi::insertion_sort(begin, end, compare);
+            }else {
+                __dsi::unguarded_insertion_sort(begin, end, compare);
+            }
+            return;
+        }
+        const auto half {size / 2};
+        if(size > ninther_threshold) {
+            __dsi::sort3(begin, begin + half, end - 1, compare);
+            __dsi::sort3(begin + 1, begin + (half - 1), end - 2, compare);
+            __dsi::sort3(begin + 2, begin + (half + 1), end - 3, compare);
+            __dsi::sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+            __dsi::iterator_swap(begin, begin + half);
+        }else {
+            __dsi::sort3(begin + half, begin, end - 1, compare);
+        }
+        // the pivot equals to the element before the range, so all the elements equal to it are put in place at once
+        if(not leftmost and not compare(*(begin - 1), *begin)) {
+            begin = __dsi::partition_left(begin, end, compare) + 1;
+            continue;
+        }
+        auto [pivot, already_partitioned] {[&] {
+            if constexpr(Branchless) {
+                return __dsi::partition_right_branchless(begin, end, compare);
+            }else {
+                return __dsi::partition_right(begin, end, compare);
+            }
+        }()};
+        const auto left_size {static_cast<ptrdiff_t>(pivot - begin)};
+        const auto right_size {static_cast<ptrdiff_t>(end - (pivot + 1))};
+        if(left_size < size / 8 or right_size < size / 8) {
+            if(--bad_allowed == 0) {
+                __dsi::heap_sort(begin, end, compare);
+                return;
+            }
+            // breaks the patterns which made the partition unbalanced
+            if(left_size >= insertion_sort_threshold) {
+                __dsi::iterator_swap(begin, begin + left_size / 4);
+                __dsi::iterator_swap(pivot - 1, pivot - left_size / 4);
+                if(left_size > ninther_threshold) {
+                    __dsi::iterator_swap(begin + 1, begin + (left_size / 4 + 1));
+                    __dsi::iterator_swap(begin + 2, begin + (left_size / 4 + 2));
+                    __dsi::iterator_swap(pivot - 2, pivot - (left_size / 4 + 1));
+                    __dsi::iterator_swap(pivot - 3, pivot - (left_size / 4 + 2));
+                }
+            }
+            if(right_size >= insertion_sort_threshold) {
+                __dsi::iterator_swap(pivot + 1, pivot + (1 + right_size / 4));
+                __dsi::iterator_swap(end - 1, end - right_size / 4);
+                if(right_size > ninther_threshold) {
+                    __dsi::iterator_swap(pivot + 2, pivot + (2 + right_size / 4));
+                    __dsi::iterator_swap(pivot + 3, pivot + (3 + right_size / 4));
+                    __dsi::iterator_swap(end - 2, end - (1 + right_size / 4));
+                    __dsi::iterator_swap(end - 3, end - (2 + right_size / 4));
+                }
+            }
+        }else if(already_partitioned and __dsi::partial_insertion_sort(begin, pivot, compare) and
+                __dsi::partial_insertion_sort(pivot + 1, end, compare)) {
+            return;
+        }
+        // recurses into the left partition and loops on the right one
+        __dsi::pdqsort_loop<Branchless>(begin, pivot, compare, bad_allowed, leftmost);
+        begin = pivot + 1;
+        leftmost = false;
+    }
+}
+template <typename RandomAccessIterator, typename Compare>
+constexpr void pdqsort(RandomAccessIterator begin, RandomAccessIterator end, Compare &compare) {
+    const auto size {static_cast<size_t>(end - begin)};
+    if(size < 2) {
+        return;
+    }
+    using value_type = remove_cv_t<typename iterator_traits<RandomAccessIterator>::value_type>;
+    const auto log2 {static_cast<int>(sizeof(size_t) * 8 - 1) - ds::countl_zero(size)};
+    __dsi::pdqsort_loop<is_branchless_comparison_v<value_type, Compare>>(begin, end, compare, log2, true);
+}
+}
+__DATA_STRUCTURE_END(pattern-defeating quicksort)
+
+__DATA_STRUCTURE_START(LSD radix sort)
+namespace __data_structure_implement {
+/*
+ * The keys are mapped to the unsigned integers of the same width whose order is the order of the keys : the sign bit
+ * of the signed integers is flipped, all bits of the negative floating point numbers are flipped and the sign bit of
+ * the others is flipped. Then -0.0 is ordered before 0.0, the NaNs with the sign bit go to the front and the others
+ * go to the back. Each pass distributes the elements by one byte of the keys, the histograms of all passes are
+ * counted in one scan, and the passes whose byte is same for all keys are skipped.
+ */
+inline constexpr size_t radix_sort_threshold {256};
+
+template <typename T>
+inline constexpr bool is_radix_sortable_v {
+    (is_integral_v<T> and not is_same_v<T, bool>) or (is_floating_point_v<T> and (sizeof(T) == 4 or sizeof(T) == 8))
+};
+template <typename T>
+using radix_key_t = conditional_t<sizeof(T) == 1, unsigned char, conditional_t<sizeof(T) == 2, unsigned short,
+        conditional_t<sizeof(T) == 4, unsigned int, unsigned long long>>>;
+
+template <typename T>
+[[nodiscard]]
+inline constexpr radix_key_t<T> radix_key(T value) noexcept {
+    using key_type = radix_key_t<T>;
+    constexpr auto sign {static_cast<key_type>(static_cast<key_type>(1) << (sizeof(T) * 8 - 1))};
+    if constexpr(is_floating_point_v<T>) {
+        const auto bits {__builtin_bit_cast(key_type, value)};
+        return (bits & sign) not_eq 0 ? static_cast<key_type>(~bits) : static_cast<key_type>(bits | sign);
+    }else if constexpr(is_signed_v<T>) {
+        return static_cast<key_type>(static_cast<key_type>(value) ^ sign);
+    }else {
+        return static_cast<key_type>(value);
+    }
+}
+// the order of the keys, which is taken by the short ranges so that they are ordered as the long ones
+struct radix_key_less {
+    template <typename T>
+    [[nodiscard]]
+    constexpr bool operator()(T lhs, T rhs) const noexcept {
+        return __dsi::radix_key(lhs) < __dsi::radix_key(rhs);
+    }
+};
+template <typename T>
+void radix_sort(T *begin, T *end, T *scratch) noexcept {
+    constexpr auto passes {sizeof(T)};
+    const auto size {static_cast<size_t>(end - begin)};
+    size_t histogram[passes][256] {};
+    for(auto cursor {begin}; cursor not_eq end; ++cursor) {
+        auto key {__dsi::radix_key(*cursor)};
+        for(auto pass {0uz}; pass < passes; ++pass) {
+            ++histogram[pass][key & 0xFF];
+            key = static_cast<radix_key_t<T>>(key >> 8);
+        }
+    }
+    auto source {begin};
+    auto destination {scratch};
+    for(auto pass {0uz}; pass < passes; ++pass) {
+        auto &counts {histogram[pass]};
+        const auto shift {pass * 8};
+        if(counts[(__dsi::radix_key(*source) >> shift) & 0xFF] == size) {
+            continue;
+        }
+        for(size_t offset {0}; auto &count : counts) {
+            const auto n {count};
+            count = offset;
+            offset += n;
+        }
+        for(auto cursor {source}, last {source + size}; cursor not_eq last; ++cursor) {
+            destination[counts[(__dsi::radix_key(*cursor) >> shift) & 0xFF]++] = *cursor;
+        }
+        const auto next_source {destination};
+        destination = source;
+        source = next_source;
+    }
+    if(source not_eq begin) {
+        ds::memory_copy(begin, source, sizeof(T) * size);
+    }
+}
+}
+__DATA_STRUCTURE_END(LSD radix sort)
+
+__DATA_STRUCTURE_START(segmented sort)
+namespace __data_structure_implement {
+/*
+ * merge_runs moves the elements of two sorted runs to out, the elements of the first run go first if they are
+ * equivalent, so the merging is stable.
+ *
+ * The segments (e.g. the blocks of deque) are sorted by pdqsort on their pointers first, then the sorted runs are
+ * merged pairwise, the elements go back and forth between the segmented range and a contiguous scratch buffer, so
+ * the segmented iterators are only stepped sequentially. The merging needs the elements to be trivially copyable
+ * (the scratch buffer is not initialized), the other types and the failure of allocating the scratch buffer fall
+ * back to pdqsort on the segmented iterators.
+ */
+template <typename BidirectionalIterator, typename InputIterator, typename OutputIterator, typename Compare>
+constexpr OutputIterator merge_runs(BidirectionalIterator begin1, BidirectionalIterator end1, InputIterator begin2,
+        InputIterator end2, OutputIterator out, Compare &compare) {
+    // the runs which are in order already are copied only
+    if(begin1 not_eq end1 and begin2 not_eq end2 and compare(*begin2, *(end1 - 1))) {
+        if constexpr(is_pointer_v<BidirectionalIterator> and is_pointer_v<InputIterator> and
+                is_branchless_comparison_v<remove_cv_t<remove_pointer_t<InputIterator>>, Compare>) {
+            // the contiguous runs are merged without branches, the pointers advance by the comparison result
+            do {
+                const auto from_second {compare(*begin2, *begin1)};
+                *out = ds::move(from_second ? *begin2 : *begin1);
+                ++out;
+                begin2 += from_second;
+                begin1 += not from_second;
+            }while(begin1 not_eq end1 and begin2 not_eq end2);
+        }else {
+            while(true) {
+                if(compare(*begin2, *begin1)) {
+                    *out = ds::move(*begin2);
+                    ++out;
+                    if(++begin2 == end2) {
+                        break;
+                    }
+                }else {
+                    *out = ds::move(*begin1);
+                    ++out;
+                    if(++begin1 == end1) {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    for(; begin1 not_eq end1; ++begin1, static_cast<void>(++out)) {
+        *out = ds::move(*begin1);
+    }
+    for(; begin2 not_eq end2; ++begin2, static_cast<void>(++out)) {
+        *out = ds::move(*begin2);
+    }
+    return out;
+}
+/*
+ * The run i (i > 0) starts at first_run + (i - 1) * segment_size, the first run is the part of the range in the
+ * first segment
+ */
+template <typename Source, typename Destination, typename Compare>
+void merge_pass(Source source, Destination destination, size_t size, size_t first_run, size_t segment_size,
+        size_t runs, size_t width, Compare &compare) {
+    const auto run_start {[=](size_t i) noexcept -> ptrdiff_t {
+        if(i >= runs) {
+            return static_cast<ptrdiff_t>(size);
+        }
+        return static_cast<ptrdiff_t>(i == 0 ? 0 : first_run + (i - 1) * segment_size);
+    }};
+    for(auto i {0uz}; i < runs; i += 2 * width) {
+        const auto begin {run_start(i)}, middle {run_start(i + width)}, end {run_start(i + 2 * width)};
+        __dsi::merge_runs(source + begin, source + middle, source + middle, source + end, destination + begin,
+                compare);
+    }
+}
+template <typename SegmentedIterator, typename Compare>
+void segmented_sort(SegmentedIterator begin, SegmentedIterator end, Compare &compare) {
+    using traits = __dsa::segmented_iterator_traits<SegmentedIterator>;
+    using value_type = remove_cv_t<typename iterator_traits<SegmentedIterator>::value_type>;
+    const auto size {static_cast<size_t>(end - begin)};
+    if(size < 2) {
+        return;
+    }
+    auto segment {traits::segment(begin)};
+    const auto last_segment {traits::segment(end)};
+    if(segment == last_segment) {
+        __dsi::pdqsort(traits::local(begin), traits::local(end), compare);
+        return;
+    }
+    const auto segment_size {static_cast<size_t>(traits::end(segment) - traits::begin(segment))};
+    const auto first_run {static_cast<size_t>(traits::end(segment) - traits::local(begin))};
+    __dsi::pdqsort(traits::local(begin), traits::end(segment), compare);
+    while(++segment not_eq last_segment) {
+        __dsi::pdqsort(traits::begin(segment), traits::end(segment), compare);
+    }
+    __dsi::pdqsort(traits::begin(last_segment), traits::local(end), compare);
+    const auto runs {1 + (size - first_run + segment_size - 1) / segment_size};
+    auto ordered {true};
+    for(auto i {1uz}; ordered and i < runs; ++i) {
+        const auto run {begin + static_cast<ptrdiff_t>(first_run + (i - 1) * segment_size)};
+        ordered = not compare(*run, *(run - 1));
+    }
+    if(ordered) {
+        return;
+    }
+    if constexpr(is_trivially_copyable_v<value_type>) {
+        const auto scratch {allocator<value_type>::template allocate<true>(size)};
+        if(scratch) {
+            auto in_scratch {false};
+            for(auto width {1uz}; width < runs; width *= 2, in_scratch = not in_scratch) {
+                if(in_scratch) {
+                    __dsi::merge_pass(scratch, begin, size, first_run, segment_size, runs, width, compare);
+                }else {
+                    __dsi::merge_pass(begin, scratch, size, first_run, segment_size, runs, width, compare);
+                }
+            }
+            if(in_scratch) {
+                // copies the sorted elements back segment by segment
+                auto source {scratch};
+                auto local {traits::local(begin)};
+                for(segment = traits::segment(begin); segment not_eq last_segment; local = traits::begin(++segment)) {
+                    const auto n {static_cast<size_t>(traits::end(segment) - local)};
+                    ds::memory_copy(local, source, sizeof(value_type) * n);
+                    source += n;
+                }
+                ds::memory_copy(local, source, sizeof(value_type) * static_cast<size_t>(traits::local(end) - local));
+            }
+            allocator<value_type>::deallocate(scratch, size);
+            return;
+        }
+    }
+    __dsi::pdqsort(begin, end, compare);
+}
+}
+__DATA_STRUCTURE_END(segmented sort)
+
+__DATA_STRUCTURE_START(sorting algorithms)
+/*
+ * sort is not stable and sorts in place (pdqsort), except the segmented iterators (e.g. deque's), whose segments
+ * are sorted and merged with a scratch buffer of end - begin elements.
+ */
+template <IsRandomAccessIterator RandomAccessIterator, typename Compare = less<>>
+constexpr void sort(RandomAccessIterator begin, RandomAccessIterator end, Compare compare = {}) {
+    if constexpr(__dsa::is_segmented_iterator_v<RandomAccessIterator>) {
+        if(not ds::is_constant_evaluated()) {
+            __dsi::segmented_sort(begin, end, compare);
+            return;
+        }
+    }
+    __dsi::pdqsort(begin, end, compare);
+}
+/*
+ * radix_sort sorts the integers or the floating point numbers in ascending order in O(n) time, it needs a scratch
+ * buffer of end - begin elements, which could be provided by the caller to reuse it across calls. It's not worth
+ * for the short ranges, which are forwarded to sort comparing the radix keys, so the NaNs and -0.0 are ordered in the
+ * same way.
+ */
+template <IsContiguousIterator ContiguousIterator>
+        requires __dsi::is_radix_sortable_v<remove_cv_t<typename iterator_traits<ContiguousIterator>::value_type>>
+void radix_sort(ContiguousIterator begin, ContiguousIterator end,
+        remove_cv_t<typename iterator_traits<ContiguousIterator>::value_type> *scratch) noexcept {
+    const auto size {static_cast<size_t>(end - begin)};
+    if(size < __dsi::radix_sort_threshold) {
+        ds::sort(begin, end, __dsi::radix_key_less {});
+        return;
+    }
+    const auto first {ds::address_of(*begin)};
+    __dsi::radix_sort(first, first + size, scratch);
+}
+template <IsContiguousIterator ContiguousIterator>
+        requires __dsi::is_radix_sortable_v<remove_cv_t<typename iterator_traits<ContiguousIterator>::value_type>>
+void radix_sort(ContiguousIterator begin, ContiguousIterator end) {
+    using value_type = remove_cv_t<typename iterator_traits<ContiguousIterator>::value_type>;
+    const auto size {static_cast<size_t>(end - begin)};
+    if(size < __dsi::radix_sort_threshold) {
+        ds::sort(begin, end, __dsi::radix_key_less {});
+        return;
+    }
+    const auto scratch {allocator<value_type>::allocate(size)};
+    ds::radix_sort(begin, end, scratch);
+    allocator<value_type>::deallocate(scratch, size);
+}
+__DATA_STRUCTURE_END(sorting algorithms)
+
+}       // namespace data_structure
+
+#endif      // DATA_STRUCTURE_SORT_HPP
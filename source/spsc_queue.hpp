@@ -0,0 +1,290 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_SPSC_QUEUE_HPP
+#define DATA_STRUCTURE_SPSC_QUEUE_HPP
+
+#include "allocator.hpp"
+#include "atomic.hpp"
+#include "memory.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(spsc_queue declaration)
+/*
+ * A bounded lock-free queue for exactly one producer thread and one consumer thread. The capacity is rounded up to a
+ * power of two, head and tail are never wrapped and the slot of an index is found by masking. The producer owns tail
+ * and the consumer owns head, each index lives on its own cache line together with the owner's cached copy of the
+ * other index, so the other side's line is only read (acquire) when the cached copy says the queue is full or empty.
+ * An element is constructed before tail is published (release) and is destroyed before head is published (release).
+ * try_push, try_emplace, try_pop, front and pop are wait-free, push_n and pop_n move a batch of elements with one
+ * publication. The producer functions are called by the producer only and the consumer functions by the consumer
+ * only, size and empty could be called by both and are exact only when the other side is idle. The constructor
+ * throws std::length_error if the capacity cannot be rounded up to a power of two in size_type.
+ */
+template <typename T, typename Allocator = allocator<T>>
+class spsc_queue {
+public:
+    using allocator_type = Allocator;
+    using size_type = typename Allocator::size_type;
+    using difference_type = typename Allocator::difference_type;
+    using value_type = T;
+    using reference = typename allocator_traits<Allocator>::reference;
+    using const_reference = typename allocator_traits<Allocator>::const_reference;
+    using rvalue_reference = typename allocator_traits<Allocator>::rvalue_reference;
+    using pointer = typename allocator_traits<Allocator>::pointer;
+    using const_pointer = typename allocator_traits<Allocator>::const_pointer;
+    static_assert(is_same_v<T, typename Allocator::value_type>,
+            "The value type of spsc_queue should be same as the allocator's value_type!");
+private:
+    struct push_handler;
+    struct pop_handler;
+private:
+    pointer first;
+    __dsa::allocator_compressor<size_type, Allocator> index_mask;
+    alignas(64) atomic<size_type> tail;
+    size_type cached_head;
+    alignas(64) atomic<size_type> head;
+    size_type cached_tail;
+private:
+    [[nodiscard]]
+    size_type free_slots(size_type, size_type) noexcept;
+    [[nodiscard]]
+    size_type ready_slots(size_type, size_type) noexcept;
+public:
+    explicit spsc_queue(size_type, const Allocator & = {});
+    spsc_queue(const spsc_queue &) = delete;
+    spsc_queue(spsc_queue &&) = delete;
+    ~spsc_queue() noexcept;
+public:
+    spsc_queue &operator=(const spsc_queue &) = delete;
+    spsc_queue &operator=(spsc_queue &&) = delete;
+public:
+    [[nodiscard]]
+    size_type size() const noexcept;
+    [[nodiscard]]
+    bool empty() const noexcept;
+    [[nodiscard]]
+    size_type capacity() const noexcept;
+    [[nodiscard]]
+    Allocator allocator() const noexcept;
+    bool try_push(const_reference);
+    bool try_push(rvalue_reference);
+    template <typename ...Args>
+    bool try_emplace(Args &&...);
+    template <IsInputIterator InputIterator>
+    size_type push_n(InputIterator, size_type);
+    [[nodiscard]]
+    pointer front() noexcept;
+    void pop() noexcept;
+    bool try_pop(reference);
+    template <typename OutputIterator>
+    size_type pop_n(OutputIterator, size_type);
+};
+__DATA_STRUCTURE_END(spsc_queue declaration)
+
+__DATA_STRUCTURE_START(spsc_queue implementation)
+/* exception handlers */
+template <typename T, typename Allocator>
+struct spsc_queue<T, Allocator>::push_handler {
+    spsc_queue &q;
+    size_type tail;
+    size_type i {0};
+    constexpr push_handler(spsc_queue &q, size_type tail) noexcept : q {q}, tail {tail} {}
+    void operator()() noexcept {
+        for(auto j {0uz}; j < this->i; ++j) {
+            ds::destroy(this->q.first + ((this->tail + j) & this->q.index_mask()));
+        }
+    }
+};
+template <typename T, typename Allocator>
+struct spsc_queue<T, Allocator>::pop_handler {
+    spsc_queue &q;
+    size_type head;
+    size_type i {0};
+    constexpr pop_handler(spsc_queue &q, size_type head) noexcept : q {q}, head {head} {}
+    void operator()() noexcept {
+        // the elements moved out have been destroyed, so their slots are handed back to the producer
+        this->q.head.store(this->head + this->i, memory_order_release);
+    }
+};
+
+/* private functions */
+template <typename T, typename Allocator>
+typename spsc_queue<T, Allocator>::size_type
+spsc_queue<T, Allocator>::free_slots(size_type tail, size_type n) noexcept {
+    const auto capacity {this->capacity()};
+    if(capacity - (tail - this->cached_head) < n) {
+        this->cached_head = this->head.load(memory_order_acquire);
+    }
+    return capacity - (tail - this->cached_head);
+}
+template <typename T, typename Allocator>
+typename spsc_queue<T, Allocator>::size_type
+spsc_queue<T, Allocator>::ready_slots(size_type head, size_type n) noexcept {
+    if(this->cached_tail - head < n) {
+        this->cached_tail = this->tail.load(memory_order_acquire);
+    }
+    return this->cached_tail - head;
+}
+
+/* public functions */
+template <typename T, typename Allocator>
+spsc_queue<T, Allocator>::spsc_queue(size_type n, const Allocator &allocator) : first {},
+        index_mask(ds::bit_ceil(n) - 1, allocator), tail {0}, cached_head {0}, head {0},
+        cached_tail {0} {
+    this->first = this->index_mask.allocator().allocate(this->capacity());
+}
+template <typename T, typename Allocator>
+spsc_queue<T, Allocator>::~spsc_queue() noexcept {
+    const auto tail {this->tail.load(memory_order_acquire)};
+    if constexpr(not is_trivially_destructible_v<T>) {
+        for(auto i {this->head.load(memory_order_acquire)}; i not_eq tail; ++i) {
+            ds::destroy(this->first + (i & this->index_mask()));
+        }
+    }
+    this->index_mask.allocator().deallocate(this->first, this->capacity());
+}
+template <typename T, typename Allocator>
+typename spsc_queue<T, Allocator>::size_type spsc_queue<T, Allocator>::size() const noexcept {
+    // head is loaded first, so the difference is never negative
+    const auto head {this->head.load(memory_order_acquire)};
+    return this->tail.load(memory_order_acquire) - head;
+}
+template <typename T, typename Allocator>
+bool spsc_queue<T, Allocator>::empty() const noexcept {
+    return this->size() == 0;
+}
+template <typename T, typename Allocator>
+typename spsc_queue<T, Allocator>::size_type spsc_queue<T, Allocator>::capacity() const noexcept {
+    return this->index_mask() + 1;
+}
+template <typename T, typename Allocator>
+Allocator spsc_queue<T, Allocator>::allocator() const noexcept {
+    return this->index_mask.allocator();
+}
+template <typename T, typename Allocator>
+bool spsc_queue<T, Allocator>::try_push(const_reference value) {
+    return this->try_emplace(value);
+}
+template <typename T, typename Allocator>
+bool spsc_queue<T, Allocator>::try_push(rvalue_reference value) {
+    return this->try_emplace(ds::move(value));
+}
+template <typename T, typename Allocator>
+template <typename ...Args>
+bool spsc_queue<T, Allocator>::try_emplace(Args &&...args) {
+    const auto tail {this->tail.load(memory_order_relaxed)};
+    if(this->free_slots(tail, 1) == 0) {
+        return false;
+    }
+    ds::construct(this->first + (tail & this->index_mask()), ds::forward<Args>(args)...);
+    this->tail.store(tail + 1, memory_order_release);
+    return true;
+}
+template <typename T, typename Allocator>
+template <IsInputIterator InputIterator>
+typename spsc_queue<T, Allocator>::size_type spsc_queue<T, Allocator>::push_n(InputIterator begin, size_type n) {
+    const auto tail {this->tail.load(memory_order_relaxed)};
+    const auto free {this->free_slots(tail, n)};
+    if(n > free) {
+        n = free;
+    }
+    if(n == 0) {
+        return 0;
+    }
+    if constexpr(is_pointer_v<pointer> and is_pointer_v<InputIterator> and
+            is_same_v<remove_cv_t<remove_pointer_t<InputIterator>>, T> and is_trivially_copyable_v<T>) {
+        const auto offset {tail & this->index_mask()};
+        const auto till_end {this->capacity() - offset};
+        const auto front_part {n < till_end ? n : till_end};
+        ds::memory_copy(this->first + offset, begin, sizeof(T) * front_part);
+        ds::memory_copy(this->first, begin + front_part, sizeof(T) * (n - front_part));
+    }else {
+        auto trans {transaction {push_handler(*this, tail)}};
+        for(auto &i {trans.get_rollback().i}; i < n; ++i) {
+            ds::construct(this->first + ((tail + i) & this->index_mask()), *begin);
+            ++begin;
+        }
+        trans.complete();
+    }
+    this->tail.store(tail + n, memory_order_release);
+    return n;
+}
+template <typename T, typename Allocator>
+typename spsc_queue<T, Allocator>::pointer spsc_queue<T, Allocator>::front() noexcept {
+    const auto head {this->head.load(memory_order_relaxed)};
+    if(this->ready_slots(head, 1) == 0) {
+        return nullptr;
+    }
+    return this->first + (head & this->index_mask());
+}
+template <typename T, typename Allocator>
+void spsc_queue<T, Allocator>::pop() noexcept {
+    // the queue should not be empty, that is, front() has returned an element
+    const auto head {this->head.load(memory_order_relaxed)};
+    ds::destroy(this->first + (head & this->index_mask()));
+    this->head.store(head + 1, memory_order_release);
+}
+template <typename T, typename Allocator>
+bool spsc_queue<T, Allocator>::try_pop(reference value) {
+    const auto head {this->head.load(memory_order_relaxed)};
+    if(this->ready_slots(head, 1) == 0) {
+        return false;
+    }
+    const auto slot {this->first + (head & this->index_mask())};
+    value = ds::move(*slot);
+    ds::destroy(slot);
+    this->head.store(head + 1, memory_order_release);
+    return true;
+}
+template <typename T, typename Allocator>
+template <typename OutputIterator>
+typename spsc_queue<T, Allocator>::size_type spsc_queue<T, Allocator>::pop_n(OutputIterator result, size_type n) {
+    const auto head {this->head.load(memory_order_relaxed)};
+    const auto ready {this->ready_slots(head, n)};
+    if(n > ready) {
+        n = ready;
+    }
+    if(n == 0) {
+        return 0;
+    }
+    if constexpr(is_pointer_v<pointer> and is_pointer_v<OutputIterator> and
+            is_same_v<remove_pointer_t<OutputIterator>, T> and is_trivially_copyable_v<T>) {
+        const auto offset {head & this->index_mask()};
+        const auto till_end {this->capacity() - offset};
+        const auto front_part {n < till_end ? n : till_end};
+        ds::memory_copy(result, this->first + offset, sizeof(T) * front_part);
+        ds::memory_copy(result + front_part, this->first, sizeof(T) * (n - front_part));
+        this->head.store(head + n, memory_order_release);
+    }else {
+        auto trans {transaction {pop_handler(*this, head)}};
+        for(auto &i {trans.get_rollback().i}; i < n; ++i) {
+            const auto slot {this->first + ((head + i) & this->index_mask())};
+            *result = ds::move(*slot);
+            ++result;
+            ds::destroy(slot);
+        }
+        trans.complete();
+        this->head.store(head + n, memory_order_release);
+    }
+    return n;
+}
+__DATA_STRUCTURE_END(spsc_queue implementation)
+
+}       // namespace data_structure
+
+#endif      // DATA_STRUCTURE_SPSC_QUEUE_HPP
@@ -0,0 +1,289 @@
+/*
+    * Copyright © [2019 - 2024] [Jonny]
+    *
+    * Licensed under the Apache License, Version 2.0 (the "License");
+    * you may not use this file except in compliance with the License.
+    * You may obtain a copy of the License at
+    *
+    *     http://www.apache.org/licenses/LICENSE-2.0
+    *
+    * Unless required by applicable law or agreed to in writing, software
+    * distributed under the License is distributed on an "AS IS" BASIS,
+    * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    * See the License for the specific language governing permissions and
+    * limitations under the License.
+*/
+
+#ifndef DATA_STRUCTURE_THREAD_POOL_HPP
+#define DATA_STRUCTURE_THREAD_POOL_HPP
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include "allocator.hpp"
+#include "atomic.hpp"
+#include "memory.hpp"
+
+namespace data_structure {
+
+__DATA_STRUCTURE_START(thread_pool declaration)
+/*
+ * A work-stealing thread pool for the fork-join loops of the parallel algorithms. run(n, f) calls f(0), ..., f(n - 1)
+ * on the workers and the calling thread, and returns after all calls finished. The chunk indices are dealt evenly to
+ * the participants at first, each participant takes the chunks from the front of its own range, and steals the back
+ * half of another participant's range when its own range is exhausted. A range is a pair of 32-bit indices packed in
+ * one atomic word, so both taking and stealing are a compare-and-swap. The first exception thrown by f is rethrown
+ * by run after the other chunks are skipped. The calls of run are serialized, and run is executed by the calling
+ * thread alone if it's called by a worker of the same pool (e.g. a nested parallel algorithm).
+ */
+class thread_pool {
+public:
+    using size_type = size_t;
+private:
+    struct job;
+    struct alignas(64) slot {
+        atomic<unsigned long long> range {0};
+    };
+private:
+    static constexpr auto npos {static_cast<size_type>(-1)};
+    static constexpr size_type max_chunks {0xFFFFFFFF};
+    static inline thread_local const thread_pool *current_pool {nullptr};
+private:
+    std::thread *workers;
+    slot *slots;
+    size_type worker_size;
+    std::mutex submission_lock;
+    std::mutex state_lock;
+    std::condition_variable wakeup;
+    job *current_job;
+    size_type generation;
+    bool stopping;
+    atomic<size_type> active;
+private:
+    [[nodiscard]]
+    static constexpr unsigned long long pack(size_type, size_type) noexcept;
+    [[nodiscard]]
+    size_type take(size_type) noexcept;
+    [[nodiscard]]
+    size_type steal(size_type) noexcept;
+    void participate(job &, size_type) noexcept;
+    void work(size_type) noexcept;
+    void execute(job &) noexcept;
+    void shutdown(size_type) noexcept;
+public:
+    explicit thread_pool(size_type = thread_pool::default_concurrency());
+    thread_pool(const thread_pool &) = delete;
+    thread_pool(thread_pool &&) = delete;
+    ~thread_pool() noexcept;
+public:
+    thread_pool &operator=(const thread_pool &) = delete;
+    thread_pool &operator=(thread_pool &&) = delete;
+public:
+    [[nodiscard]]
+    static size_type default_concurrency() noexcept;
+    [[nodiscard]]
+    static thread_pool &global();
+    [[nodiscard]]
+    size_type concurrency() const noexcept;
+    template <typename Function>
+    void run(size_type, Function &&);
+};
+__DATA_STRUCTURE_END(thread_pool declaration)
+
+__DATA_STRUCTURE_START(thread_pool implementation)
+/* private types */
+struct thread_pool::job {
+    void (*invoke)(void *, size_type);
+    void *function;
+    atomic<size_type> remaining;
+    atomic<bool> failed;
+    std::exception_ptr exception;
+};
+
+/* private functions */
+inline constexpr unsigned long long thread_pool::pack(size_type begin, size_type end) noexcept {
+    return static_cast<unsigned long long>(begin) | static_cast<unsigned long long>(end) << 32;
+}
+inline thread_pool::size_type thread_pool::take(size_type self) noexcept {
+    auto &range {this->slots[self].range};
+    auto value {range.load(memory_order_acquire)};
+    while(true) {
+        const auto begin {static_cast<size_type>(value & 0xFFFFFFFF)};
+        const auto end {static_cast<size_type>(value >> 32)};
+        if(begin >= end) {
+            return thread_pool::npos;
+        }
+        if(range.compare_exchange_weak(value, thread_pool::pack(begin + 1, end), memory_order_acq_rel,
+                memory_order_acquire)) {
+            return begin;
+        }
+    }
+}
+inline thread_pool::size_type thread_pool::steal(size_type self) noexcept {
+    const auto participants {this->worker_size + 1};
+    for(auto i {1uz}; i < participants; ++i) {
+        auto &range {this->slots[(self + i) % participants].range};
+        auto value {range.load(memory_order_acquire)};
+        while(true) {
+            const auto begin {static_cast<size_type>(value & 0xFFFFFFFF)};
+            const auto end {static_cast<size_type>(value >> 32)};
+            if(begin >= end) {
+                break;
+            }
+            const auto stolen {(end - begin + 1) / 2};
+            const auto new_end {end - stolen};
+            if(range.compare_exchange_weak(value, thread_pool::pack(begin, new_end), memory_order_acq_rel,
+                    memory_order_acquire)) {
+                // the own range is empty, so nobody else modifies it before it's published
+                this->slots[self].range.store(thread_pool::pack(new_end + 1, end), memory_order_release);
+                return new_end;
+            }
+        }
+    }
+    return thread_pool::npos;
+}
+inline void thread_pool::participate(job &j, size_type self) noexcept {
+    while(true) {
+        auto chunk {this->take(self)};
+        if(chunk == thread_pool::npos) {
+            chunk = this->steal(self);
+            if(chunk == thread_pool::npos) {
+                return;
+            }
+        }
+        if(not j.failed.load(memory_order_relaxed)) {
+            try {
+                j.invoke(j.function, chunk);
+            }catch(...) {
+                if(not j.failed.exchange(true, memory_order_relaxed)) {
+                    j.exception = std::current_exception();
+                }
+            }
+        }
+        j.remaining.fetch_sub(1, memory_order_release);
+    }
+}
+inline void thread_pool::work(size_type self) noexcept {
+    thread_pool::current_pool = this;
+    size_type seen {0};
+    while(true) {
+        job *j;
+        {
+            std::unique_lock lock {this->state_lock};
+            this->wakeup.wait(lock, [&]() noexcept {
+                return this->stopping or (this->current_job and this->generation not_eq seen);
+            });
+            if(this->stopping) {
+                return;
+            }
+            seen = this->generation;
+            j = this->current_job;
+            // counted under the lock, so the job outlives every worker which has seen it
+            this->active.fetch_add(1, memory_order_relaxed);
+        }
+        this->participate(*j, self);
+        this->active.fetch_sub(1, memory_order_release);
+    }
+}
+inline void thread_pool::execute(job &j) noexcept {
+    const auto participants {this->worker_size + 1};
+    const auto chunks {j.remaining.load(memory_order_relaxed)};
+    {
+        std::lock_guard lock {this->state_lock};
+        for(auto i {0uz}; i < participants; ++i) {
+            this->slots[i].range.store(thread_pool::pack(i * chunks / participants, (i + 1) * chunks / participants),
+                    memory_order_relaxed);
+        }
+        this->current_job = &j;
+        ++this->generation;
+    }
+    this->wakeup.notify_all();
+    this->participate(j, this->worker_size);
+    while(j.remaining.load(memory_order_acquire) not_eq 0) {
+        std::this_thread::yield();
+    }
+    {
+        std::lock_guard lock {this->state_lock};
+        this->current_job = nullptr;
+    }
+    while(this->active.load(memory_order_acquire) not_eq 0) {
+        std::this_thread::yield();
+    }
+}
+
+inline void thread_pool::shutdown(size_type started) noexcept {
+    // only the first started workers are running, the others are default constructed
+    {
+        std::lock_guard lock {this->state_lock};
+        this->stopping = true;
+    }
+    this->wakeup.notify_all();
+    for(auto i {0uz}; i < started; ++i) {
+        this->workers[i].join();
+    }
+    delete[] this->workers;
+    delete[] this->slots;
+}
+
+/* public functions */
+inline thread_pool::thread_pool(size_type concurrency) : workers {}, slots {},
+        worker_size {concurrency > 1 ? concurrency - 1 : 0}, submission_lock {}, state_lock {}, wakeup {},
+        current_job {}, generation {0}, stopping {false}, active {0} {
+    this->slots = new slot[this->worker_size + 1];
+    size_type i {0};
+    try {
+        this->workers = new std::thread[this->worker_size];
+        for(; i < this->worker_size; ++i) {
+            this->workers[i] = std::thread([this, i]() noexcept {
+                this->work(i);
+            });
+        }
+    }catch(...) {
+        this->shutdown(i);
+        throw;
+    }
+}
+inline thread_pool::~thread_pool() noexcept {
+    this->shutdown(this->worker_size);
+}
+inline thread_pool::size_type thread_pool::default_concurrency() noexcept {
+    const auto concurrency {static_cast<size_type>(std::thread::hardware_concurrency())};
+    return concurrency == 0 ? 1 : concurrency;
+}
+inline thread_pool &thread_pool::global() {
+    static thread_pool pool {};
+    return pool;
+}
+inline thread_pool::size_type thread_pool::concurrency() const noexcept {
+    return this->worker_size + 1;
+}
+template <typename Function>
+void thread_pool::run(size_type n, Function &&f) {
+    if(n == 0) {
+        return;
+    }
+    if(n == 1 or this->worker_size == 0 or thread_pool::current_pool == this or n > thread_pool::max_chunks) {
+        for(auto i {0uz}; i < n; ++i) {
+            f(i);
+        }
+        return;
+    }
+    job j {[](void *function, size_type i) {
+        (*static_cast<remove_reference_t<Function> *>(function))(i);
+    }, const_cast<void *>(static_cast<const void *>(ds::address_of(f))), n, false, nullptr};
+    std::lock_guard lock {this->submission_lock};
+    // the calling thread is a participant as well, so its nested calls are executed serially
+    const auto previous_pool {thread_pool::current_pool};
+    thread_pool::current_pool = this;
+    this->execute(j);
+    thread_pool::current_pool = previous_pool;
+    if(j.failed.load(memory_order_relaxed)) {
+        std::rethrow_exception(j.exception);
+    }
+}
+__DATA_STRUCTURE_END(thread_pool implementation)
+
+}       // namespace data_structure
+
+#endif      // DATA_STRUCTURE_THREAD_POOL_HPP
@@ -819,6 +819,22 @@ struct is_trivially_copyable : bool_constant<__is_trivially_copyable(T)> {};
 template <typename T>
 inline constexpr auto is_trivially_copyable_v {is_trivially_copyable<T>::value};
 
+/*
+ * A trivially relocatable type can be moved to another place by copying its bytes and releasing the source storage
+ * without calling the destructor. It is true for every trivially copyable type, any other type should opt in by
+ * specializing is_trivially_relocatable, which is only correct if the object never stores a pointer to itself.
+ */
+template <typename T>
+struct is_trivially_relocatable : bool_constant<is_trivially_copyable_v<T>> {};
+template <typename T, size_t N>
+struct is_trivially_relocatable<T [N]> : is_trivially_relocatable<T> {};
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : true_type {};
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T []>> : true_type {};
+template <typename T>
+inline constexpr auto is_trivially_relocatable_v {is_trivially_relocatable<T>::value};
+
 template <typename T, typename ...Args>
 struct is_trivially_constructible : bool_constant<__is_trivially_constructible(T, Args...)> {};
 template <typename T, typename ...Args>
@@ -855,11 +871,6 @@ struct is_trivially_move_assignable : is_trivially_assignable<add_lvalue_referen
 template <typename T>
 inline constexpr auto is_trivially_move_assignable_v {is_trivially_move_assignable<T>::value};
 
-template <typename T>
-struct is_trivially_destructible : bool_constant<__is_trivially_destructible(T)> {};
-template <typename T>
-inline constexpr auto is_trivially_destructible_v {is_trivially_destructible<T>::value};
-
 template <typename T, typename ...Args>
 struct is_constructible : bool_constant<__is_constructible(T, Args...)> {};
 template <typename T, typename ...Args>
@@ -921,8 +932,37 @@ struct is_destructible : conditional_t<
 template <typename T>
 inline constexpr auto is_destructible_v {is_destructible<T>::value};
 
+template <typename T>
+struct is_trivially_destructible : bool_constant<
+#if __has_builtin(__is_trivially_destructible)
+        __is_trivially_destructible(T)
+#else
+        conditional_t<is_reference_v<T>, true_type, is_destructible<T>>::value and __has_trivial_destructor(T)
+#endif
+        > {};
+template <typename T>
+inline constexpr auto is_trivially_destructible_v {is_trivially_destructible<T>::value};
+
+#if not __has_builtin(__is_convertible_to)
+namespace __data_structure_auxiliary {
+template <typename To>
+void test_implicit_conversion(To) noexcept;
+template <typename From, typename To>
+select_second_t<decltype(test_implicit_conversion<To>(declval<From>())), true_type> test_convertible(int) noexcept;
+template <typename, typename>
+false_type test_convertible(...) noexcept;
+}
+#endif
 template <typename From, typename To>
-struct is_convertible : bool_constant<__is_convertible_to(From, To) and not is_abstract_v<To>> {};
+struct is_convertible : bool_constant<
+#if __has_builtin(__is_convertible_to)
+        __is_convertible_to(From, To) and not is_abstract_v<To>
+#else
+        // GCC has no __is_convertible_to
+        is_void_v<To> ? is_void_v<From> : not is_array_v<To> and not is_function_v<To> and
+                decltype(__dsa::test_convertible<From, To>(0))::value
+#endif
+        > {};
 template <typename From, typename To>
 inline constexpr auto is_convertible_v {is_convertible<From, To>::value};
 
@@ -27,9 +27,9 @@ inline constexpr remove_reference_t<T> &&move(T &&value) noexcept {
     return static_cast<remove_reference_t<T> &&>(value);
 }
 template <bool Conditional, typename T>
-inline constexpr conditional_t<Conditional, remove_reference_t<T> &&, const T &>
+inline constexpr conditional_t<Conditional, remove_reference_t<T> &&, const remove_reference_t<T> &>
 move_if(T &&value) noexcept {
-    return ds::move(value);
+    return static_cast<conditional_t<Conditional, remove_reference_t<T> &&, const remove_reference_t<T> &>>(value);
 }
 template <typename T>
 inline constexpr T &&forward(remove_reference_t<T> &value) noexcept {
@@ -102,6 +102,58 @@ public:
 };
 __DATA_STRUCTURE_END(transaction tool)
 
+__DATA_STRUCTURE_START(comparison function objects)
+template <typename T = void>
+struct less {
+    [[nodiscard]]
+    constexpr bool operator()(const T &lhs, const T &rhs) const noexcept(noexcept(lhs < rhs)) {
+        return lhs < rhs;
+    }
+};
+template <>
+struct less<void> {
+    template <typename T, typename U>
+    [[nodiscard]]
+    constexpr bool operator()(T &&lhs, U &&rhs) const noexcept(noexcept(ds::forward<T>(lhs) < ds::forward<U>(rhs))) {
+        return ds::forward<T>(lhs) < ds::forward<U>(rhs);
+    }
+};
+template <typename T = void>
+struct greater {
+    [[nodiscard]]
+    constexpr bool operator()(const T &lhs, const T &rhs) const noexcept(noexcept(rhs < lhs)) {
+        return rhs < lhs;
+    }
+};
+template <>
+struct greater<void> {
+    template <typename T, typename U>
+    [[nodiscard]]
+    constexpr bool operator()(T &&lhs, U &&rhs) const noexcept(noexcept(ds::forward<U>(rhs) < ds::forward<T>(lhs))) {
+        return ds::forward<U>(rhs) < ds::forward<T>(lhs);
+    }
+};
+__DATA_STRUCTURE_END(comparison function objects)
+
+__DATA_STRUCTURE_START(arithmetic function objects)
+template <typename T = void>
+struct plus {
+    [[nodiscard]]
+    constexpr T operator()(const T &lhs, const T &rhs) const noexcept(noexcept(lhs + rhs)) {
+        return lhs + rhs;
+    }
+};
+template <>
+struct plus<void> {
+    template <typename T, typename U>
+    [[nodiscard]]
+    constexpr auto operator()(T &&lhs, U &&rhs) const noexcept(noexcept(ds::forward<T>(lhs) + ds::forward<U>(rhs)))
+            -> decltype(ds::forward<T>(lhs) + ds::forward<U>(rhs)) {
+        return ds::forward<T>(lhs) + ds::forward<U>(rhs);
+    }
+};
+__DATA_STRUCTURE_END(arithmetic function objects)
+
 }       // namespace data_structure
 
 __DATA_STRUCTURE_START(inner tools for data structure library)
@@ -20,11 +20,12 @@
 #include "allocator.hpp"
 #include "iterator.hpp"
 #include "buffer.hpp"
+#include "compare.hpp"
 
 namespace data_structure {
 
 __DATA_STRUCTURE_START(vector declaration)
-template <typename T, typename Allocator = allocator<T>>
+template <typename T, typename Allocator = allocator<T>, typename GrowthPolicy = doubling_growth_policy>
 class vector {
 public:
     using allocator_type = Allocator;
@@ -38,15 +39,20 @@ public:
     using const_pointer = typename allocator_traits<Allocator>::const_pointer;
     using iterator = wrap_iterator<pointer>;
     using const_iterator = wrap_iterator<const_pointer>;
-    using reverse_iterator = reverse_iterator<pointer>;
+    using reverse_iterator = ds::reverse_iterator<pointer>;
     using const_reverse_iterator = ds::reverse_iterator<const_pointer>;
+    using growth_policy = GrowthPolicy;
     static_assert(is_same_v<T, typename Allocator::value_type>,
             "The value type of vector should be same as the allocator's value_type!");
+private:
+    template <typename, size_t, typename, typename>
+    friend class small_vector;
 private:
     struct resize_handler;
     friend struct resize_handler;
     struct insertion_handler;
     struct reallocation_handler;
+    struct relocation_handler;
 private:
     pointer first {};
     pointer cursor {};
@@ -54,7 +60,7 @@ private:
 private:
     constexpr void move_to(pointer, pointer, pointer, size_type);
     template <bool = false>
-    constexpr void assign_with_buffer(buffer<T, Allocator> &&b) noexcept;
+    constexpr void assign_with_buffer(buffer<T, Allocator, GrowthPolicy> &&b) noexcept;
     constexpr void resize_and_move(size_type, size_type);
     template <typename ...Args>
     constexpr void copy_value(pointer, size_type, size_type, size_type, Args &&...)
@@ -65,11 +71,20 @@ private:
     template <bool = true, typename ...Args>
     constexpr void reallocate_when_insertion(size_type, size_type, size_type, Args &&...);
     constexpr bool is_insertion_value_need_fix(const_pointer, const_pointer) noexcept;
+    constexpr bool expand_in_place(size_type) noexcept;
+    constexpr bool expand_for_insertion(size_type) noexcept;
+    [[nodiscard]]
+    constexpr size_type next_capacity(size_type) const noexcept;
+    [[nodiscard]]
+    constexpr size_type usable_capacity(size_type) noexcept;
+    constexpr void default_initialize(size_type) noexcept(is_nothrow_default_constructible_v<T>);
+    constexpr void expand_for_emplace_back();
 public:
     constexpr vector() noexcept(is_nothrow_default_constructible_v<Allocator>) = default;
     explicit constexpr vector(const Allocator &) noexcept;
     explicit constexpr vector(size_type, const Allocator & = {});
     constexpr vector(size_type, const_reference, const Allocator & = {});
+    constexpr vector(size_type, for_overwrite_tag, const Allocator & = {});
     template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
     constexpr vector(InputIterator, InputIterator, const Allocator & = {}, size_type = 64);
     template <IsForwardIterator ForwardIterator>
@@ -132,6 +147,8 @@ public:
     constexpr void shrink_to_fit();
     constexpr void resize(size_type);
     constexpr void resize(size_type, const_reference);
+    constexpr void resize_for_overwrite(size_type);
+    constexpr pointer append_uninitialized(size_type);
     [[nodiscard]]
     constexpr reference front() noexcept;
     [[nodiscard]]
@@ -150,6 +167,12 @@ public:
     constexpr void push_back(rvalue_reference);
     template <typename ...Args>
     constexpr void emplace_back(Args &&...);
+    constexpr void unchecked_push_back(const_reference) noexcept(is_nothrow_copy_constructible_v<T>);
+    constexpr void unchecked_push_back(rvalue_reference) noexcept(is_nothrow_move_constructible_v<T>);
+    template <typename ...Args>
+    constexpr void unchecked_emplace_back(Args &&...) noexcept(is_nothrow_constructible_v<T, Args...>);
+    template <IsRange Range>
+    constexpr void append_range(Range &&);
     constexpr void pop_back() noexcept;
     constexpr void clear() noexcept;
     constexpr void swap(vector &) noexcept;
@@ -176,19 +199,23 @@ public:
     constexpr iterator erase(const_iterator);
     constexpr iterator erase(const_iterator, const_iterator);
 };
-template <typename T, typename Allocator>
-inline constexpr void swap(vector<T, Allocator> &, vector<T, Allocator> &) noexcept;
-// Todo : wait for header "compare.hpp"?
-/*template <typename T, typename Allocator>
-inline constexpr some_ordering operator<=>(vector<T, Allocator> &, vector<T, Allocator> &)
-        noexcept(is_nothrow_three_way_comparable_v<T>);*/
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline constexpr void swap(vector<T, Allocator, GrowthPolicy> &, vector<T, Allocator, GrowthPolicy> &) noexcept;
+template <typename T, typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr bool operator==(const vector<T, Allocator, GrowthPolicy> &,
+        const vector<T, Allocator, GrowthPolicy> &) noexcept(is_nothrow_equal_to_comparable_v<const T &>);
+template <typename T, typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr auto operator<=>(const vector<T, Allocator, GrowthPolicy> &,
+        const vector<T, Allocator, GrowthPolicy> &) noexcept(__dsa::is_nothrow_synth_three_way_comparable_v<T>);
 __DATA_STRUCTURE_END(vector declaration)
 
 __DATA_STRUCTURE_START(vector implementation)
 
 /* private types */
-template <typename T, typename Allocator>
-struct vector<T, Allocator>::resize_handler {
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct vector<T, Allocator, GrowthPolicy>::resize_handler {
     Allocator &allocator;
     pointer &new_place;
     size_type new_size;
@@ -200,16 +227,16 @@ struct vector<T, Allocator>::resize_handler {
         this->allocator.deallocate(this->new_place, this->new_size);
     }
 };
-template <typename T, typename Allocator>
-struct vector<T, Allocator>::insertion_handler {
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct vector<T, Allocator, GrowthPolicy>::insertion_handler {
     pointer begin;
     pointer end;
     constexpr void operator()() noexcept {
         ds::destroy(this->begin, this->end);
     }
 };
-template <typename T, typename Allocator>
-struct vector<T, Allocator>::reallocation_handler {
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct vector<T, Allocator, GrowthPolicy>::reallocation_handler {
     Allocator &allocator;
     pointer new_place;
     pointer begin;
@@ -223,9 +250,21 @@ struct vector<T, Allocator>::reallocation_handler {
     }
 };
 
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct vector<T, Allocator, GrowthPolicy>::relocation_handler {
+    pointer position;
+    size_type n;
+    size_type tail_size;
+    size_type i {0};
+    constexpr void operator()() noexcept {
+        ds::destroy(this->position, this->position + this->i);
+        ds::memory_move(this->position, this->position + this->n, sizeof(T) * this->tail_size);
+    }
+};
+
 /* private functions */
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::move_to(pointer new_place, pointer begin, pointer end, size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::move_to(pointer new_place, pointer begin, pointer end, size_type n) {
     if constexpr(is_pointer_v<pointer> and is_trivially_copyable_v<T>) {
         ds::memory_copy(new_place, begin, sizeof(T) * static_cast<size_t>(end - begin));
     }else {
@@ -236,33 +275,40 @@ constexpr void vector<T, Allocator>::move_to(pointer new_place, pointer begin, p
         trans.complete();
     }
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <bool ReleaseThis>
-constexpr void vector<T, Allocator>::assign_with_buffer(buffer<T, Allocator> &&b) noexcept {
+constexpr void vector<T, Allocator, GrowthPolicy>::assign_with_buffer(buffer<T, Allocator, GrowthPolicy> &&b) noexcept {
     if constexpr(ReleaseThis) {
         this->~vector();
     }
     this->first = b.release();
     this->cursor = this->last() = this->first + b.size();
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::resize_and_move(size_type n, size_type size) {
-    if constexpr(is_trivially_copyable_v<T>) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::resize_and_move(size_type n, size_type size) {
+    if constexpr(is_trivially_relocatable_v<T>) {
+        if(n < size) {
+            ds::destroy(this->first + n, this->first + size);
+        }
         this->first = this->last.allocator().reallocate(this->first, n);
     }else {
+        if(n > this->capacity() and this->expand_in_place(n)) {
+            return;
+        }
         auto new_first {this->last.allocator().allocate(n)};
         auto trans {transaction {resize_handler(*this, new_first, n)}};
         const auto move_size {size < n ? size : n};
         for(auto &i {trans.get_rollback().i}; i < move_size; ++i) {
             ds::construct(new_first + i, ds::move(this->first[i]));
         }
-        this->first = ds::move(new_first);
         trans.complete();
+        this->~vector();
+        this->first = ds::move(new_first);
     }
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename ...Args>
-constexpr void vector<T, Allocator>::copy_value(pointer new_first, size_type n, size_type pos,
+constexpr void vector<T, Allocator, GrowthPolicy>::copy_value(pointer new_first, size_type n, size_type pos,
         size_type allocation_size, Args &&...args) noexcept(is_nothrow_constructible_v<T, Args...>) {
     transaction trans {reallocation_handler(*this, new_first, new_first + pos, allocation_size)};
     for(auto &i {trans.get_rollback().i}; i < n; ++i) {
@@ -270,10 +316,10 @@ constexpr void vector<T, Allocator>::copy_value(pointer new_first, size_type n,
     }
     trans.complete();
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename Iterator>
-constexpr void vector<T, Allocator>::copy_range(pointer new_first, size_type pos, size_type allocation_size,
-        Iterator begin, Iterator end)
+constexpr void vector<T, Allocator, GrowthPolicy>::copy_range(pointer new_first, size_type pos,
+        size_type allocation_size, Iterator begin, Iterator end)
         noexcept(is_nothrow_constructible_v<T, typename iterator_traits<Iterator>::reference>) {
     transaction trans {reallocation_handler(*this, new_first, new_first + pos, allocation_size)};
     for(auto &i {trans.get_rollback().i}; begin not_eq end; ++i) {
@@ -281,26 +327,24 @@ constexpr void vector<T, Allocator>::copy_range(pointer new_first, size_type pos
     }
     trans.complete();
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <bool Value, typename ...Args>
-constexpr void vector<T, Allocator>::reallocate_when_insertion(size_type n, size_type old_size, size_type pos,
-        Args &&...args) {
-    auto allocation_size {this->capacity() * 2};
+constexpr void vector<T, Allocator, GrowthPolicy>::reallocate_when_insertion(size_type n, size_type old_size,
+        size_type pos, Args &&...args) {
     const auto new_size {old_size + n};
-    if(allocation_size < new_size) {
-        allocation_size = new_size;
-    }
+    const auto allocation_size {this->next_capacity(new_size)};
     auto new_first {this->last.allocator().allocate(allocation_size)};
     if constexpr(Value) {
         this->copy_value(new_first, n, pos, allocation_size, ds::forward<Args>(args)...);
     }else {
         this->copy_range(new_first, pos, allocation_size, ds::forward<Args>(args)...);
     }
-    if constexpr(is_trivially_copyable_v<T> and is_pointer_v<pointer>) {
+    if constexpr(is_trivially_relocatable_v<T> and is_pointer_v<pointer>) {
         if(old_size > 0) {
             ds::memory_copy(new_first, this->first, sizeof(T) * pos);
             ds::memory_copy(new_first + pos + n, this->first + pos, sizeof(T) * (old_size - pos));
         }
+        this->last.allocator().deallocate(this->first, this->capacity());
         this->first = ds::move(new_first);
     }else {
         transaction trans {resize_handler(*this, new_first, allocation_size)};
@@ -314,74 +358,137 @@ constexpr void vector<T, Allocator>::reallocate_when_insertion(size_type n, size
             ds::construct(new_first + i, ds::move(this->first[j]));
         }
         trans.complete();
+        this->~vector();
         this->first = ds::move(new_first);
     }
     this->cursor = this->first + new_size;
-    this->last() = this->first + allocation_size;
+    this->last() = this->first + this->usable_capacity(allocation_size);
 }
-template <typename T, typename Allocator>
-constexpr bool vector<T, Allocator>::is_insertion_value_need_fix(const_pointer position,
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr bool vector<T, Allocator, GrowthPolicy>::is_insertion_value_need_fix(const_pointer position,
         const_pointer pointer_to_value) noexcept {
     // Todo : The comparison is not allowed in compile time
     return position <= pointer_to_value and pointer_to_value < this->cursor;
 }
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr bool vector<T, Allocator, GrowthPolicy>::expand_in_place(size_type n) noexcept {
+    if(__dsa::try_expand(this->last.allocator(), this->first, n)) {
+        this->last() = this->first + n;
+        return true;
+    }
+    return false;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr bool vector<T, Allocator, GrowthPolicy>::expand_for_insertion(size_type n) noexcept {
+    return this->expand_in_place(this->next_capacity(this->size() + n));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::size_type
+vector<T, Allocator, GrowthPolicy>::next_capacity(size_type n) const noexcept {
+    return GrowthPolicy::template next_capacity<T>(this->capacity(), n);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::size_type
+vector<T, Allocator, GrowthPolicy>::usable_capacity(size_type allocation_size) noexcept {
+    // the block of first has just been allocated for allocation_size elements by the growth policy
+    if constexpr(__dsa::IsRoundingToUsableSize<GrowthPolicy>) {
+        return __dsa::usable_size(this->last.allocator(), this->first, allocation_size);
+    }else {
+        return allocation_size;
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::expand_for_emplace_back() {
+    const auto size {this->size()};
+    const auto allocation_size {this->next_capacity(size + 1)};
+    if constexpr(is_trivially_relocatable_v<T>) {
+        this->first = this->last.allocator().reallocate(this->first, allocation_size);
+    }else if(not this->expand_in_place(allocation_size)) {
+        auto new_first {this->last.allocator().allocate(allocation_size)};
+        this->move_to(new_first, this->first, this->cursor, allocation_size);
+        this->~vector();
+        this->first = ds::move(new_first);
+    }
+    this->cursor = this->first + size;
+    this->last() = this->first + this->usable_capacity(allocation_size);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::default_initialize(size_type n)
+        noexcept(is_nothrow_default_constructible_v<T>) {
+    // the spare space should be enough, the trivially default constructible elements are left uninitialized
+    if constexpr(is_trivially_default_constructible_v<T>) {
+        this->cursor += n;
+    }else {
+        for(const auto end {this->cursor + n}; this->cursor not_eq end; ++this->cursor) {
+            ds::default_construct(this->cursor);
+        }
+    }
+}
 
 /* public functions */
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(const Allocator &allocator) noexcept : first {}, cursor {}, last(allocator) {}
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(size_type n, const Allocator &allocator) : first {}, cursor {}, last(allocator) {
-    this->assign_with_buffer(buffer<T, Allocator>(n, allocator));
-}
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(size_type n, const_reference value, const Allocator &allocator) :
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(const Allocator &allocator) noexcept :
+        first {}, cursor {}, last(allocator) {}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(size_type n, const Allocator &allocator) :
+        first {}, cursor {}, last(allocator) {
+    this->assign_with_buffer(buffer<T, Allocator, GrowthPolicy>(n, allocator));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(size_type n, const_reference value, const Allocator &allocator) :
         first {}, cursor {}, last(allocator) {
-    this->assign_with_buffer(buffer<T, Allocator>(n, value, allocator));
+    this->assign_with_buffer(buffer<T, Allocator, GrowthPolicy>(n, value, allocator));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(size_type n, for_overwrite_tag, const Allocator &allocator) :
+        first {}, cursor {}, last(allocator) {
+    this->assign_with_buffer(buffer<T, Allocator, GrowthPolicy>(n, for_overwrite, allocator));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr vector<T, Allocator>::vector(InputIterator begin, InputIterator end, const Allocator &allocator,
+constexpr vector<T, Allocator, GrowthPolicy>::vector(InputIterator begin, InputIterator end, const Allocator &allocator,
         size_type default_size) : first {}, cursor {}, last(allocator) {
-    this->assign_with_buffer(buffer<T, Allocator>(begin, end, allocator, default_size));
+    this->assign_with_buffer(buffer<T, Allocator, GrowthPolicy>(begin, end, allocator, default_size));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsForwardIterator ForwardIterator>
-constexpr vector<T, Allocator>::vector(ForwardIterator begin, ForwardIterator end, const Allocator &allocator) :
-        first {}, cursor {}, last(allocator) {
-    this->assign_with_buffer(buffer<T, Allocator>(begin, end, allocator));
+constexpr vector<T, Allocator, GrowthPolicy>::vector(ForwardIterator begin, ForwardIterator end,
+        const Allocator &allocator) : first {}, cursor {}, last(allocator) {
+    this->assign_with_buffer(buffer<T, Allocator, GrowthPolicy>(begin, end, allocator));
 }
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(initializer_list<T> init_list, const Allocator &allocator) :
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(initializer_list<T> init_list, const Allocator &allocator) :
         vector(init_list.begin(), init_list.end(), allocator) {}
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(const vector &rhs) : vector(rhs.cbegin(), rhs.cend(), rhs.allocator()) {}
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(const vector &rhs, const Allocator &allocator) :
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(const vector &rhs) :
+        vector(rhs.cbegin(), rhs.cend(), rhs.allocator()) {}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(const vector &rhs, const Allocator &allocator) :
         vector(rhs.cbegin(), rhs.cend(), allocator) {}
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(vector &&rhs) noexcept : first {ds::move(rhs.first)},
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(vector &&rhs) noexcept : first {ds::move(rhs.first)},
         cursor {ds::move(rhs.cursor)}, last {ds::move(rhs.last)} {
     rhs.first = rhs.cursor = rhs.last() = nullptr;
 }
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::vector(vector &&rhs, const Allocator &allocator) noexcept : first {ds::move(rhs.first)},
-        cursor {ds::move(rhs.cursor)}, last(ds::move(rhs.last()), allocator) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::vector(vector &&rhs, const Allocator &allocator) noexcept :
+        first {ds::move(rhs.first)}, cursor {ds::move(rhs.cursor)}, last(ds::move(rhs.last()), allocator) {
     rhs.first = rhs.cursor = rhs.last() = nullptr;
 }
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator>::~vector() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy>::~vector() noexcept {
     ds::destroy(this->first, this->cursor);
     this->last.allocator().deallocate(this->first, static_cast<size_type>(this->cursor - this->first));
 }
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator> &vector<T, Allocator>::operator=(const vector<T, Allocator> &rhs) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy> &vector<T, Allocator, GrowthPolicy>::operator=(const vector &rhs) {
     if(this not_eq &rhs) {
         this->assign(rhs.cbegin(), rhs.cend());
     }
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator> &vector<T, Allocator>::operator=(vector<T, Allocator> &&rhs) noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy> &vector<T, Allocator, GrowthPolicy>::operator=(vector &&rhs) noexcept {
     if(this not_eq &rhs) {
         this->~vector();
         this->first = ds::move(rhs.first);
@@ -391,25 +498,28 @@ constexpr vector<T, Allocator> &vector<T, Allocator>::operator=(vector<T, Alloca
     }
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr vector<T, Allocator> &vector<T, Allocator>::operator=(initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr vector<T, Allocator, GrowthPolicy> &
+vector<T, Allocator, GrowthPolicy>::operator=(initializer_list<T> init_list) {
     this->assign(init_list.begin(), init_list.end());
     return *this;
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::reference vector<T, Allocator>::operator[](size_type n)
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::reference
+vector<T, Allocator, GrowthPolicy>::operator[](size_type n)
         noexcept(is_nothrow_indexable_v<pointer, size_type>) {
     return this->first[n];
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_reference vector<T, Allocator>::operator[](size_type n) const
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_reference
+vector<T, Allocator, GrowthPolicy>::operator[](size_type n) const
         noexcept(is_nothrow_indexable_v<pointer, size_type>) {
     return this->first[n];
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::assign(size_type n, const_reference value) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::assign(size_type n, const_reference value) {
     if(n > this->capacity()) {
-        this->assign_with_buffer<true>(buffer<T, Allocator>(n, value, this->last.allocator()));
+        this->assign_with_buffer<true>(buffer<T, Allocator, GrowthPolicy>(n, value, this->last.allocator()));
     }else {
         auto it {this->first};
         for(; n not_eq 0 and it not_eq this->cursor; ++it, static_cast<void>(--n)) {
@@ -427,18 +537,20 @@ constexpr void vector<T, Allocator>::assign(size_type n, const_reference value)
         }while(n not_eq 0);
     }
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr void vector<T, Allocator>::assign(InputIterator begin, InputIterator end, size_type default_size) {
-    this->assign_with_buffer<true>(buffer<T, Allocator>(begin, end, this->last.allocator(), default_size));
+constexpr void vector<T, Allocator, GrowthPolicy>::assign(InputIterator begin, InputIterator end,
+        size_type default_size) {
+    this->assign_with_buffer<true>(buffer<T, Allocator, GrowthPolicy>(begin, end, this->last.allocator(),
+            default_size));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsForwardIterator ForwardIterator>
-constexpr void vector<T, Allocator>::assign(ForwardIterator begin, ForwardIterator end) {
+constexpr void vector<T, Allocator, GrowthPolicy>::assign(ForwardIterator begin, ForwardIterator end) {
     // Todo : If ForwardIterator is pointer?
     auto n {ds::distance(begin, end)};
     if(n > this->capacity()) {
-        this->assign_with_buffer<true>(buffer<T, Allocator>(begin, end, this->last.allocator()));
+        this->assign_with_buffer<true>(buffer<T, Allocator, GrowthPolicy>(begin, end, this->last.allocator()));
     }else {
         auto it {this->first};
         for(; n not_eq 0 and it not_eq this->cursor; ++it, static_cast<void>(--n)) {
@@ -456,87 +568,97 @@ constexpr void vector<T, Allocator>::assign(ForwardIterator begin, ForwardIterat
         }while(n not_eq 0);
     }
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::assign(initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::assign(initializer_list<T> init_list) {
     this->assign(init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::begin() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::begin() noexcept {
     return iterator {this->first};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_iterator vector<T, Allocator>::begin() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy>::begin() const noexcept {
     return const_iterator {this->first};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_iterator vector<T, Allocator>::cbegin() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy>::cbegin() const noexcept {
     return const_iterator {this->first};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::end() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::end() noexcept {
     return iterator {this->cursor};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_iterator vector<T, Allocator>::end() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy>::end() const noexcept {
     return const_iterator {this->cursor};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_iterator vector<T, Allocator>::cend() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy>::cend() const noexcept {
     return const_iterator {this->cursor};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::reverse_iterator vector<T, Allocator>::rbegin() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::reverse_iterator
+vector<T, Allocator, GrowthPolicy>::rbegin() noexcept {
     return reverse_iterator {this->cursor - 1};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_reverse_iterator vector<T, Allocator>::rbegin() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy>::rbegin() const noexcept {
     return const_reverse_iterator {this->cursor - 1};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_reverse_iterator vector<T, Allocator>::crbegin() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy>::crbegin() const noexcept {
     return const_reverse_iterator {this->cursor - 1};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::reverse_iterator vector<T, Allocator>::rend() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::reverse_iterator
+vector<T, Allocator, GrowthPolicy>::rend() noexcept {
     return reverse_iterator {this->first - 1};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_reverse_iterator vector<T, Allocator>::rend() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy>::rend() const noexcept {
     return const_reverse_iterator {this->first - 1};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_reverse_iterator vector<T, Allocator>::crend() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy>::crend() const noexcept {
     return const_reverse_iterator {this->first - 1};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::size_type vector<T, Allocator>::size() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::size_type
+vector<T, Allocator, GrowthPolicy>::size() const noexcept {
     return static_cast<size_type>(this->cursor - this->first);
 }
-template <typename T, typename Allocator>
-constexpr bool vector<T, Allocator>::empty() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr bool vector<T, Allocator, GrowthPolicy>::empty() const noexcept {
     return this->first == this->cursor;
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::size_type vector<T, Allocator>::capacity() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::size_type
+vector<T, Allocator, GrowthPolicy>::capacity() const noexcept {
     return static_cast<size_type>(this->last() - this->first);
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::size_type vector<T, Allocator>::spare() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::size_type
+vector<T, Allocator, GrowthPolicy>::spare() const noexcept {
     return static_cast<size_type>(this->last() - this->cursor);
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::reserve(size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::reserve(size_type n) {
     const auto size {this->size()};
     if(n > this->capacity()) {
         auto &allocator {this->last.allocator()};
-        if constexpr(is_trivially_copyable_v<T>) {
-            auto new_first {allocator.reallocate(this->first, n)};
-            if(new_first not_eq this->first) {
-                this->first = ds::move(new_first);
-                this->cursor = this->first + size;
-                this->last() = this->first + n;
-            }
-        }else {
+        if constexpr(is_trivially_relocatable_v<T>) {
+            this->first = allocator.reallocate(this->first, n);
+            this->cursor = this->first + size;
+            this->last() = this->first + n;
+        }else if(not this->expand_in_place(n)) {
             auto new_first {allocator.allocate(n)};
             this->move_to(new_first, this->first, this->cursor, n);
             this->~vector();
@@ -546,8 +668,8 @@ constexpr void vector<T, Allocator>::reserve(size_type n) {
         }
     }
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::shrink_to_fit() {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::shrink_to_fit() {
     if(this->cursor not_eq this->last()) {
         const auto size {this->size()};
         this->resize_and_move(size, size);
@@ -558,8 +680,8 @@ constexpr void vector<T, Allocator>::shrink_to_fit() {
         }
     }
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::resize(size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::resize(size_type n) {
     const auto size {this->size()};
     if(n not_eq size) [[likely]] {
         this->resize_and_move(n, size);
@@ -580,8 +702,8 @@ constexpr void vector<T, Allocator>::resize(size_type n) {
     }
     this->last() = this->cursor = this->first + n;
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::resize(size_type n, const_reference value) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::resize(size_type n, const_reference value) {
     const auto size {this->size()};
     if(n not_eq size) [[likely]] {
         this->resize_and_move(n, size);
@@ -598,98 +720,171 @@ constexpr void vector<T, Allocator>::resize(size_type n, const_reference value)
     }
     this->last() = this->cursor = this->first + n;
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::reference vector<T, Allocator>::front() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::resize_for_overwrite(size_type n) {
+    // unlike resize, the capacity is kept and the new elements are default-initialized
+    const auto size {this->size()};
+    if(n <= size) {
+        const auto new_cursor {this->first + n};
+        ds::destroy(new_cursor, this->cursor);
+        this->cursor = new_cursor;
+        return;
+    }
+    if(n > this->capacity()) {
+        this->reserve(n);
+    }
+    this->default_initialize(n - size);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::pointer
+vector<T, Allocator, GrowthPolicy>::append_uninitialized(size_type n) {
+    if(n > this->spare()) {
+        this->reserve(this->next_capacity(this->size() + n));
+    }
+    const auto old_cursor {this->cursor};
+    this->default_initialize(n);
+    return old_cursor;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::reference vector<T, Allocator, GrowthPolicy>::front() noexcept {
     return *this->first;
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_reference vector<T, Allocator>::front() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_reference
+vector<T, Allocator, GrowthPolicy>::front() const noexcept {
     return *this->first;
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::reference vector<T, Allocator>::back() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::reference vector<T, Allocator, GrowthPolicy>::back() noexcept {
     return this->cursor[-1];
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_reference vector<T, Allocator>::back() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_reference
+vector<T, Allocator, GrowthPolicy>::back() const noexcept {
     return this->cursor[-1];
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::pointer vector<T, Allocator>::data() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::pointer vector<T, Allocator, GrowthPolicy>::data() noexcept {
     return this->first;
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::const_pointer vector<T, Allocator>::data() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::const_pointer
+vector<T, Allocator, GrowthPolicy>::data() const noexcept {
     return this->first;
 }
-template <typename T, typename Allocator>
-constexpr Allocator vector<T, Allocator>::allocator() const noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr Allocator vector<T, Allocator, GrowthPolicy>::allocator() const noexcept {
     return this->last.allocator();
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::push_back(const_reference value) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::push_back(const_reference value) {
     this->emplace_back(value);
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::push_back(rvalue_reference value) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::push_back(rvalue_reference value) {
     this->emplace_back(ds::move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename ...Args>
-constexpr void vector<T, Allocator>::emplace_back(Args &&...args) {
-    if(this->cursor == this->last()) {
-        const auto size {this->size()};
-        const auto allocation_size {size == 0 ? 1 : size * 2};
-        if constexpr(is_trivially_copyable_v<T>) {
-            this->first = this->last.allocator().reallocate(this->first, allocation_size);
-        }else {
-            auto new_first {this->last.allocator().allocate(allocation_size)};
-            this->move_to(new_first, this->first, this->last, allocation_size);
-            this->~vector();
-            this->first = ds::move(new_first);
-        }
-        this->cursor = this->first + size;
-        this->last() = this->first + allocation_size;
+constexpr void vector<T, Allocator, GrowthPolicy>::emplace_back(Args &&...args) {
+    if(this->cursor == this->last()) [[unlikely]] {
+        this->expand_for_emplace_back();
     }
     ds::construct(this->cursor, ds::forward<Args>(args)...);
     ++this->cursor;
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::pop_back() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::unchecked_push_back(const_reference value)
+        noexcept(is_nothrow_copy_constructible_v<T>) {
+    this->unchecked_emplace_back(value);
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::unchecked_push_back(rvalue_reference value)
+        noexcept(is_nothrow_move_constructible_v<T>) {
+    this->unchecked_emplace_back(ds::move(value));
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename ...Args>
+constexpr void vector<T, Allocator, GrowthPolicy>::unchecked_emplace_back(Args &&...args)
+        noexcept(is_nothrow_constructible_v<T, Args...>) {
+    __DATA_STRUCTURE_DEBUG_ASSERT(this->cursor not_eq this->last(),
+            "unchecked_emplace_back requires the capacity to be reserved!");
+    ds::construct(this->cursor, ds::forward<Args>(args)...);
+    ++this->cursor;
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <IsRange Range>
+constexpr void vector<T, Allocator, GrowthPolicy>::append_range(Range &&range) {
+    // the range should not refer to the elements of this vector
+    using range_iterator = range_iterator_t<Range>;
+    if constexpr(is_forward_iterator_v<range_iterator>) {
+        const auto n {static_cast<size_type>(ds::range_size(range))};
+        if(n == 0) {
+            return;
+        }
+        if(n > this->spare()) {
+            this->reserve(this->next_capacity(this->size() + n));
+        }
+        auto begin {ds::begin(range)};
+        if constexpr(is_pointer_v<pointer> and is_contiguous_iterator_v<range_iterator> and
+                is_trivially_copyable_v<T> and is_lvalue_reference_v<decltype(*begin)> and
+                is_same_v<remove_cvref_t<decltype(*begin)>, T>) {
+            ds::memory_copy(this->cursor, ds::address_of(*begin), sizeof(T) * n);
+            this->cursor += n;
+        }else {
+            for(const auto end {this->cursor + n}; this->cursor not_eq end; ++this->cursor) {
+                ds::construct(this->cursor, *begin);
+                ++begin;
+            }
+        }
+    }else {
+        const auto end {ds::end(range)};
+        for(auto begin {ds::begin(range)}; begin not_eq end; ++begin) {
+            this->emplace_back(*begin);
+        }
+    }
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::pop_back() noexcept {
     ds::destroy(--this->cursor);
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::clear() noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::clear() noexcept {
     ds::destroy(this->first, this->cursor);
     this->cursor = this->first;
 }
-template <typename T, typename Allocator>
-constexpr void vector<T, Allocator>::swap(vector &rhs) noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void vector<T, Allocator, GrowthPolicy>::swap(vector &rhs) noexcept {
     using ds::swap;
     swap(this->first, rhs.first);
     swap(this->cursor, rhs.cursor);
     swap(this->last(), rhs.last());
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(size_type pos, const_reference value, size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(size_type pos, const_reference value, size_type n) {
     if(n == 0) {
         return iterator {this->first + pos};
     }
     const auto size {this->size()};
-    if(n > this->spare()) {
+    if(n > this->spare() and not this->expand_for_insertion(n)) {
         this->reallocate_when_insertion(n, size, pos, value);
         return iterator {this->first + pos};
     }
-    if constexpr(is_pointer_v<pointer> and is_trivially_copyable_v<T>) {
+    if constexpr(is_pointer_v<pointer> and is_trivially_relocatable_v<T>) {
         const auto start_pos {this->first + pos};
-        const auto stop_pos {start_pos + n};
         const auto tail_size {size - pos};
-        ds::memory_move(stop_pos, start_pos, sizeof(T) * tail_size);
-        for(auto it {start_pos}; it not_eq stop_pos; ++it) {
-            *it = value;
+        auto pointer_to_value {&value};
+        if(this->is_insertion_value_need_fix(start_pos, pointer_to_value)) {
+            pointer_to_value += n;
         }
-        this->cursor = stop_pos + tail_size;
+        ds::memory_move(start_pos + n, start_pos, sizeof(T) * tail_size);
+        transaction trans {relocation_handler {start_pos, n, tail_size}};
+        for(auto &i {trans.get_rollback().i}; i < n; ++i) {
+            ds::construct(start_pos + i, *pointer_to_value);
+        }
+        trans.complete();
+        this->cursor = start_pos + n + tail_size;
         return iterator {start_pos};
     }
     auto uninitialized_size {n};
@@ -726,15 +921,16 @@ vector<T, Allocator>::insert(size_type pos, const_reference value, size_type n)
     }
     return iterator {result};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(const_iterator pos, const_reference value, size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, const_reference value, size_type n) {
     return this->insert(pos - this->begin(), value, n);
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename ...Args>
-constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(size_type pos, Args &&...args) {
-    if(this->spare() == 0) {
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::emplace(size_type pos, Args &&...args) {
+    if(this->spare() == 0 and not this->expand_for_insertion(1)) {
         this->reallocate_when_insertion(1, this->size(), pos, ds::forward<Args>(args)...);
         return iterator {this->first + pos};
     }
@@ -744,68 +940,85 @@ constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(
         ++this->cursor;
         return iterator {result};
     }
-    ds::construct(this->cursor, this->cursor[-1]);
-    for(auto it {this->cursor++}; it not_eq result; --it) {
+    if constexpr(is_pointer_v<pointer> and is_trivially_relocatable_v<T>) {
+        ds::construct(this->cursor, ds::forward<Args>(args)...);
+        alignas(T) unsigned char value[sizeof(T)];
+        ds::memory_copy(value, this->cursor, sizeof(T));
+        ds::memory_move(result + 1, result, sizeof(T) * static_cast<size_type>(this->cursor - result));
+        ds::memory_copy(result, value, sizeof(T));
+        ++this->cursor;
+        return iterator {result};
+    }
+    ds::construct(this->cursor, ds::move(this->cursor[-1]));
+    for(auto it {this->cursor++ - 1}; it not_eq result; --it) {
         *it = ds::move(it[-1]);
     }
     *result = T(ds::forward<Args>(args)...);
     return iterator {result};
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename ...Args>
-constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(const_iterator pos, Args &&...args) {
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::emplace(const_iterator pos, Args &&...args) {
     return this->emplace(pos - this->cbegin(), ds::forward<Args>(args)...);
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(size_type pos, rvalue_reference value) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(size_type pos, rvalue_reference value) {
     return this->emplace(pos, ds::move(value));
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(const_iterator pos, rvalue_reference value) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, rvalue_reference value) {
     return this->emplace(pos - this->cbegin(), ds::move(value));
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(size_type pos, InputIterator begin, InputIterator end) {
-    buffer<T, Allocator> b(begin, end, this->last.allocator());
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(size_type pos, InputIterator begin, InputIterator end) {
+    buffer<T, Allocator, GrowthPolicy> b(begin, end, this->last.allocator());
     return this->insert(pos, b.mbegin(), b.mend());
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(const_iterator pos, InputIterator begin, InputIterator end) {
-    buffer<T, Allocator> b(begin, end, this->last.allocator());
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, InputIterator begin, InputIterator end) {
+    buffer<T, Allocator, GrowthPolicy> b(begin, end, this->last.allocator());
     return this->insert(pos - this->cbegin(), b.mbegin(), b.mend());
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsForwardIterator ForwardIterator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(size_type pos, ForwardIterator begin, ForwardIterator end) {
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(size_type pos, ForwardIterator begin, ForwardIterator end) {
     // Todo : if ForwardIterator is pointer?
     auto n {static_cast<size_type>(ds::distance(begin, end))};
     if(n == 0) {
         return iterator {this->first + pos};
     }
     const auto size {this->size()};
-    if(n > this->spare()) {
+    if(n > this->spare() and not this->expand_for_insertion(n)) {
         this->reallocate_when_insertion<false>(n, size, pos, begin, end);
         return iterator {this->first + pos};
     }
-    if constexpr(is_pointer_v<pointer> and is_trivially_copyable_v<T>) {
+    if constexpr(is_pointer_v<pointer> and is_trivially_relocatable_v<T>) {
         const auto start_pos {this->first + pos};
-        const auto stop_pos {start_pos + n};
         const auto tail_size {size - pos};
-        ds::memory_move(stop_pos, start_pos, sizeof(T) * tail_size);
         if constexpr(is_pointer_v<ForwardIterator>) {
-            ds::memory_copy(start_pos, begin, sizeof(T) * n);
+            if(this->is_insertion_value_need_fix(start_pos, begin)) {
+                begin += n;
+            }
         }
-        for(auto it {start_pos}; it not_eq stop_pos; ++it) {
-            *it = *begin++;
+        ds::memory_move(start_pos + n, start_pos, sizeof(T) * tail_size);
+        if constexpr(is_pointer_v<ForwardIterator> and is_trivially_copyable_v<T>) {
+            ds::memory_copy(start_pos, begin, sizeof(T) * n);
+        }else {
+            transaction trans {relocation_handler {start_pos, n, tail_size}};
+            for(auto &i {trans.get_rollback().i}; i < n; ++i) {
+                ds::construct(start_pos + i, *begin++);
+            }
+            trans.complete();
         }
-        this->cursor = stop_pos + tail_size;
+        this->cursor = start_pos + n + tail_size;
         return iterator {start_pos};
     }
     auto uninitialized_size {n};
@@ -844,29 +1057,31 @@ vector<T, Allocator>::insert(size_type pos, ForwardIterator begin, ForwardIterat
     }
     return iterator {result};
 }
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <IsForwardIterator ForwardIterator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(const_iterator pos, ForwardIterator begin, ForwardIterator end) {
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, ForwardIterator begin, ForwardIterator end) {
     return this->insert(pos - this->cbegin(), begin, end);
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(size_type pos, initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(size_type pos, initializer_list<T> init_list) {
     return this->insert(pos, init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::insert(const_iterator pos, initializer_list<T> init_list) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::insert(const_iterator pos, initializer_list<T> init_list) {
     return this->insert(pos - this->cbegin(), init_list.begin(), init_list.end());
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(size_type pos, size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::erase(size_type pos, size_type n) {
     const auto result {this->first + pos};
     if(n == 0) {
         return iterator {result};
     }
-    if constexpr(is_pointer_v<pointer> and is_trivially_copyable_v<T>) {
+    if constexpr(is_pointer_v<pointer> and is_trivially_relocatable_v<T>) {
+        ds::destroy(result, result + n);
         ds::memory_move(result, result + n, sizeof(T) * (this->size() - (pos + n)));
     }else {
         auto left {result};
@@ -878,27 +1093,489 @@ constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(si
     this->cursor -= n;
     return iterator {result};
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(const_iterator pos, size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::erase(const_iterator pos, size_type n) {
     return this->erase(pos - this->cbegin(), n);
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(const_iterator pos) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::erase(const_iterator pos) {
     return this->erase(pos - this->cbegin());
 }
-template <typename T, typename Allocator>
-constexpr typename vector<T, Allocator>::iterator
-vector<T, Allocator>::erase(const_iterator begin, const_iterator end) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr typename vector<T, Allocator, GrowthPolicy>::iterator
+vector<T, Allocator, GrowthPolicy>::erase(const_iterator begin, const_iterator end) {
     return this->erase(begin - this->cbegin(), static_cast<size_type>(end - begin));
 }
 
 /* global functions */
-template <typename T, typename Allocator>
-constexpr void swap(vector<T, Allocator> &lhs, vector<T, Allocator> &rhs) noexcept {
+template <typename T, typename Allocator, typename GrowthPolicy>
+constexpr void swap(vector<T, Allocator, GrowthPolicy> &lhs, vector<T, Allocator, GrowthPolicy> &rhs) noexcept {
     lhs.swap(rhs);
 }
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline constexpr bool operator==(const vector<T, Allocator, GrowthPolicy> &lhs,
+        const vector<T, Allocator, GrowthPolicy> &rhs) noexcept(is_nothrow_equal_to_comparable_v<const T &>) {
+    return ds::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+template <typename T, typename Allocator, typename GrowthPolicy>
+inline constexpr auto operator<=>(const vector<T, Allocator, GrowthPolicy> &lhs,
+        const vector<T, Allocator, GrowthPolicy> &rhs) noexcept(__dsa::is_nothrow_synth_three_way_comparable_v<T>) {
+    return ds::lexicographical_compare_three_way(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
 __DATA_STRUCTURE_END(vector implementation)
 
+__DATA_STRUCTURE_START(vector traits)
+template <typename T, typename Allocator, typename GrowthPolicy>
+struct is_trivially_relocatable<vector<T, Allocator, GrowthPolicy>> : is_trivially_relocatable<Allocator> {};
+__DATA_STRUCTURE_END(vector traits)
+
+__DATA_STRUCTURE_START(small vector allocator)
+namespace __data_structure_auxiliary {
+template <typename T, size_t N>
+struct small_vector_storage {
+    constexpr static auto inline_capacity {N};
+    alignas(T) unsigned char block[sizeof(T) * N];
+    bool in_use {};
+};
+/*
+ * The allocator of small_vector hands out the inline block of its small_vector first, only the allocation which is
+ * larger than N or happens while the inline block is in use goes to the original allocator.
+ */
+template <typename T, typename Storage = small_vector_storage<T, 1>, typename Allocator = allocator<T>>
+class small_vector_allocator : public Allocator {
+    friend constexpr bool operator==(const small_vector_allocator &lhs, const small_vector_allocator &rhs) noexcept {
+        return lhs.storage == rhs.storage and
+                static_cast<const Allocator &>(lhs) == static_cast<const Allocator &>(rhs);
+    }
+public:
+    using size_type = typename Allocator::size_type;
+    using difference_type = typename Allocator::difference_type;
+    using value_type = T;
+private:
+    constexpr static auto N {Storage::inline_capacity};
+private:
+    Storage *storage;
+private:
+    [[nodiscard]]
+    constexpr T *inline_block() const noexcept {
+        return reinterpret_cast<T *>(this->storage->block);
+    }
+public:
+    constexpr small_vector_allocator(Storage *storage, const Allocator &allocator) noexcept :
+            Allocator(allocator), storage {storage} {}
+    constexpr small_vector_allocator(const small_vector_allocator &) noexcept = default;
+    constexpr small_vector_allocator(small_vector_allocator &&) noexcept = default;
+    constexpr ~small_vector_allocator() noexcept = default;
+public:
+    constexpr small_vector_allocator &operator=(const small_vector_allocator &) noexcept = default;
+    constexpr small_vector_allocator &operator=(small_vector_allocator &&) noexcept = default;
+public:
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    constexpr T *allocate(size_t n) noexcept(NoThrow) {
+        if(n == 0) {
+            return nullptr;
+        }
+        if(n <= N and not this->storage->in_use) {
+            this->storage->in_use = true;
+            return this->inline_block();
+        }
+        return this->Allocator::template allocate<NoThrow>(n);
+    }
+    template <bool NoThrow = false>
+    [[nodiscard]]
+    constexpr T *reallocate(void *source, size_t n) noexcept(NoThrow) requires is_trivially_relocatable_v<T> {
+        if(n == 0) {
+            this->deallocate(source);
+            return nullptr;
+        }
+        if(source == this->inline_block()) {
+            if(n <= N) {
+                return this->inline_block();
+            }
+            const auto memory {this->Allocator::template allocate<NoThrow>(n)};
+            if constexpr(NoThrow) {
+                if(not memory) {
+                    return nullptr;
+                }
+            }
+            ds::memory_copy(memory, source, sizeof(T) * N);
+            this->storage->in_use = false;
+            return memory;
+        }
+        if(not source) {
+            return this->allocate<NoThrow>(n);
+        }
+        return this->Allocator::template reallocate<NoThrow>(source, n);
+    }
+    [[nodiscard]]
+    constexpr bool try_expand(void *p, size_t n) noexcept {
+        if(p == this->inline_block()) {
+            return n <= N;
+        }
+        return __dsa::try_expand(static_cast<Allocator &>(*this), p, n);
+    }
+    constexpr void deallocate(void *p) noexcept {
+        if(p == this->inline_block()) {
+            this->storage->in_use = false;
+        }else {
+            this->Allocator::deallocate(p);
+        }
+    }
+    constexpr void deallocate(void *p, size_t n) noexcept {
+        if(p == this->inline_block()) {
+            this->storage->in_use = false;
+        }else {
+            this->Allocator::deallocate(p, n);
+        }
+    }
+};
+}
+__DATA_STRUCTURE_END(small vector allocator)
+
+__DATA_STRUCTURE_START(small vector declaration)
+/*
+ * small_vector keeps up to N elements in an inline block, so it is free of allocation until the size exceeds N.
+ * The elements are relocated to the memory from Allocator when the inline block is not large enough, and back to
+ * the inline block by shrink_to_fit. It has the same interface as ds::vector, but the iterators are invalidated
+ * by the move operations and swap, which relocate the elements in the inline block.
+ */
+template <typename T, size_t N, typename Allocator = allocator<T>, typename GrowthPolicy = doubling_growth_policy>
+class small_vector : __dsa::small_vector_storage<T, N>,
+        vector<T, __dsa::small_vector_allocator<T, __dsa::small_vector_storage<T, N>, Allocator>, GrowthPolicy> {
+    static_assert(N > 0, "The inline capacity of small_vector should be positive!");
+private:
+    using real_allocator = __dsa::small_vector_allocator<T, __dsa::small_vector_storage<T, N>, Allocator>;
+    using base = vector<T, real_allocator, GrowthPolicy>;
+public:
+    using allocator_type = Allocator;
+    using typename base::size_type;
+    using typename base::difference_type;
+    using typename base::value_type;
+    using typename base::reference;
+    using typename base::const_reference;
+    using typename base::rvalue_reference;
+    using typename base::pointer;
+    using typename base::const_pointer;
+    using typename base::iterator;
+    using typename base::const_iterator;
+    using typename base::reverse_iterator;
+    using typename base::const_reverse_iterator;
+    using typename base::growth_policy;
+private:
+    struct relocation_handler;
+private:
+    [[nodiscard]]
+    constexpr pointer inline_block() const noexcept;
+    constexpr void reset_to_inline_block() noexcept;
+    constexpr void relocate_to(pointer);
+    constexpr void move_from(small_vector &) noexcept(is_nothrow_move_constructible_v<T>);
+    constexpr void release_storage() noexcept;
+public:
+    constexpr small_vector() noexcept(is_nothrow_default_constructible_v<Allocator>);
+    explicit constexpr small_vector(const Allocator &) noexcept;
+    explicit constexpr small_vector(size_type, const Allocator & = {});
+    constexpr small_vector(size_type, const_reference, const Allocator & = {});
+    template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+    constexpr small_vector(InputIterator, InputIterator, const Allocator & = {}, size_type = 64);
+    template <IsForwardIterator ForwardIterator>
+    constexpr small_vector(ForwardIterator, ForwardIterator, const Allocator & = {});
+    constexpr small_vector(initializer_list<T>, const Allocator & = {});
+    constexpr small_vector(const small_vector &);
+    constexpr small_vector(const small_vector &, const Allocator &);
+    constexpr small_vector(small_vector &&) noexcept(is_nothrow_move_constructible_v<T>);
+    constexpr ~small_vector() noexcept;
+public:
+    constexpr small_vector &operator=(const small_vector &);
+    constexpr small_vector &operator=(small_vector &&) noexcept(is_nothrow_move_constructible_v<T>);
+    constexpr small_vector &operator=(initializer_list<T>);
+    using base::operator[];
+    using base::assign;
+    using base::begin;
+    using base::cbegin;
+    using base::end;
+    using base::cend;
+    using base::rbegin;
+    using base::crbegin;
+    using base::rend;
+    using base::crend;
+    using base::size;
+    using base::empty;
+    using base::capacity;
+    using base::spare;
+    using base::reserve;
+    [[nodiscard]]
+    constexpr bool is_inline() const noexcept;
+    constexpr void shrink_to_fit();
+    constexpr void resize(size_type);
+    constexpr void resize(size_type, const_reference);
+    using base::resize_for_overwrite;
+    using base::append_uninitialized;
+    using base::front;
+    using base::back;
+    using base::data;
+    [[nodiscard]]
+    constexpr Allocator allocator() const noexcept;
+    using base::push_back;
+    using base::emplace_back;
+    using base::unchecked_push_back;
+    using base::unchecked_emplace_back;
+    using base::append_range;
+    using base::pop_back;
+    using base::clear;
+    constexpr void swap(small_vector &) noexcept(is_nothrow_move_constructible_v<T>);
+    using base::insert;
+    using base::emplace;
+    using base::erase;
+};
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline constexpr void swap(small_vector<T, N, Allocator, GrowthPolicy> &, small_vector<T, N, Allocator, GrowthPolicy> &)
+        noexcept(is_nothrow_move_constructible_v<T>);
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr bool operator==(const small_vector<T, N, Allocator, GrowthPolicy> &,
+        const small_vector<T, N, Allocator, GrowthPolicy> &) noexcept(is_nothrow_equal_to_comparable_v<const T &>);
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+[[nodiscard]]
+inline constexpr auto operator<=>(const small_vector<T, N, Allocator, GrowthPolicy> &,
+        const small_vector<T, N, Allocator, GrowthPolicy> &) noexcept(__dsa::is_nothrow_synth_three_way_comparable_v<T>);
+__DATA_STRUCTURE_END(small vector declaration)
+
+__DATA_STRUCTURE_START(small vector implementation)
+
+/* private types */
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+struct small_vector<T, N, Allocator, GrowthPolicy>::relocation_handler {
+    pointer begin;
+    size_type i {0};
+    constexpr void operator()() noexcept {
+        ds::destroy(this->begin, this->begin + this->i);
+    }
+};
+
+/* private functions */
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr typename small_vector<T, N, Allocator, GrowthPolicy>::pointer
+small_vector<T, N, Allocator, GrowthPolicy>::inline_block() const noexcept {
+    return reinterpret_cast<pointer>(const_cast<unsigned char *>(this->block));
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::reset_to_inline_block() noexcept {
+    // the storage of vector is always the inline block when it is empty, so the capacity is never less than N
+    if(not this->first) {
+        this->first = this->cursor = this->inline_block();
+        this->in_use = true;
+    }
+    if(this->first == this->inline_block()) {
+        this->last() = this->first + N;
+    }
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::relocate_to(pointer new_first) {
+    const auto size {this->size()};
+    if constexpr(is_trivially_relocatable_v<T>) {
+        ds::memory_copy(new_first, this->first, sizeof(T) * size);
+    }else {
+        auto trans {transaction {relocation_handler {new_first}}};
+        for(auto &i {trans.get_rollback().i}; i < size; ++i) {
+            ds::construct(new_first + i, ds::move(this->first[i]));
+        }
+        trans.complete();
+        ds::destroy(this->first, this->cursor);
+    }
+    this->cursor = this->first;
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::move_from(small_vector &rhs)
+        noexcept(is_nothrow_move_constructible_v<T>) {
+    // *this should be empty with the inline block
+    if(rhs.is_inline()) {
+        const auto size {rhs.size()};
+        rhs.relocate_to(this->first);
+        this->cursor = this->first + size;
+    }else {
+        this->in_use = false;
+        this->first = rhs.first;
+        this->cursor = rhs.cursor;
+        this->last() = rhs.last();
+        rhs.first = nullptr;
+        rhs.reset_to_inline_block();
+    }
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::release_storage() noexcept {
+    // the elements are destroyed and the heap block is freed, then *this is empty with the inline block
+    ds::destroy(this->first, this->cursor);
+    this->last.allocator().deallocate(this->first, this->capacity());
+    this->first = nullptr;
+    this->reset_to_inline_block();
+}
+
+/* public functions */
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector()
+        noexcept(is_nothrow_default_constructible_v<Allocator>) : small_vector(Allocator {}) {}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(const Allocator &allocator) noexcept :
+        base(real_allocator(this, allocator)) {
+    this->reset_to_inline_block();
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(size_type n, const Allocator &allocator) :
+        base(n, real_allocator(this, allocator)) {
+    this->reset_to_inline_block();
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(size_type n, const_reference value,
+        const Allocator &allocator) : base(n, value, real_allocator(this, allocator)) {
+    this->reset_to_inline_block();
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+template <IsInputIterator InputIterator> requires (not is_forward_iterator_v<InputIterator>)
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(InputIterator begin, InputIterator end,
+        const Allocator &allocator, size_type default_size) : small_vector(allocator) {
+    // the inline block is filled first, default_size is the capacity taken once the inline block overflows
+    for(; begin not_eq end; ++begin) {
+        if(this->size() == N and default_size > N) {
+            this->reserve(default_size);
+        }
+        this->emplace_back(ds::move(*begin));
+    }
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+template <IsForwardIterator ForwardIterator>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(ForwardIterator begin, ForwardIterator end,
+        const Allocator &allocator) : base(begin, end, real_allocator(this, allocator)) {
+    this->reset_to_inline_block();
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(initializer_list<T> init_list,
+        const Allocator &allocator) : small_vector(init_list.begin(), init_list.end(), allocator) {}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(const small_vector &rhs) :
+        small_vector(rhs.cbegin(), rhs.cend(), rhs.allocator()) {}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(const small_vector &rhs,
+        const Allocator &allocator) : small_vector(rhs.cbegin(), rhs.cend(), allocator) {}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::small_vector(small_vector &&rhs)
+        noexcept(is_nothrow_move_constructible_v<T>) : small_vector(rhs.allocator()) {
+    this->move_from(rhs);
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy>::~small_vector() noexcept {
+    this->release_storage();
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy> &
+small_vector<T, N, Allocator, GrowthPolicy>::operator=(const small_vector &rhs) {
+    if(this not_eq &rhs) {
+        this->assign(rhs.cbegin(), rhs.cend());
+    }
+    return *this;
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy> &
+small_vector<T, N, Allocator, GrowthPolicy>::operator=(small_vector &&rhs)
+        noexcept(is_nothrow_move_constructible_v<T>) {
+    if(this not_eq &rhs) {
+        this->release_storage();
+        this->move_from(rhs);
+    }
+    return *this;
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr small_vector<T, N, Allocator, GrowthPolicy> &
+small_vector<T, N, Allocator, GrowthPolicy>::operator=(initializer_list<T> init_list) {
+    this->assign(init_list.begin(), init_list.end());
+    return *this;
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr bool small_vector<T, N, Allocator, GrowthPolicy>::is_inline() const noexcept {
+    return this->first == this->inline_block();
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::shrink_to_fit() {
+    if(this->is_inline()) {
+        return;
+    }
+    if(const auto size {this->size()}; size <= N) {
+        const auto old_first {this->first};
+        const auto old_capacity {this->capacity()};
+        this->relocate_to(this->inline_block());
+        this->last.allocator().deallocate(old_first, old_capacity);
+        this->first = this->inline_block();
+        this->cursor = this->first + size;
+        this->last() = this->first + N;
+        this->in_use = true;
+    }else {
+        this->base::shrink_to_fit();
+    }
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::resize(size_type n) {
+    // unlike ds::vector, the capacity is kept, so the inline block is never given up by resize
+    if(n <= this->size()) {
+        ds::destroy(this->first + n, this->cursor);
+        this->cursor = this->first + n;
+    }else if(n <= this->capacity()) {
+        const auto end {this->first + n};
+        do {
+            ds::construct(this->cursor);
+        }while(++this->cursor not_eq end);
+    }else {
+        this->base::resize(n);
+    }
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::resize(size_type n, const_reference value) {
+    if(n <= this->size()) {
+        ds::destroy(this->first + n, this->cursor);
+        this->cursor = this->first + n;
+    }else if(n <= this->capacity()) {
+        const auto end {this->first + n};
+        do {
+            ds::construct(this->cursor, value);
+        }while(++this->cursor not_eq end);
+    }else {
+        this->base::resize(n, value);
+    }
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr Allocator small_vector<T, N, Allocator, GrowthPolicy>::allocator() const noexcept {
+    return static_cast<const Allocator &>(this->last.allocator());
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void small_vector<T, N, Allocator, GrowthPolicy>::swap(small_vector &rhs)
+        noexcept(is_nothrow_move_constructible_v<T>) {
+    if(this not_eq &rhs) {
+        small_vector tmp {ds::move(rhs)};
+        rhs = ds::move(*this);
+        *this = ds::move(tmp);
+    }
+}
+
+/* global functions */
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+constexpr void swap(small_vector<T, N, Allocator, GrowthPolicy> &lhs, small_vector<T, N, Allocator, GrowthPolicy> &rhs)
+        noexcept(is_nothrow_move_constructible_v<T>) {
+    lhs.swap(rhs);
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline constexpr bool operator==(const small_vector<T, N, Allocator, GrowthPolicy> &lhs,
+        const small_vector<T, N, Allocator, GrowthPolicy> &rhs) noexcept(is_nothrow_equal_to_comparable_v<const T &>) {
+    return ds::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline constexpr auto operator<=>(const small_vector<T, N, Allocator, GrowthPolicy> &lhs,
+        const small_vector<T, N, Allocator, GrowthPolicy> &rhs)
+        noexcept(__dsa::is_nothrow_synth_three_way_comparable_v<T>) {
+    return ds::lexicographical_compare_three_way(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+__DATA_STRUCTURE_END(small vector implementation)
+
 }       // namespace data_structure
 
 #endif      //DATA_STRUCTURE_VECTOR_HPP
\ No newline at end of file
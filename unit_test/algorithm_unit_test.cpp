@@ -0,0 +1,260 @@
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include "unit_test.hpp"
+#include "../source/vector.hpp"
+#include "../source/array.hpp"
+#include "../source/algorithm.hpp"
+
+using namespace ds;
+class algorithm_correctness : public unit_test_correctness {
+private:
+    // ordered by operator< only, operator<=> of the containers falls back on it
+    struct less_only {
+        int value;
+        bool operator==(const less_only &) const noexcept = default;
+        bool operator<(const less_only &rhs) const noexcept {
+            return this->value < rhs.value;
+        }
+    };
+    template <typename T>
+    std::vector<T> generate_small_values(int, int);
+    template <typename T>
+    void check_find_and_count(int);
+    template <typename T>
+    void check_min_and_max(int);
+    template <typename T>
+    void check_equal_and_compare(int);
+public:
+    ~algorithm_correctness() noexcept override = default;
+public:
+    void test_find_and_count();
+    void test_min_and_max();
+    void test_equal_and_compare();
+    void test_non_vectorizable();
+    // operator== and operator<=> of vector and array
+    void test_container_comparison();
+};
+
+void algorithm_unit_test() {
+    auto correctness {new algorithm_correctness {}};
+    correctness->test_find_and_count();
+    correctness->test_min_and_max();
+    correctness->test_equal_and_compare();
+    correctness->test_non_vectorizable();
+    correctness->test_container_comparison();
+    delete correctness;
+}
+
+template <typename T>
+std::vector<T> algorithm_correctness::generate_small_values(int count, int range) {
+    // the values are limited in a small range, so the values are found and repeated
+    std::vector<T> result {};
+    for(const auto value : this->generate_random_sequence(-range, range, count)) {
+        result.push_back(static_cast<T>(value));
+    }
+    return result;
+}
+template <typename T>
+void algorithm_correctness::check_find_and_count(int count) {
+    const auto v {this->generate_small_values<T>(count, 20)};
+    const auto begin {v.data()}, end {v.data() + v.size()};
+    for(auto value {-21}; value <= 21; ++value) {
+        const auto target {static_cast<T>(value)};
+        assert(ds::find(begin, end, target) == std::find(begin, end, target));
+        assert(ds::count(begin, end, target) == std::count(begin, end, target));
+    }
+    // every offset of the end, so the tails of the vectorized loops are covered
+    for(auto size {0uz}; size <= v.size() and size < 80; ++size) {
+        const auto target {v.empty() ? T {} : v[v.size() - 1]};
+        assert(ds::find(begin, begin + size, target) == std::find(begin, begin + size, target));
+        assert(ds::count(begin, begin + size, target) == std::count(begin, begin + size, target));
+    }
+}
+template <typename T>
+void algorithm_correctness::check_min_and_max(int count) {
+    const auto v {this->generate_small_values<T>(count, 100)};
+    const auto begin {v.data()}, end {v.data() + v.size()};
+    for(auto i {0uz}; i <= v.size(); i += v.size() / 7 + 1) {
+        assert(ds::min_element(begin + i, end) == std::min_element(begin + i, end));
+        assert(ds::max_element(begin + i, end) == std::max_element(begin + i, end));
+    }
+}
+template <typename T>
+void algorithm_correctness::check_equal_and_compare(int count) {
+    const auto v {this->generate_small_values<T>(count, 100)};
+    auto other {v};
+    const auto size {static_cast<ptrdiff_t>(v.size())};
+    assert(ds::equal(v.data(), v.data() + size, other.data()));
+    assert(ds::lexicographical_compare_three_way(v.data(), v.data() + size, other.data(), other.data() + size) == 0);
+    for(auto i {0}; i < 20 and size > 0; ++i) {
+        const auto pos {this->generate_count(static_cast<int>(size) - 1)};
+        other = v;
+        other[pos] = static_cast<T>(other[pos] + 1);
+        assert(not ds::equal(v.data(), v.data() + size, other.data()));
+        const auto expected {std::lexicographical_compare(v.data(), v.data() + size,
+                other.data(), other.data() + size)};
+        assert(ds::lexicographical_compare(v.data(), v.data() + size, other.data(), other.data() + size) == expected);
+        const auto result {ds::lexicographical_compare_three_way(other.data(), other.data() + size,
+                v.data(), v.data() + size)};
+        assert((result < 0) == std::lexicographical_compare(other.data(), other.data() + size,
+                v.data(), v.data() + size));
+    }
+    // a prefix is less than the whole range
+    if(size > 0) {
+        assert(ds::lexicographical_compare(v.data(), v.data() + (size - 1), v.data(), v.data() + size));
+        assert(not ds::lexicographical_compare(v.data(), v.data() + size, v.data(), v.data() + (size - 1)));
+        assert(not ds::equal(v.data(), v.data() + size, v.data(), v.data() + (size - 1)));
+    }
+}
+
+void algorithm_correctness::test_find_and_count() {
+    std::cout << "Start checking find and count!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(1000)};
+        this->check_find_and_count<char>(count);
+        this->check_find_and_count<unsigned char>(count);
+        this->check_find_and_count<short>(count);
+        this->check_find_and_count<unsigned short>(count);
+        this->check_find_and_count<int>(count);
+        this->check_find_and_count<unsigned>(count);
+        this->check_find_and_count<long long>(count);
+        this->check_find_and_count<unsigned long long>(count);
+    }
+    std::cout << "\ttest_find_and_count/Integers of every width checking done." << std::endl;
+
+    std::cout << "Checking find and count finished!" << std::endl;
+}
+void algorithm_correctness::test_min_and_max() {
+    std::cout << "Start checking min_element and max_element!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(1000)};
+        this->check_min_and_max<signed char>(count);
+        this->check_min_and_max<unsigned char>(count);
+        this->check_min_and_max<short>(count);
+        this->check_min_and_max<unsigned short>(count);
+        this->check_min_and_max<int>(count);
+        this->check_min_and_max<unsigned>(count);
+        this->check_min_and_max<long long>(count);
+        this->check_min_and_max<unsigned long long>(count);
+    }
+    std::cout << "\ttest_min_and_max/Integers of every width checking done." << std::endl;
+
+    std::cout << "Checking min_element and max_element finished!" << std::endl;
+}
+void algorithm_correctness::test_equal_and_compare() {
+    std::cout << "Start checking equal and lexicographical_compare!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(1000)};
+        this->check_equal_and_compare<signed char>(count);
+        this->check_equal_and_compare<unsigned char>(count);
+        this->check_equal_and_compare<short>(count);
+        this->check_equal_and_compare<unsigned short>(count);
+        this->check_equal_and_compare<int>(count);
+        this->check_equal_and_compare<unsigned>(count);
+        this->check_equal_and_compare<long long>(count);
+        this->check_equal_and_compare<unsigned long long>(count);
+    }
+    std::cout << "\ttest_equal_and_compare/Integers of every width checking done." << std::endl;
+
+    std::cout << "Checking equal and lexicographical_compare finished!" << std::endl;
+}
+void algorithm_correctness::test_non_vectorizable() {
+    std::cout << "Start checking the algorithms with non-vectorizable types!" << std::endl;
+
+    {
+        const std::string strings[] {"a", "b", "c", "b"};
+        assert(ds::find(strings, strings + 4, std::string {"b"}) == strings + 1);
+        assert(ds::count(strings, strings + 4, std::string {"b"}) == 2);
+        assert(ds::min_element(strings, strings + 4) == strings);
+        assert(ds::max_element(strings, strings + 4) == strings + 2);
+        assert(ds::equal(strings, strings + 4, strings));
+        assert(ds::lexicographical_compare(strings, strings + 3, strings, strings + 4));
+        std::cout << "\ttest_non_vectorizable/std::string checking done." << std::endl;
+    }
+
+    {
+        const double numbers[] {1.5, -0.0, 0.0, 3.0};
+        assert(ds::find(numbers, numbers + 4, 0.0) == numbers + 1);
+        assert(ds::count(numbers, numbers + 4, 0.0) == 2);
+        assert(ds::max_element(numbers, numbers + 4) == numbers + 3);
+        std::cout << "\ttest_non_vectorizable/double checking done." << std::endl;
+    }
+
+    // constant evaluation
+    {
+        constexpr int numbers[] {3, 1, 4, 1, 5};
+        static_assert(ds::find(numbers, numbers + 5, 4) == numbers + 2);
+        static_assert(ds::count(numbers, numbers + 5, 1) == 2);
+        static_assert(*ds::min_element(numbers, numbers + 5) == 1);
+        static_assert(ds::equal(numbers, numbers + 5, numbers));
+        static_assert(ds::lexicographical_compare_three_way(numbers, numbers + 4, numbers, numbers + 5) < 0);
+        std::cout << "\ttest_non_vectorizable/Constant evaluation checking done." << std::endl;
+    }
+
+    std::cout << "Checking the algorithms with non-vectorizable types finished!" << std::endl;
+}
+void algorithm_correctness::test_container_comparison() {
+    std::cout << "Start checking operator== and operator<=> of vector and array!" << std::endl;
+
+    {
+        vector<int> v {1, 2, 3};
+        vector<int> same {1, 2, 3};
+        vector<int> longer {1, 2, 3, 4};
+        vector<int> greater {1, 3};
+        assert(v == same);
+        assert(v not_eq longer);
+        assert(v < longer);
+        assert(greater > longer);
+        assert((v <=> same) == 0);
+        assert(vector<int> {} < v);
+        assert(vector<int> {} == vector<int> {});
+        vector<std::string> strings {"a", "b"};
+        vector<std::string> other_strings {"a", "c"};
+        assert(strings < other_strings);
+        assert(strings not_eq other_strings);
+        std::cout << "\ttest_container_comparison/vector checking done." << std::endl;
+    }
+
+    {
+        array<int, 3> a {}, b {};
+        a.assign({1, 2, 3});
+        b.assign({1, 2, 4});
+        assert(a == a);
+        assert(a < b);
+        assert((b <=> a) > 0);
+        std::cout << "\ttest_container_comparison/array checking done." << std::endl;
+    }
+
+    {
+        vector<less_only> v {{1}, {2}, {3}};
+        vector<less_only> greater {{1}, {3}};
+        static_assert(is_same_v<decltype(v <=> greater), weak_ordering>);
+        assert(v < greater);
+        assert((v <=> v) == 0);
+        assert((greater <=> v) > 0);
+        array<less_only, 2> a {}, b {};
+        a.assign({less_only {1}, less_only {2}});
+        b.assign({less_only {1}, less_only {1}});
+        assert(b < a and (a <=> a) == 0);
+        std::cout << "\ttest_container_comparison/Less than only checking done." << std::endl;
+    }
+
+    {
+        // the first difference is beyond the chunks skipped by memcmp
+        vector<int> v(1000, 7);
+        auto other {v};
+        other[900] = 8;
+        assert(v < other and (other <=> v) > 0);
+        other[900] = 6;
+        assert(v > other);
+        other[900] = 7;
+        assert((v <=> other) == 0);
+        std::cout << "\ttest_container_comparison/Long vector checking done." << std::endl;
+    }
+
+    std::cout << "Checking operator== and operator<=> of vector and array finished!" << std::endl;
+}
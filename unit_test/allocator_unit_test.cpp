@@ -0,0 +1,399 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include "unit_test.hpp"
+#include "../source/vector.hpp"
+#include "../source/devector.hpp"
+#include "../source/deque.hpp"
+#include "../source/list.hpp"
+#include "../source/forward_list.hpp"
+
+using namespace ds;
+class allocator_correctness : public unit_test_correctness {
+private:
+    // an allocator without try_expand, all the blocks are moved when they grow
+    template <typename T>
+    struct plain_allocator {
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using value_type = T;
+        static T *allocate(size_t n) {
+            return allocator<T>::allocate(n);
+        }
+        static T *reallocate(void *p, size_t n) {
+            return allocator<T>::reallocate(p, n);
+        }
+        static void deallocate(void *p) noexcept {
+            allocator<T>::deallocate(p);
+        }
+        static void deallocate(void *p, size_t) noexcept {
+            allocator<T>::deallocate(p);
+        }
+    };
+private:
+    // the sum of the histogram is the count of requests, that is, allocations and reallocations
+    static size_t histogram_sum(const allocation_statistics &) noexcept;
+public:
+    ~allocator_correctness() noexcept override = default;
+public:
+    void test_instrumented_allocator();
+    void test_try_expand();
+    void test_monotonic_arena();
+    void test_arena_allocator();
+};
+
+void allocator_unit_test() {
+    auto correctness {new allocator_correctness {}};
+    correctness->test_instrumented_allocator();
+    correctness->test_try_expand();
+    correctness->test_monotonic_arena();
+    correctness->test_arena_allocator();
+    delete correctness;
+}
+
+size_t allocator_correctness::histogram_sum(const allocation_statistics &statistics) noexcept {
+    auto sum {0uz};
+    for(auto i {0uz}; i < allocation_statistics::histogram_size; ++i) {
+        sum += statistics.histogram(i);
+    }
+    return sum;
+}
+void allocator_correctness::test_instrumented_allocator() {
+    std::cout << "Start checking ds::instrumented_allocator!" << std::endl;
+
+    auto &statistics {instrumented_allocator<int>::statistics()};
+    static_assert(&instrumented_allocator<int>::statistics() == &instrumented_allocator<std::string>::statistics());
+    {
+        statistics.reset();
+        int *p {instrumented_allocator<int>::allocate(10)};
+        assert(statistics.allocate_calls() == 1 and statistics.live_bytes() == 10 * sizeof(int));
+        assert(statistics.histogram(allocation_statistics::histogram_bucket(10 * sizeof(int))) == 1);
+        p = instrumented_allocator<int>::reallocate(p, 100);
+        assert(statistics.reallocate_calls() == 1 and statistics.live_bytes() == 100 * sizeof(int));
+        assert(statistics.peak_bytes() == 100 * sizeof(int));
+        p = instrumented_allocator<int>::reallocate(p, 20);
+        assert(statistics.live_bytes() == 20 * sizeof(int) and statistics.peak_bytes() == 100 * sizeof(int));
+        instrumented_allocator<int>::deallocate(p);
+        assert(statistics.deallocate_calls() == 1 and statistics.live_bytes() == 0);
+        assert(instrumented_allocator<int>::allocate(0) == nullptr and statistics.allocate_calls() == 1);
+        instrumented_allocator<int>::deallocate(nullptr);
+        assert(statistics.deallocate_calls() == 1);
+        assert(histogram_sum(statistics) == 3);
+        std::cout << "\ttest_instrumented_allocator/Counters checking done." << std::endl;
+    }
+    {
+        // the trivially relocatable elements grow by reallocation, and shrink_to_fit reallocates as well
+        statistics.reset();
+        {
+            vector<int, instrumented_allocator<int>> v {};
+            auto growth {0uz};
+            for(auto i {0}; i < 1000; ++i) {
+                const auto capacity {v.capacity()};
+                v.push_back(i);
+                growth += capacity not_eq v.capacity();
+            }
+            assert(statistics.allocate_calls() == 1 and statistics.reallocate_calls() == growth - 1);
+            assert(statistics.live_bytes() == v.capacity() * sizeof(int));
+            assert(statistics.peak_bytes() == statistics.live_bytes());
+            const auto peak {statistics.peak_bytes()};
+            v.resize(10);
+            v.shrink_to_fit();
+            assert(statistics.live_bytes() == 10 * sizeof(int) and statistics.peak_bytes() == peak);
+            assert(statistics.deallocate_calls() == 0);
+            assert(histogram_sum(statistics) == statistics.allocate_calls() + statistics.reallocate_calls());
+        }
+        assert(statistics.deallocate_calls() == 1 and statistics.live_bytes() == 0);
+        std::cout << "\ttest_instrumented_allocator/ds::vector<int> grow and shrink checking done." << std::endl;
+    }
+    {
+        // the other elements are moved to a new block, so the old and the new block are both alive at the peak
+        statistics.reset();
+        {
+            vector<std::string, instrumented_allocator<std::string>> v {};
+            auto largest_growth {0uz};
+            for(auto i {0}; i < 300; ++i) {
+                const auto capacity {v.capacity()};
+                v.emplace_back(32, 'x');
+                if(capacity not_eq v.capacity()) {
+                    largest_growth = capacity + v.capacity();
+                }
+            }
+            assert(statistics.allocate_calls() == statistics.deallocate_calls() + 1);
+            assert(statistics.live_bytes() == v.capacity() * sizeof(std::string));
+            assert(statistics.peak_bytes() >= largest_growth * sizeof(std::string));
+            v.clear();
+            v.shrink_to_fit();
+            assert(statistics.live_bytes() == 0);
+        }
+        assert(statistics.allocate_calls() == statistics.deallocate_calls() and statistics.live_bytes() == 0);
+        std::cout << "\ttest_instrumented_allocator/ds::vector<std::string> grow and shrink checking done."
+                << std::endl;
+    }
+    {
+        // the slack reported by usable_size is recorded as the live bytes of the block
+        static_assert(__dsa::IsUsableSizeAllocator<instrumented_allocator<int>>);
+        statistics.reset();
+        assert(instrumented_allocator<int>::usable_size(nullptr, 3) == 3);
+        const auto p {instrumented_allocator<int>::allocate(3)};
+        const auto usable {instrumented_allocator<int>::usable_size(p, 3)};
+        assert(usable >= 3 and statistics.live_bytes() == usable * sizeof(int));
+        for(auto i {0uz}; i < usable; ++i) {
+            p[i] = static_cast<int>(i);
+        }
+        assert(instrumented_allocator<int>::usable_size(p, usable) == usable);
+        instrumented_allocator<int>::deallocate(p, usable);
+        assert(statistics.live_bytes() == 0);
+        std::cout << "\ttest_instrumented_allocator/Usable size checking done." << std::endl;
+    }
+    {
+        // the threads share the statistics, none of their allocations is lost
+        statistics.reset();
+        constexpr auto thread_count {4}, allocation_count {10000};
+        std::thread threads[thread_count];
+        for(auto &thread : threads) {
+            thread = std::thread {[] {
+                for(auto i {0}; i < allocation_count; ++i) {
+                    instrumented_allocator<int>::deallocate(instrumented_allocator<int>::allocate(i % 64 + 1));
+                }
+            }};
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        assert(statistics.allocate_calls() == thread_count * allocation_count);
+        assert(statistics.deallocate_calls() == thread_count * allocation_count);
+        assert(histogram_sum(statistics) == thread_count * allocation_count and statistics.live_bytes() == 0);
+        assert(statistics.peak_bytes() >= 64 * sizeof(int) and statistics.peak_bytes() <= thread_count * 64 * sizeof(int));
+        std::cout << "\ttest_instrumented_allocator/Concurrent counters checking done." << std::endl;
+    }
+
+    std::cout << "Checking ds::instrumented_allocator finished!" << std::endl;
+}
+void allocator_correctness::test_try_expand() {
+    std::cout << "Start checking __dsa::try_expand!" << std::endl;
+
+    {
+        static_assert(not __dsa::IsExpandableAllocator<plain_allocator<int>>);
+        plain_allocator<int> plain {};
+        const auto p {plain.allocate(4)};
+        assert(not __dsa::try_expand(plain, p, 1) and not __dsa::try_expand(plain, p, 4));
+        plain.deallocate(p);
+        vector<int, plain_allocator<int>> v {};
+        for(auto i {0}; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        for(auto i {0}; i < 1000; ++i) {
+            assert(v[i] == i);
+        }
+        std::cout << "\ttest_try_expand/Allocator without try_expand checking done." << std::endl;
+    }
+    {
+        // ds::allocator grows a block in place as far as the usable size of the block
+        static_assert(__dsa::IsExpandableAllocator<allocator<int>>);
+        allocator<int> a {};
+        assert(not __dsa::try_expand(a, nullptr, 1));
+        const auto p {a.allocate(4)};
+        for(auto i {0}; i < 4; ++i) {
+            p[i] = i;
+        }
+        assert(__dsa::try_expand(a, p, 4) and __dsa::try_expand(a, p, 1));
+        auto usable {4uz};
+        while(usable < 4096 and __dsa::try_expand(a, p, usable + 1)) {
+            ++usable;
+        }
+        assert(not __dsa::try_expand(a, p, usable + 4096));
+        for(auto i {4uz}; i < usable; ++i) {
+            p[i] = static_cast<int>(i);
+        }
+        for(auto i {0uz}; i < usable; ++i) {
+            assert(p[i] == static_cast<int>(i));
+        }
+        a.deallocate(p);
+        std::cout << "\ttest_try_expand/ds::allocator checking done." << std::endl;
+    }
+    {
+        // the vector keeps its elements where they are if the block could be expanded
+        vector<int> v {};
+        v.reserve(4);
+        for(auto i {0}; i < 4; ++i) {
+            v.push_back(i);
+        }
+        const auto data {v.data()};
+        auto usable {v.capacity()};
+        while(usable < 4096 and __dsa::try_expand(v.last.allocator(), data, usable + 1)) {
+            ++usable;
+        }
+        assert(v.expand_in_place(usable) and v.data() == data and v.capacity() == usable);
+        for(auto i {4}; i < static_cast<int>(usable); ++i) {
+            v.push_back(i);
+        }
+        assert(v.data() == data);
+        for(auto i {0}; i < static_cast<int>(usable); ++i) {
+            assert(v[i] == i);
+        }
+        std::cout << "\ttest_try_expand/ds::vector expansion in place checking done." << std::endl;
+    }
+
+    std::cout << "Checking __dsa::try_expand finished!" << std::endl;
+}
+void allocator_correctness::test_monotonic_arena() {
+    std::cout << "Start checking ds::monotonic_arena!" << std::endl;
+
+    const auto address {[](const void *p) noexcept {
+        return reinterpret_cast<size_t>(p);
+    }};
+    {
+        // the size of a block is recorded in front of it, so the next block starts behind the size
+        monotonic_arena arena(1024);
+        assert(arena.current == nullptr and arena.allocate(0, 8) == nullptr and arena.current == nullptr);
+        const auto first {static_cast<unsigned char *>(arena.allocate(16, alignof(size_t)))};
+        const auto second {static_cast<unsigned char *>(arena.allocate(16, alignof(size_t)))};
+        assert(second == first + 16 + sizeof(size_t));
+        assert(monotonic_arena::block_size(first) == 16 and monotonic_arena::block_size(second) == 16);
+        assert(arena.current not_eq nullptr and arena.current->previous == nullptr);
+        assert(arena.current->size == 1024 and arena.next_chunk_size == 2048);
+        std::cout << "\ttest_monotonic_arena/Bump allocation checking done." << std::endl;
+    }
+    {
+        monotonic_arena arena(1024);
+        for(auto alignment {1uz}; alignment <= 256; alignment *= 2) {
+            static_cast<void>(arena.allocate(1, 1));
+            assert(address(arena.allocate(3, alignment)) % alignment == 0);
+        }
+        std::cout << "\ttest_monotonic_arena/Alignment checking done." << std::endl;
+    }
+    {
+        // a new chunk is allocated when the block doesn't fit, and the chunk size grows geometrically
+        monotonic_arena arena(64);
+        static_cast<void>(arena.allocate(40, 8));
+        const auto first_chunk {arena.current};
+        assert(first_chunk->size == 64 and arena.next_chunk_size == 128);
+        static_cast<void>(arena.allocate(40, 8));
+        assert(arena.current->previous == first_chunk);
+        assert(arena.current->size == 128 and arena.next_chunk_size == 256);
+        // a block larger than the next chunk size gets a chunk of its own size
+        static_cast<void>(arena.allocate(1000, 8));
+        assert(arena.current->size >= 1000 and arena.next_chunk_size == arena.current->size * 2);
+        std::cout << "\ttest_monotonic_arena/Chunk growth checking done." << std::endl;
+    }
+    {
+        // only the last block can be extended in place, the others are reallocated by copying
+        monotonic_arena arena(1024);
+        const auto first {static_cast<int *>(arena.allocate(4 * sizeof(int), alignof(int)))};
+        for(auto i {0}; i < 4; ++i) {
+            first[i] = i;
+        }
+        assert(arena.try_expand(first, 8 * sizeof(int)));
+        assert(arena.reallocate(first, 16 * sizeof(int), alignof(int)) == first);
+        const auto second {arena.allocate(sizeof(int), alignof(int))};
+        assert(not arena.try_expand(first, 32 * sizeof(int)));
+        const auto moved {static_cast<int *>(arena.reallocate(first, 32 * sizeof(int), alignof(int)))};
+        assert(moved not_eq first and address(moved) > address(second));
+        for(auto i {0}; i < 4; ++i) {
+            assert(moved[i] == i);
+        }
+        assert(not arena.try_expand(moved, 4096));
+        std::cout << "\ttest_monotonic_arena/Expansion and reallocation checking done." << std::endl;
+    }
+    {
+        // rewinding frees the chunks allocated after the checkpoint, releasing frees all the chunks
+        monotonic_arena arena(64);
+        static_cast<void>(arena.allocate(16, 8));
+        const auto point {arena.mark()};
+        const auto next {arena.allocate(16, 8)};
+        for(auto i {0}; i < 10; ++i) {
+            static_cast<void>(arena.allocate(100, 8));
+        }
+        assert(arena.current not_eq point.current);
+        arena.rewind(point);
+        assert(arena.current == point.current and arena.cursor == point.cursor);
+        assert(arena.allocate(16, 8) == next);
+        arena.release();
+        assert(arena.current == nullptr and arena.cursor == nullptr and arena.end == nullptr);
+        assert(arena.allocate(16, 8) not_eq nullptr);
+        std::cout << "\ttest_monotonic_arena/Rewind and release checking done." << std::endl;
+    }
+    {
+        // the external buffer is the first chunk, it's kept by release
+        alignas(64) unsigned char buffer[256];
+        monotonic_arena arena(buffer, sizeof(buffer), 1024);
+        const auto first {arena.allocate(64, 16)};
+        assert(address(first) >= address(buffer) and address(first) + 64 <= address(buffer + sizeof(buffer)));
+        static_cast<void>(arena.allocate(512, 16));
+        assert(arena.current not_eq arena.initial and arena.current->previous == arena.initial);
+        arena.release();
+        assert(arena.current == arena.initial and arena.allocate(64, 16) == first);
+        std::cout << "\ttest_monotonic_arena/External buffer checking done." << std::endl;
+    }
+
+    std::cout << "Checking ds::monotonic_arena finished!" << std::endl;
+}
+void allocator_correctness::test_arena_allocator() {
+    std::cout << "Start checking ds::arena_allocator!" << std::endl;
+
+    {
+        monotonic_arena arena {}, another {};
+        const arena_allocator<int> allocator {arena};
+        const arena_allocator<double> rebound {allocator};
+        static_assert(is_same_v<allocator_traits<arena_allocator<int>>::rebind<double>, arena_allocator<double>>);
+        static_assert(not is_default_constructible_v<arena_allocator<int>>);
+        assert(&rebound.resource() == &arena and allocator == rebound);
+        assert(allocator not_eq arena_allocator<int> {another});
+        const auto node_allocator {__dsa::rebind_allocator<arena_allocator<std::string>>(allocator)};
+        assert(&node_allocator.resource() == &arena);
+        const auto p {rebound.allocate(4)};
+        assert(address_of(*p) not_eq nullptr and reinterpret_cast<size_t>(p) % alignof(double) == 0);
+        assert(arena.current not_eq nullptr and another.current == nullptr);
+        std::cout << "\ttest_arena_allocator/Rebinding checking done." << std::endl;
+    }
+    {
+        // the containers are constructed with an allocator bound to the arena, the rebound allocators share it
+        monotonic_arena arena {};
+        const auto used {[&arena](monotonic_arena::checkpoint point) noexcept {
+            return arena.current not_eq point.current or arena.cursor not_eq point.cursor;
+        }};
+        const arena_allocator<int> allocator {arena};
+        auto point {arena.mark()};
+        {
+            vector<int, arena_allocator<int>> v {allocator};
+            small_vector<int, 4, arena_allocator<int>> sv {allocator};
+            devector<int, arena_allocator<int>> dv {allocator};
+            for(auto i {0}; i < 100; ++i) {
+                v.push_back(i);
+                sv.push_back(i);
+                dv.push_front(i);
+            }
+            for(auto i {0}; i < 100; ++i) {
+                assert(v[i] == i and sv[i] == i and dv[i] == 99 - i);
+            }
+            assert(&v.allocator().resource() == &arena and &dv.allocator().resource() == &arena);
+        }
+        assert(used(point));
+        point = arena.mark();
+        {
+            deque<std::string, arena_allocator<std::string>> d {arena_allocator<std::string> {allocator}};
+            for(auto i {0}; i < 1000; ++i) {
+                d.push_back(std::to_string(i));
+                d.push_front(std::to_string(i));
+            }
+            assert(d.size() == 2000 and d.front() == "999" and d.back() == "999");
+            assert(&d.allocator().resource() == &arena);
+        }
+        assert(used(point));
+        point = arena.mark();
+        {
+            list<int, arena_allocator<int>> l {allocator};
+            forward_list<int, arena_allocator<int>> f {allocator};
+            for(auto i {0}; i < 100; ++i) {
+                l.push_back(i);
+                f.push_front(i);
+            }
+            assert(l.size() == 100 and l.front() == 0 and l.back() == 99 and f.front() == 99);
+            assert(&l.allocator().resource() == &arena);
+        }
+        assert(used(point));
+        std::cout << "\ttest_arena_allocator/Containers with an explicit arena checking done." << std::endl;
+    }
+
+    std::cout << "Checking ds::arena_allocator finished!" << std::endl;
+}
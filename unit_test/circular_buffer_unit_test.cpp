@@ -0,0 +1,494 @@
+#include <iostream>
+#include <deque>
+#include <algorithm>
+#include <string>
+#include <cstring>
+#include <memory>
+#include <limits>
+#include <stdexcept>
+#include "unit_test.hpp"
+#include "../source/circular_buffer.hpp"
+#include "../source/sort.hpp"
+
+using namespace ds;
+class circular_buffer_correctness : public unit_test_correctness {
+private:
+    // has no default constructor, the live objects are counted
+    struct counted {
+        static inline int live {0};
+        int value;
+        explicit counted(int value) noexcept : value {value} {
+            ++counted::live;
+        }
+        counted(const counted &rhs) noexcept : value {rhs.value} {
+            ++counted::live;
+        }
+        counted &operator=(const counted &) noexcept = default;
+        ~counted() noexcept {
+            --counted::live;
+        }
+    };
+    // a stateful allocator counting the live blocks of each id, so a block freed by another allocator is caught
+    template <typename T>
+    struct tagged_allocator {
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using value_type = T;
+        static inline int live[2] {};
+        int id;
+        T *allocate(size_t n) const {
+            ++tagged_allocator::live[this->id];
+            return allocator<T>::allocate(n);
+        }
+        void deallocate(void *p, size_t) const noexcept {
+            assert(tagged_allocator::live[this->id] > 0);
+            --tagged_allocator::live[this->id];
+            allocator<T>::deallocate(p);
+        }
+        bool operator==(const tagged_allocator &) const noexcept = default;
+    };
+private:
+    // push and pop randomly in both full modes, the result is compared with std::deque
+    template <typename CircularBuffer>
+    void check_push_and_pop(typename CircularBuffer::size_type, int);
+public:
+    ~circular_buffer_correctness() noexcept override = default;
+public:
+    void test_capacity();
+    void test_push_and_pop();
+    void test_iterator();
+    void test_span();
+    void test_copy_and_move();
+    void test_non_trivial();
+    void test_element_lifetime();
+};
+
+void circular_buffer_unit_test() {
+    auto correctness {new circular_buffer_correctness {}};
+    correctness->test_capacity();
+    correctness->test_push_and_pop();
+    correctness->test_iterator();
+    correctness->test_span();
+    correctness->test_copy_and_move();
+    correctness->test_non_trivial();
+    correctness->test_element_lifetime();
+    delete correctness;
+}
+
+template <typename CircularBuffer>
+void circular_buffer_correctness::check_push_and_pop(typename CircularBuffer::size_type capacity, int count) {
+    CircularBuffer b(capacity);
+    std::deque<int> correct {};
+    for(const auto operation : this->generate_random_sequence(0, 5, count)) {
+        const auto value {this->generate_a_random_number()};
+        switch(operation) {
+            case 0:
+            case 1:
+                // the oldest element is overwritten when it is full
+                b.push_back(value);
+                if(correct.size() == b.capacity()) {
+                    correct.pop_front();
+                }
+                correct.push_back(value);
+                break;
+            case 2:
+                if(b.try_push_back(value)) {
+                    assert(correct.size() < b.capacity());
+                    correct.push_back(value);
+                }else {
+                    assert(correct.size() == b.capacity());
+                }
+                break;
+            case 3:
+                if(not correct.empty()) {
+                    b.pop_back();
+                    correct.pop_back();
+                }
+                break;
+            default:
+                if(not correct.empty()) {
+                    b.pop_front();
+                    correct.pop_front();
+                }
+                break;
+        }
+        assert(b.size() == correct.size());
+        assert(b.full() == (correct.size() == b.capacity()));
+        if(not correct.empty()) {
+            assert(b.front() == correct.front());
+            assert(b.back() == correct.back());
+        }
+    }
+    assert(b.end() - b.begin() == static_cast<ptrdiff_t>(correct.size()));
+    for(auto i {0uz}; i < correct.size(); ++i) {
+        assert(b[i] == correct[i]);
+    }
+    auto it {correct.cbegin()};
+    for(const auto &value : b) {
+        assert(value == *it++);
+    }
+}
+
+void circular_buffer_correctness::test_capacity() {
+    std::cout << "Start checking capacity of ds::circular_buffer!" << std::endl;
+
+    {
+        circular_buffer<int> b(1);
+        static_assert(noexcept(b.begin()));
+        static_assert(noexcept(b.end()));
+        static_assert(noexcept(b.first_span()));
+        static_assert(noexcept(b.second_span()));
+        static_assert(noexcept(b.pop_front()));
+        static_assert(noexcept(b.pop_back()));
+        static_assert(noexcept(b.clear()));
+        static_assert(noexcept(b.swap(b)));
+        static_assert(noexcept(circular_buffer<int>(ds::move(b))));
+        static_assert(is_trivially_relocatable_v<circular_buffer<int>>);
+        std::cout << "\ttest_capacity/Circular buffer member functions nothrow checking done." << std::endl;
+    }
+    {
+        // the capacity is rounded up to a power of two
+        assert(circular_buffer<int>(0).capacity() == 0);
+        assert(circular_buffer<int>().capacity() == 0);
+        assert(circular_buffer<int>(1).capacity() == 1);
+        assert(circular_buffer<int>(2).capacity() == 2);
+        assert(circular_buffer<int>(3).capacity() == 4);
+        assert(circular_buffer<int>(64).capacity() == 64);
+        assert(circular_buffer<int>(65).capacity() == 128);
+        circular_buffer<int> b(1000);
+        assert(b.capacity() == 1024);
+        assert(b.empty() and not b.full() and b.size() == 0);
+        assert(b.begin() == b.end());
+        // the largest power of two of size_t is the last capacity which can be rounded to
+        static_assert(ds::bit_ceil(std::numeric_limits<size_t>::max() / 2 + 1) ==
+                std::numeric_limits<size_t>::max() / 2 + 1);
+        for(auto n : {std::numeric_limits<size_t>::max() / 2 + 2, std::numeric_limits<size_t>::max()}) {
+            auto thrown {false};
+            try {
+                circular_buffer<int> overflow(n);
+            }catch(const std::length_error &) {
+                thrown = true;
+            }
+            assert(thrown);
+        }
+        std::cout << "\ttest_capacity/Power of two capacity checking done." << std::endl;
+    }
+    {
+        circular_buffer<int> b {};
+        assert(b.empty() and b.full());
+        assert(not b.try_push_back(42));
+        assert(b.first_span().empty() and b.second_span().empty());
+        // push_back drops the element instead of writing out of the storage
+        b.push_back(42);
+        b.emplace_back(42);
+        assert(b.empty() and b.begin() == b.end());
+        std::cout << "\ttest_capacity/Zero capacity checking done." << std::endl;
+    }
+
+    std::cout << "Checking capacity of ds::circular_buffer finished!" << std::endl;
+}
+void circular_buffer_correctness::test_push_and_pop() {
+    std::cout << "Start checking push and pop of ds::circular_buffer!" << std::endl;
+
+    {
+        circular_buffer<int> b(4);
+        for(auto i {0}; i < 4; ++i) {
+            assert(b.try_push_back(i));
+        }
+        assert(b.full());
+        assert(not b.try_push_back(4));
+        assert(b.front() == 0 and b.back() == 3);
+        b.push_back(4);
+        b.push_back(5);
+        assert(b.full() and b.size() == 4);
+        assert(b.front() == 2 and b.back() == 5);
+        b.pop_front(3);
+        assert(b.size() == 1 and b.front() == 5);
+        b.clear();
+        assert(b.empty());
+        std::cout << "\ttest_push_and_pop/Overwrite and reject checking done." << std::endl;
+    }
+    {
+        for(const auto capacity : {1uz, 2uz, 3uz, 16uz, 100uz}) {
+            this->check_push_and_pop<circular_buffer<int>>(capacity, 10000);
+        }
+        std::cout << "\ttest_push_and_pop/Random push and pop checking done." << std::endl;
+    }
+    {
+        // the storage is allocated once, the steady traffic doesn't allocate
+        auto &statistics {instrumented_allocator<int>::statistics()};
+        statistics.reset();
+        {
+            circular_buffer<int, instrumented_allocator<int>> b(256);
+            for(auto i {0}; i < 100000; ++i) {
+                b.push_back(i);
+                if(i % 3 == 1) {
+                    b.pop_front();
+                }
+            }
+            assert(b.full() and b.back() == 99999);
+            assert(statistics.allocate_calls() == 1);
+        }
+        assert(statistics.deallocate_calls() == 1 and statistics.live_bytes() == 0);
+        std::cout << "\ttest_push_and_pop/Single allocation checking done." << std::endl;
+    }
+
+    std::cout << "Checking push and pop of ds::circular_buffer finished!" << std::endl;
+}
+void circular_buffer_correctness::test_iterator() {
+    std::cout << "Start checking iterator of ds::circular_buffer!" << std::endl;
+
+    {
+        static_assert(is_random_access_iterator_v<circular_buffer<int>::iterator>);
+        static_assert(is_random_access_iterator_v<circular_buffer<int>::const_iterator>);
+        static_assert(not is_contiguous_iterator_v<circular_buffer<int>::iterator>);
+        circular_buffer<int> b(8);
+        for(auto i {0}; i < 13; ++i) {
+            b.push_back(i);
+        }
+        // the elements are 5 ... 12, which wrap around the end of the storage
+        const auto &cb {b};
+        circular_buffer<int>::const_iterator cit {b.begin()};
+        assert(cit == cb.begin() and cb.cend() == b.end());
+        assert(b.end() - b.begin() == 8);
+        for(auto i {0}; i < 8; ++i) {
+            assert(b.begin()[i] == 5 + i);
+            assert(*(b.begin() + i) == 5 + i);
+            assert(*(b.end() - (8 - i)) == 5 + i);
+            assert(b.begin() + i < b.end());
+        }
+        auto it {b.end()};
+        for(auto i {12}; i >= 5; --i) {
+            assert(*--it == i);
+        }
+        assert(it == b.begin());
+        auto value {12};
+        for(auto rit {b.rbegin()}; rit not_eq b.rend(); ++rit) {
+            assert(*rit == value--);
+        }
+        std::cout << "\ttest_iterator/Random access iterator checking done." << std::endl;
+    }
+    {
+        circular_buffer<int> b(64);
+        std::deque<int> correct {};
+        for(const auto value : this->generate_random_sequence(100)) {
+            b.push_back(value);
+            if(correct.size() == b.capacity()) {
+                correct.pop_front();
+            }
+            correct.push_back(value);
+        }
+        ds::sort(b.begin(), b.end());
+        std::sort(correct.begin(), correct.end());
+        for(auto i {0uz}; i < correct.size(); ++i) {
+            assert(b[i] == correct[i]);
+        }
+        std::cout << "\ttest_iterator/Sorting wrapped elements checking done." << std::endl;
+    }
+
+    std::cout << "Checking iterator of ds::circular_buffer finished!" << std::endl;
+}
+void circular_buffer_correctness::test_span() {
+    std::cout << "Start checking span of ds::circular_buffer!" << std::endl;
+
+    {
+        circular_buffer<char> b(16);
+        for(const auto c : std::string {"0123456789"}) {
+            b.push_back(c);
+        }
+        assert(b.first_span().size() == 10 and b.second_span().empty());
+        b.pop_front(8);
+        for(const auto c : std::string {"abcdefghij"}) {
+            b.push_back(c);
+        }
+        // "89abcdef" are at the end of the storage, "ghij" are at the beginning
+        const auto first {b.first_span()}, second {b.second_span()};
+        assert(first.size() == 8 and second.size() == 4);
+        assert(first.data() == b.first + 8 and second.data() == b.first);
+        char result[12] {};
+        std::memcpy(result, first.data(), first.size());
+        std::memcpy(result + first.size(), second.data(), second.size());
+        assert(std::string(result, 12) == "89abcdefghij");
+        std::cout << "\ttest_span/Wrapped span checking done." << std::endl;
+    }
+    {
+        circular_buffer<int> b(32);
+        std::deque<int> correct {};
+        for(const auto operation : this->generate_random_sequence(0, 2, 1000)) {
+            if(operation == 0 and not correct.empty()) {
+                b.pop_front();
+                correct.pop_front();
+            }else {
+                const auto value {this->generate_a_random_number()};
+                b.push_back(value);
+                if(correct.size() == b.capacity()) {
+                    correct.pop_front();
+                }
+                correct.push_back(value);
+            }
+            const auto &cb {b};
+            const auto first {cb.first_span()}, second {cb.second_span()};
+            assert(first.size() + second.size() == correct.size());
+            auto it {correct.cbegin()};
+            for(const auto value : first) {
+                assert(value == *it++);
+            }
+            for(const auto value : second) {
+                assert(value == *it++);
+            }
+        }
+        std::cout << "\ttest_span/Random span checking done." << std::endl;
+    }
+
+    std::cout << "Checking span of ds::circular_buffer finished!" << std::endl;
+}
+void circular_buffer_correctness::test_copy_and_move() {
+    std::cout << "Start checking copy and move of ds::circular_buffer!" << std::endl;
+
+    {
+        circular_buffer<int> b(4);
+        for(auto i {0}; i < 6; ++i) {
+            b.push_back(i);
+        }
+        auto copy {b};
+        assert(copy.capacity() == 4 and copy.size() == 4);
+        assert(copy.head == 0);
+        for(auto i {0}; i < 4; ++i) {
+            assert(copy[i] == i + 2);
+        }
+        circular_buffer<int> other(4);
+        other.push_back(42);
+        other = b;
+        assert(other.size() == 4 and other.front() == 2 and other.back() == 5);
+        circular_buffer<int> smaller(2);
+        smaller = b;
+        assert(smaller.capacity() == 4 and smaller.front() == 2 and smaller.back() == 5);
+        std::cout << "\ttest_copy_and_move/Copy checking done." << std::endl;
+    }
+    {
+        circular_buffer<int> b(4);
+        b.push_back(1);
+        b.push_back(2);
+        auto moved {ds::move(b)};
+        assert(b.capacity() == 0 and b.empty());
+        assert(moved.size() == 2 and moved.front() == 1);
+        circular_buffer<int> other(16);
+        other = ds::move(moved);
+        assert(other.capacity() == 4 and other.back() == 2);
+        other.swap(b);
+        assert(other.capacity() == 0 and b.capacity() == 4 and b.size() == 2);
+        std::cout << "\ttest_copy_and_move/Move and swap checking done." << std::endl;
+    }
+    {
+        using allocator_type = tagged_allocator<int>;
+        {
+            circular_buffer<int, allocator_type> b(4, allocator_type {0});
+            b.push_back(1);
+            circular_buffer<int, allocator_type> other(16, allocator_type {1});
+            other = b;
+            assert(other.capacity() == 4 and other.front() == 1);
+            circular_buffer<int, allocator_type> swapped(8, allocator_type {1});
+            swapped.swap(b);
+            assert(swapped.allocator().id == 0 and b.allocator().id == 1);
+        }
+        assert(allocator_type::live[0] == 0 and allocator_type::live[1] == 0);
+        std::cout << "\ttest_copy_and_move/Stateful allocator checking done." << std::endl;
+    }
+
+    std::cout << "Checking copy and move of ds::circular_buffer finished!" << std::endl;
+}
+void circular_buffer_correctness::test_non_trivial() {
+    std::cout << "Start checking non-trivial type of ds::circular_buffer!" << std::endl;
+
+    {
+        circular_buffer<std::string> b(4);
+        for(auto i {0}; i < 10; ++i) {
+            b.push_back(std::string(100, static_cast<char>('a' + i)));
+        }
+        assert(b.front() == std::string(100, 'g') and b.back() == std::string(100, 'j'));
+        b.emplace_back(100, 'k');
+        assert(b.front() == std::string(100, 'h') and b.back() == std::string(100, 'k'));
+        assert(not b.try_emplace_back(3, 'x'));
+        b.pop_front();
+        assert(b.try_emplace_back(3, 'x'));
+        assert(b.back() == "xxx");
+        const std::string value {"value"};
+        b.pop_back();
+        b.push_back(value);
+        assert(b.back() == value);
+        std::cout << "\ttest_non_trivial/std::string checking done." << std::endl;
+    }
+
+    std::cout << "Checking non-trivial type of ds::circular_buffer finished!" << std::endl;
+}
+void circular_buffer_correctness::test_element_lifetime() {
+    std::cout << "Start checking element lifetime of ds::circular_buffer!" << std::endl;
+
+    {
+        // the slots are not constructed until an element is pushed
+        {
+            circular_buffer<counted> b(8);
+            assert(counted::live == 0);
+            for(auto i {0}; i < 5; ++i) {
+                b.emplace_back(i);
+            }
+            assert(counted::live == 5);
+            b.pop_front();
+            b.pop_back();
+            assert(counted::live == 3 and b.front().value == 1 and b.back().value == 3);
+            for(auto i {5}; i < 20; ++i) {
+                b.emplace_back(i);
+            }
+            assert(counted::live == 8 and b.front().value == 12 and b.back().value == 19);
+            b.pop_front(3);
+            assert(counted::live == 5 and b.front().value == 15);
+            auto copy {b};
+            assert(counted::live == 10);
+            circular_buffer<counted> other(8);
+            other.emplace_back(-1);
+            other = b;
+            assert(counted::live == 15 and other.front().value == 15);
+            copy.clear();
+            assert(counted::live == 10 and copy.empty());
+            copy = ds::move(other);
+            assert(counted::live == 10 and copy.size() == 5);
+        }
+        assert(counted::live == 0);
+        std::cout << "\ttest_element_lifetime/Non-default-constructible type checking done." << std::endl;
+    }
+    {
+        // a popped element releases its resources at once
+        const auto resource {std::make_shared<int>(42)};
+        circular_buffer<std::shared_ptr<int>> b(4);
+        b.push_back(resource);
+        b.push_back(resource);
+        assert(resource.use_count() == 3);
+        b.pop_front();
+        assert(resource.use_count() == 2);
+        b.pop_back();
+        assert(resource.use_count() == 1);
+        for(auto i {0}; i < 4; ++i) {
+            b.push_back(resource);
+        }
+        assert(resource.use_count() == 5);
+        // the oldest element is destroyed when it is replaced
+        b.push_back(std::make_shared<int>(0));
+        assert(resource.use_count() == 4);
+        b.pop_front(2);
+        assert(resource.use_count() == 2);
+        b.clear();
+        assert(resource.use_count() == 1 and b.empty());
+        std::cout << "\ttest_element_lifetime/std::shared_ptr release checking done." << std::endl;
+    }
+    {
+        // the new element is made from the oldest element, which is replaced by it
+        circular_buffer<std::string> b(2);
+        b.push_back(std::string(100, 'a'));
+        b.push_back("b");
+        b.push_back(b.front());
+        assert(b.front() == "b" and b.back() == std::string(100, 'a'));
+        std::cout << "\ttest_element_lifetime/Replacing by the oldest element checking done." << std::endl;
+    }
+
+    std::cout << "Checking element lifetime of ds::circular_buffer finished!" << std::endl;
+}
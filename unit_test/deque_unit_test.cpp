@@ -0,0 +1,719 @@
+#include <iostream>
+#include <deque>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include "unit_test.hpp"
+#include "../source/deque.hpp"
+#include "../source/queue.hpp"
+#include "../source/vector.hpp"
+#include "../source/sort.hpp"
+#include "../source/algorithm.hpp"
+
+using namespace ds;
+class deque_correctness : public unit_test_correctness {
+private:
+    struct message {
+        char payload[512];
+        int id;
+    };
+private:
+    // push and pop at both ends randomly, the result is compared with std::deque
+    template <typename Deque>
+    void check_push_and_pop(int);
+    // the segmented algorithms on a random subrange, the result is compared with std::deque
+    template <typename Deque>
+    void check_segmented_algorithms(int);
+    // splice random batches between two deques, the result is compared with std::deque
+    template <typename Deque>
+    void check_splice(int);
+    // insert and erase at the front, the middle, the back or a random position, the result is compared with std::deque
+    template <typename Deque>
+    void check_insert_and_erase(int);
+public:
+    ~deque_correctness() noexcept override = default;
+public:
+    void test_block_size();
+    void test_segmented_algorithms();
+    void test_block_recycling();
+    void test_splice();
+    void test_append_range();
+    void test_insert_and_erase();
+};
+
+void deque_unit_test() {
+    auto correctness {new deque_correctness {}};
+    correctness->test_block_size();
+    correctness->test_segmented_algorithms();
+    correctness->test_block_recycling();
+    correctness->test_splice();
+    correctness->test_append_range();
+    correctness->test_insert_and_erase();
+    delete correctness;
+}
+
+template <typename Deque>
+void deque_correctness::check_push_and_pop(int count) {
+    Deque d {};
+    std::deque<int> correct {};
+    const auto make_value {[](int value) {
+        if constexpr(is_same_v<typename Deque::value_type, message>) {
+            message result {};
+            result.id = value;
+            return result;
+        }else {
+            return value;
+        }
+    }};
+    const auto id {[](const typename Deque::value_type &value) noexcept {
+        if constexpr(is_same_v<typename Deque::value_type, message>) {
+            return value.id;
+        }else {
+            return value;
+        }
+    }};
+    for(const auto operation : this->generate_random_sequence(0, 5, count)) {
+        const auto value {this->generate_a_random_number()};
+        switch(operation) {
+            case 0:
+            case 1:
+                d.push_back(make_value(value));
+                correct.push_back(value);
+                break;
+            case 2:
+            case 3:
+                d.push_front(make_value(value));
+                correct.push_front(value);
+                break;
+            case 4:
+                if(not correct.empty()) {
+                    d.pop_back();
+                    correct.pop_back();
+                }
+                break;
+            default:
+                if(not correct.empty()) {
+                    d.pop_front();
+                    correct.pop_front();
+                }
+                break;
+        }
+        assert(d.size() == correct.size());
+    }
+    assert(d.end() - d.begin() == static_cast<ptrdiff_t>(correct.size()));
+    for(auto i {0uz}; i < correct.size(); ++i) {
+        assert(id(d[i]) == correct[i]);
+        assert(id(*(d.begin() + static_cast<ptrdiff_t>(i))) == correct[i]);
+        assert(id(*(d.end() - static_cast<ptrdiff_t>(correct.size() - i))) == correct[i]);
+    }
+    auto it {correct.cbegin()};
+    for(const auto &value : d) {
+        assert(id(value) == *it++);
+    }
+}
+
+void deque_correctness::test_block_size() {
+    std::cout << "Start checking block size of ds::deque!" << std::endl;
+
+    {
+        static_assert(deque<int>::block_size == 1024);
+        static_assert(deque<message>::block_size == 16);
+        static_assert(deque_block_size<int, 64 * 1024> == 16 * 1024);
+        static_assert(deque_block_size<message, 64 * 1024> == 64 * 1024 / sizeof(message));
+        static_assert(deque_block_size<message, 1> == 1);
+        static_assert(huge_page_deque_block_size<int> == huge_page_size / sizeof(int));
+        static_assert(huge_page_deque_block_size<int, huge_page_size + 1> == 2 * huge_page_size / sizeof(int));
+        static_assert(huge_page_deque_block_size<message> == huge_page_size / sizeof(message));
+        static_assert(deque<int, allocator<int>, 7>::iterator::block_size == 7);
+        static_assert(not is_same_v<deque<int, allocator<int>, 7>::iterator, deque<int>::iterator>);
+        std::cout << "\ttest_block_size/Block size computation checking done." << std::endl;
+    }
+
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(20000)};
+        this->check_push_and_pop<deque<int, allocator<int>, 1>>(count);
+        this->check_push_and_pop<deque<int, allocator<int>, 3>>(count);
+        this->check_push_and_pop<deque<int, allocator<int>, 7>>(count);
+        this->check_push_and_pop<deque<int>>(count);
+        this->check_push_and_pop<deque<int, allocator<int>, deque_block_size<int, 64 * 1024>>>(count);
+        this->check_push_and_pop<deque<message, allocator<message>, deque_block_size<message, 64 * 1024>>>(count);
+    }
+    this->check_push_and_pop<deque<int, allocator<int>, huge_page_deque_block_size<int>>>(100000);
+    std::cout << "\ttest_block_size/Push and pop with the custom block size checking done." << std::endl;
+
+    // the segmented sort works on the blocks of any size
+    {
+        deque<int, allocator<int>, 5> d {};
+        std::vector<int> correct {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(1000))) {
+            d.push_front(value);
+            correct.push_back(value);
+        }
+        static_assert(__dsa::is_segmented_iterator_v<decltype(d.begin())>);
+        ds::sort(d.begin(), d.end());
+        std::sort(correct.begin(), correct.end());
+        for(auto i {0uz}; i < correct.size(); ++i) {
+            assert(d[i] == correct[i]);
+        }
+        std::cout << "\ttest_block_size/Segmented sort with the custom block size checking done." << std::endl;
+    }
+
+    std::cout << "Checking block size of ds::deque finished!" << std::endl;
+}
+template <typename Deque>
+void deque_correctness::check_segmented_algorithms(int count) {
+    using value_type = typename Deque::value_type;
+    Deque d {};
+    std::deque<value_type> correct {};
+    for(const auto value : this->generate_random_sequence(count)) {
+        if(value % 2 == 0) {
+            d.push_front(static_cast<value_type>(value));
+            correct.push_front(static_cast<value_type>(value));
+        }else {
+            d.push_back(static_cast<value_type>(value));
+            correct.push_back(static_cast<value_type>(value));
+        }
+    }
+    const auto size {static_cast<int>(d.size())};
+    const auto first {static_cast<ptrdiff_t>(this->generate_count(size))};
+    const auto last {first + static_cast<ptrdiff_t>(this->generate_count(size - static_cast<int>(first)))};
+    const auto begin {d.begin() + first}, end {d.begin() + last};
+
+    // every piece is contiguous and within a block, the pieces cover the subrange in order
+    auto next {first};
+    ds::for_each_segment(begin, end, [&](value_type *piece_begin, value_type *piece_end) {
+        assert(piece_begin < piece_end);
+        assert(piece_end - piece_begin <= static_cast<ptrdiff_t>(Deque::block_size));
+        for(; piece_begin not_eq piece_end; ++piece_begin) {
+            assert(piece_begin == &d[static_cast<size_t>(next++)]);
+        }
+    });
+    assert(next == last);
+
+    long long sum {0};
+    ds::for_each(begin, end, [&sum](const value_type &value) noexcept {
+        sum += value;
+    });
+    long long correct_sum {0};
+    for(auto i {first}; i < last; ++i) {
+        correct_sum += correct[static_cast<size_t>(i)];
+    }
+    assert(sum == correct_sum);
+    assert(ds::accumulate(begin, end, 0ll) == correct_sum);
+
+    if(first not_eq last) {
+        const auto target {correct[static_cast<size_t>(first + (last - first) / 2)]};
+        auto correct_position {first};
+        while(correct[static_cast<size_t>(correct_position)] not_eq target) {
+            ++correct_position;
+        }
+        assert(ds::find(begin, end, target) - d.begin() == correct_position);
+    }
+
+    std::vector<value_type> buffer(static_cast<size_t>(last - first));
+    assert(ds::copy(begin, end, buffer.data()) == buffer.data() + buffer.size());
+    for(auto i {0uz}; i < buffer.size(); ++i) {
+        assert(buffer[i] == correct[static_cast<size_t>(first) + i]);
+    }
+    Deque other(d.size(), value_type {});
+    assert(ds::copy(begin, end, other.begin() + (d.size() - buffer.size())) == other.end());
+    for(auto i {0uz}; i < buffer.size(); ++i) {
+        assert(other[d.size() - buffer.size() + i] == buffer[i]);
+    }
+    assert(ds::copy(buffer.data(), buffer.data() + buffer.size(), other.begin()) ==
+            other.begin() + static_cast<ptrdiff_t>(buffer.size()));
+    for(auto i {0uz}; i < buffer.size(); ++i) {
+        assert(other[i] == buffer[i]);
+    }
+
+    ds::fill(begin, end, static_cast<value_type>(42));
+    for(auto i {0}; i < size; ++i) {
+        const auto expected {i >= first and i < last ? static_cast<value_type>(42) : correct[static_cast<size_t>(i)]};
+        assert(d[static_cast<size_t>(i)] == expected);
+    }
+}
+
+void deque_correctness::test_segmented_algorithms() {
+    std::cout << "Start checking segmented algorithms of ds::deque!" << std::endl;
+
+    for(auto i {0}; i < 20; ++i) {
+        const auto count {this->generate_count(20000)};
+        this->check_segmented_algorithms<deque<int>>(count);
+        this->check_segmented_algorithms<deque<int, allocator<int>, 7>>(count);
+        this->check_segmented_algorithms<deque<long long, allocator<long long>, 1>>(count / 10);
+        this->check_segmented_algorithms<deque<signed char, allocator<signed char>, 100>>(count);
+    }
+    std::cout << "\ttest_segmented_algorithms/Segmented algorithms checking done." << std::endl;
+
+    {
+        deque<int> empty {};
+        auto called {false};
+        ds::for_each_segment(empty, [&called](int *, int *) noexcept {
+            called = true;
+        });
+        assert(not called);
+        assert(ds::accumulate(empty.begin(), empty.end(), 7) == 7);
+        assert(ds::find(empty.begin(), empty.end(), 0) == empty.end());
+        std::cout << "\ttest_segmented_algorithms/Empty deque checking done." << std::endl;
+    }
+
+    std::cout << "Checking segmented algorithms of ds::deque finished!" << std::endl;
+}
+void deque_correctness::test_block_recycling() {
+    std::cout << "Start checking block recycling of ds::deque!" << std::endl;
+
+    {
+        // the default block size and allocator, the elements cross the block boundaries at both ends
+        deque<int> d;
+        const auto count {static_cast<int>(deque<int>::block_size) * 3 + 5};
+        for(auto round {0}; round < 4; ++round) {
+            for(auto i {0}; i < count; ++i) {
+                d.push_back(i);
+                d.push_front(-i - 1);
+            }
+            assert(d.size() == 2 * static_cast<size_t>(count));
+            for(auto i {0}; i < count; ++i) {
+                assert(d.front() == -count + i and d.back() == count - 1 - i);
+                d.pop_front();
+                d.pop_back();
+            }
+            assert(d.empty() and d.begin() == d.end());
+        }
+        std::cout << "\ttest_block_recycling/Default deque checking done." << std::endl;
+    }
+    {
+        ds::queue<int> q;
+        const auto count {static_cast<int>(deque<int>::block_size) * 3 + 5};
+        int next_push {0}, next_pop {0};
+        for(auto round {0}; round < 4; ++round) {
+            for(auto i {0}; i < count; ++i) {
+                q.push(next_push++);
+            }
+            assert(q.back() == next_push - 1);
+            // leaves a few elements, so the next round starts in the middle of a block
+            while(q.size() > 3) {
+                assert(q.front() == next_pop++);
+                q.pop();
+            }
+        }
+        while(not q.empty()) {
+            assert(q.front() == next_pop++);
+            q.pop();
+        }
+        assert(next_pop == next_push);
+        std::cout << "\ttest_block_recycling/Default queue checking done." << std::endl;
+    }
+
+    using queue = deque<int, instrumented_allocator<int>, 64>;
+    auto &statistics {instrumented_allocator<int>::statistics()};
+    {
+        // the blocks emptied at the head are recycled to the tail, the steady queue traffic doesn't allocate
+        queue q {};
+        int next_push {0}, next_pop {0};
+        for(; next_push < 1000; ++next_push) {
+            q.push_back(next_push);
+        }
+        // the window of the queue may span one more block than the initial elements
+        for(auto i {0}; i < 1000; ++i) {
+            q.push_back(next_push++);
+            q.pop_front();
+            ++next_pop;
+        }
+        statistics.reset();
+        for(auto i {0}; i < 100000; ++i) {
+            q.push_back(next_push++);
+            assert(q.front() == next_pop++);
+            q.pop_front();
+            assert(q.spare_blocks() <= q.high_water_mark());
+        }
+        assert(statistics.allocate_calls() == 0 and statistics.reallocate_calls() == 0);
+        assert(statistics.deallocate_calls() == 0);
+        for(auto i {0}; i < 100000; ++i) {
+            q.push_front(--next_pop);
+            q.pop_back();
+            assert(q.back() == --next_push - 1);
+        }
+        assert(statistics.allocate_calls() == 0);
+        for(auto i {0uz}; i < q.size(); ++i) {
+            assert(q[i] == next_pop + static_cast<int>(i));
+        }
+        std::cout << "\ttest_block_recycling/Queue traffic without allocation checking done." << std::endl;
+    }
+    {
+        queue q {};
+        assert(q.high_water_mark() == queue::default_high_water_mark);
+        q.set_high_water_mark(5);
+        for(auto i {0}; i < 64 * 20; ++i) {
+            q.push_back(i);
+        }
+        while(q.size() > 10) {
+            q.pop_front();
+            assert(q.spare_blocks() <= 5);
+        }
+        assert(q.spare_blocks() == 5);
+        q.set_high_water_mark(1);
+        assert(q.spare_blocks() == 1);
+        for(auto i {0}; i < 64 * 20; ++i) {
+            q.push_front(i);
+        }
+        while(q.size() > 10) {
+            q.pop_back();
+            assert(q.spare_blocks() <= 1);
+        }
+        q.set_high_water_mark(100);
+        q.reserve_back(64 * 10);
+        assert(q.spare_blocks() >= 10);
+        const auto live_bytes {statistics.live_bytes()};
+        q.shrink_to_fit();
+        assert(q.spare_blocks() == 0 and statistics.live_bytes() < live_bytes);
+        for(auto i {0uz}; i < q.size(); ++i) {
+            assert(q[i] == static_cast<int>(64 * 20 - 1 - i));
+        }
+        q.push_back(42);
+        q.push_front(-42);
+        assert(q.front() == -42 and q.back() == 42 and q.size() == 12);
+        while(not q.empty()) {
+            q.pop_back();
+        }
+        q.shrink_to_fit();
+        assert(q.capacity() == 0 and q.begin() == q.end());
+        q.push_front(1);
+        assert(q.size() == 1 and q.front() == 1);
+        std::cout << "\ttest_block_recycling/High-water mark and shrink_to_fit checking done." << std::endl;
+    }
+    {
+        // the short-lived queues take the blocks from the shared cache
+        queue::block_cache cache {8};
+        assert(cache.empty() and cache.high_water_mark() == 8);
+        // the blocks are counted by the histogram, so the allocations of the map are not counted
+        const auto block_bucket {allocation_statistics::histogram_bucket(sizeof(int) * queue::block_size)};
+        statistics.reset();
+        for(auto round {0}; round < 100; ++round) {
+            queue q {};
+            q.share_block_cache(&cache);
+            assert(q.shared_block_cache() == &cache);
+            for(auto i {0}; i < 64 * 4; ++i) {
+                q.push_back(i);
+            }
+            auto moved {ds::move(q)};
+            assert(moved.shared_block_cache() == &cache);
+            queue adopted(ds::move(moved), instrumented_allocator<int> {});
+            assert(adopted.shared_block_cache() == &cache);
+            for(auto i {0}; i < 64 * 4; ++i) {
+                assert(adopted.front() == i);
+                adopted.pop_front();
+            }
+        }
+        assert(cache.size() > 0 and cache.size() <= 8);
+        // the first round allocates the blocks, the others are served by the cache
+        assert(statistics.histogram(block_bucket) <= 5);
+        const auto block_allocations {statistics.histogram(block_bucket)};
+        {
+            queue q {};
+            q.share_block_cache(&cache);
+            for(auto i {0}; i < 64 * 4; ++i) {
+                q.push_back(i);
+            }
+        }
+        assert(statistics.histogram(block_bucket) == block_allocations);
+        {
+            // a copy doesn't share the cache of the origin, which is still the only owner of the cache
+            queue q {};
+            q.share_block_cache(&cache);
+            q.set_high_water_mark(4);
+            q.push_back(0);
+            const queue copied {q};
+            assert(copied.shared_block_cache() == nullptr and copied.high_water_mark() == 4);
+            assert(copied.size() == 1 and copied.front() == 0);
+        }
+        cache.clear();
+        assert(cache.empty());
+        std::cout << "\ttest_block_recycling/Shared block cache checking done." << std::endl;
+    }
+    for(auto i {0}; i < 10; ++i) {
+        this->check_push_and_pop<deque<int, allocator<int>, 3>>(this->generate_count(20000));
+    }
+    std::cout << "\ttest_block_recycling/Random push and pop with recycling checking done." << std::endl;
+
+    std::cout << "Checking block recycling of ds::deque finished!" << std::endl;
+}
+template <typename Deque>
+void deque_correctness::check_splice(int count) {
+    Deque from {}, to {};
+    std::deque<int> correct_from {}, correct_to {};
+    auto next {0};
+    for(auto i {0}; i < count; ++i) {
+        const auto operation {this->generate_a_random_number(0, 7)};
+        if(operation < 4) {
+            const auto n {this->generate_count(200)};
+            for(auto j {0}; j < n; ++j) {
+                from.push_back(next);
+                correct_from.push_back(next++);
+            }
+        }else if(operation < 6) {
+            const auto n {static_cast<size_t>(this->generate_count(static_cast<int>(from.size())))};
+            to.splice_back(from, n);
+            for(auto j {0uz}; j < n; ++j) {
+                correct_to.push_back(correct_from.front());
+                correct_from.pop_front();
+            }
+        }else if(operation == 6 and not correct_to.empty()) {
+            to.pop_front();
+            correct_to.pop_front();
+        }else if(not correct_to.empty()) {
+            to.pop_back();
+            correct_to.pop_back();
+        }
+        assert(from.size() == correct_from.size() and to.size() == correct_to.size());
+    }
+    for(auto i {0uz}; i < correct_from.size(); ++i) {
+        assert(from[i] == correct_from[i]);
+    }
+    for(auto i {0uz}; i < correct_to.size(); ++i) {
+        assert(to[i] == correct_to[i]);
+    }
+    to.splice_back(from);
+    assert(from.empty() and to.size() == correct_to.size() + correct_from.size());
+    for(auto i {0uz}; i < correct_from.size(); ++i) {
+        assert(to[correct_to.size() + i] == correct_from[i]);
+    }
+    from.push_back(1);
+    from.push_front(0);
+    assert(from.size() == 2 and from[0] == 0 and from[1] == 1);
+}
+
+void deque_correctness::test_splice() {
+    std::cout << "Start checking splice of ds::deque!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(500)};
+        this->check_splice<deque<int, allocator<int>, 1>>(count);
+        this->check_splice<deque<int, allocator<int>, 3>>(count);
+        this->check_splice<deque<int, allocator<int>, 64>>(count);
+        this->check_splice<deque<int>>(count);
+    }
+    std::cout << "\ttest_splice/Random splice checking done." << std::endl;
+
+    {
+        // the full blocks change owners, so the addresses of their elements are unchanged
+        using queue = deque<int, instrumented_allocator<int>, 64>;
+        auto &statistics {instrumented_allocator<int>::statistics()};
+        const auto block_bucket {allocation_statistics::histogram_bucket(sizeof(int) * queue::block_size)};
+        queue from {}, to {};
+        for(auto i {0}; i < 64 * 100; ++i) {
+            from.push_back(i);
+        }
+        for(auto i {0}; i < 10; ++i) {
+            from.pop_front();
+        }
+        const auto address {&from[64 * 50]};
+        statistics.reset();
+        to.splice_back(from, 64 * 80);
+        assert(&to[64 * 50] == address);
+        // only the blocks of the partial edges are allocated
+        assert(statistics.histogram(block_bucket) <= 2);
+        for(auto i {0uz}; i < to.size(); ++i) {
+            assert(to[i] == static_cast<int>(i) + 10);
+        }
+        for(auto i {0uz}; i < from.size(); ++i) {
+            assert(from[i] == static_cast<int>(i) + 10 + 64 * 80);
+        }
+        assert(from.spare_blocks() <= from.high_water_mark());
+        // the offsets of the blocks disagree, the elements are moved
+        to.pop_front();
+        to.splice_back(from, 100);
+        for(auto i {0uz}; i < to.size(); ++i) {
+            assert(to[i] == static_cast<int>(i) + 11);
+        }
+        assert(from.front() == 10 + 64 * 80 + 100);
+        std::cout << "\ttest_splice/Block transfer checking done." << std::endl;
+    }
+    {
+        deque<std::string> from {}, to {};
+        for(auto i {0}; i < 3000; ++i) {
+            from.push_back(std::to_string(i));
+        }
+        to.push_back("head");
+        from.pop_front();
+        to.splice_back(from, 2000);
+        to.splice_back(from);
+        assert(from.empty() and to.size() == 3000 and to.front() == "head");
+        for(auto i {1uz}; i < to.size(); ++i) {
+            assert(to[i] == std::to_string(i));
+        }
+        std::cout << "\ttest_splice/std::string checking done." << std::endl;
+    }
+
+    std::cout << "Checking splice of ds::deque finished!" << std::endl;
+}
+void deque_correctness::test_append_range() {
+    std::cout << "Start checking append_range of ds::deque!" << std::endl;
+
+    const auto count {this->generate_count(1000)};
+    {
+        // the sized range is constructed in the reserved blocks at once
+        vector<std::string> source {};
+        for(auto i {0}; i < count; ++i) {
+            source.emplace_back("string_" + std::to_string(i));
+        }
+        deque<std::string, allocator<std::string>, 16> d {};
+        d.push_back("back");
+        d.push_front("front");
+        d.append_range(source);
+        d.append_range(vector<std::string> {});
+        d.append_range(source);
+        assert(d.size() == 2 * static_cast<size_t>(count) + 2);
+        assert(d[0] == "front" and d[1] == "back");
+        for(auto i {0}; i < 2 * count; ++i) {
+            assert(d[i + 2] == source[i % count]);
+        }
+        d.pop_front();
+        d.push_front("again");
+        assert(d.front() == "again" and d.size() == 2 * static_cast<size_t>(count) + 2);
+        std::cout << "\ttest_append_range/Sized range checking done." << std::endl;
+    }
+    {
+        std::stringstream stream {};
+        for(auto i {0}; i < count; ++i) {
+            stream << "string_" << i << ' ';
+        }
+        struct input_range {
+            std::stringstream &stream;
+            std_string_input_iterator begin() {
+                return std_string_input_iterator {this->stream};
+            }
+            std_string_input_iterator end() {
+                return std_string_input_iterator {};
+            }
+        };
+        deque<std::string, allocator<std::string>, 16> d {};
+        d.push_back("front");
+        d.append_range(input_range {stream});
+        assert(d.size() == static_cast<size_t>(count) + 1);
+        assert(d.front() == "front");
+        for(auto i {0}; i < count; ++i) {
+            assert(d[i + 1] == "string_" + std::to_string(i));
+        }
+        std::cout << "\ttest_append_range/Input range checking done." << std::endl;
+    }
+
+    std::cout << "Checking append_range of ds::deque finished!" << std::endl;
+}
+template <typename Deque>
+void deque_correctness::check_insert_and_erase(int count) {
+    using value_type = typename Deque::value_type;
+    const auto make_value {[](int value) {
+        if constexpr(is_same_v<value_type, std::string>) {
+            return "string_" + std::to_string(value);
+        }else {
+            return value;
+        }
+    }};
+    Deque d {};
+    // libstdc++ 12 loses the elements of std::deque<std::string> after an empty insertion into the middle, so the empty
+    //  insertions are only applied to d
+    std::deque<value_type> correct {};
+    const auto operations {this->generate_random_sequence(0, 8, count)};
+    const auto numbers {this->generate_random_sequence(0, std::numeric_limits<int>::max(), count)};
+    for(auto i {0}; i < count; ++i) {
+        const auto size {correct.size()};
+        // the front, the middle, the back or a random position
+        const auto random {static_cast<size_t>(numbers[i])};
+        const size_t positions[] {0, size / 2, size, size == 0 ? 0 : random % (size + 1)};
+        auto position {positions[random % 4]};
+        const auto n {random / 4 % 6};
+        const auto value {make_value(numbers[i])};
+        const auto check_result {[&](auto result) {
+            assert(result - d.begin() == static_cast<ptrdiff_t>(position));
+        }};
+        switch(operations[i]) {
+            case 0:
+                check_result(d.insert(d.cbegin() + static_cast<ptrdiff_t>(position), value));
+                correct.insert(correct.cbegin() + static_cast<ptrdiff_t>(position), value);
+                break;
+            case 1:
+                check_result(d.insert(position, value, n));
+                if(n not_eq 0) {
+                    correct.insert(correct.cbegin() + static_cast<ptrdiff_t>(position), n, value);
+                }
+                break;
+            case 2:
+                check_result(d.emplace(d.cbegin() + static_cast<ptrdiff_t>(position), value));
+                correct.emplace(correct.cbegin() + static_cast<ptrdiff_t>(position), value);
+                break;
+            case 3: {
+                auto moved {value};
+                check_result(d.insert(position, ds::move(moved)));
+                correct.insert(correct.cbegin() + static_cast<ptrdiff_t>(position), value);
+                break;
+            }
+            case 4: {
+                std::vector<value_type> range {};
+                for(auto j {0uz}; j < n; ++j) {
+                    range.push_back(make_value(numbers[i] + static_cast<int>(j)));
+                }
+                const auto first {range.data()};
+                check_result(d.insert(d.cbegin() + static_cast<ptrdiff_t>(position), first, first + range.size()));
+                if(n not_eq 0) {
+                    correct.insert(correct.cbegin() + static_cast<ptrdiff_t>(position), range.cbegin(), range.cend());
+                }
+                break;
+            }
+            case 5:
+                check_result(d.insert(position, {value, make_value(-numbers[i])}));
+                correct.insert(correct.cbegin() + static_cast<ptrdiff_t>(position), {value, make_value(-numbers[i])});
+                break;
+            case 6:
+                if(size not_eq 0) {
+                    position = position == size ? size - 1 : position;
+                    check_result(d.erase(d.cbegin() + static_cast<ptrdiff_t>(position)));
+                    correct.erase(correct.cbegin() + static_cast<ptrdiff_t>(position));
+                }
+                break;
+            case 7: {
+                const auto erased {n < size - position ? n : size - position};
+                check_result(d.erase(position, erased));
+                correct.erase(correct.cbegin() + static_cast<ptrdiff_t>(position),
+                        correct.cbegin() + static_cast<ptrdiff_t>(position + erased));
+                break;
+            }
+            default: {
+                const auto erased {n < size - position ? n : size - position};
+                const auto first {d.cbegin() + static_cast<ptrdiff_t>(position)};
+                check_result(d.erase(first, first + static_cast<ptrdiff_t>(erased)));
+                correct.erase(correct.cbegin() + static_cast<ptrdiff_t>(position),
+                        correct.cbegin() + static_cast<ptrdiff_t>(position + erased));
+                break;
+            }
+        }
+        assert(d.size() == correct.size());
+    }
+    for(auto i {0uz}; i < correct.size(); ++i) {
+        assert(d[i] == correct[i]);
+    }
+    auto it {d.cend()};
+    for(auto i {correct.size()}; i > 0; --i) {
+        assert(*--it == correct[i - 1]);
+    }
+    assert(it == d.cbegin());
+}
+void deque_correctness::test_insert_and_erase() {
+    std::cout << "Start checking insert and erase of ds::deque!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(3000)};
+        this->check_insert_and_erase<deque<int, allocator<int>, 1>>(count);
+        this->check_insert_and_erase<deque<int, allocator<int>, 3>>(count);
+        this->check_insert_and_erase<deque<int, allocator<int>, 16>>(count);
+    }
+    std::cout << "\ttest_insert_and_erase/int checking done." << std::endl;
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(3000)};
+        this->check_insert_and_erase<deque<std::string, allocator<std::string>, 1>>(count);
+        this->check_insert_and_erase<deque<std::string, allocator<std::string>, 3>>(count);
+        this->check_insert_and_erase<deque<std::string, allocator<std::string>, 16>>(count);
+    }
+    std::cout << "\ttest_insert_and_erase/std::string checking done." << std::endl;
+
+    std::cout << "Checking insert and erase of ds::deque finished!" << std::endl;
+}
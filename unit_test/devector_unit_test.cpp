@@ -0,0 +1,362 @@
+#include <iostream>
+#include <deque>
+#include <algorithm>
+#include "unit_test.hpp"
+#include "../source/devector.hpp"
+
+using namespace ds;
+class devector_correctness : public unit_test_correctness {
+public:
+    ~devector_correctness() noexcept override = default;
+public:
+    void test_default_constructor();
+    // devector(size_type, const T &), devector(ForwardIterator, ForwardIterator) and devector(initializer_list<T>)
+    void test_constructor();
+    // push_front, push_back, pop_front, pop_back, front_spare and back_spare
+    void test_push_and_pop();
+    void test_insert();
+    void test_erase();
+    void test_reserve();
+    void test_append_range();
+    void test_non_trivial();
+};
+
+void devector_unit_test() {
+    auto correctness {new devector_correctness {}};
+    correctness->test_default_constructor();
+    correctness->test_constructor();
+    correctness->test_push_and_pop();
+    correctness->test_insert();
+    correctness->test_erase();
+    correctness->test_reserve();
+    correctness->test_append_range();
+    correctness->test_non_trivial();
+    delete correctness;
+}
+
+void devector_correctness::test_default_constructor() {
+    std::cout << "Start checking default constructor for ds::devector!" << std::endl;
+
+    // the members which should be nothrow
+    {
+        devector<int> d {};
+        const devector<int> cd {};
+        static_assert(noexcept(devector<int> {move(d)}));
+        static_assert(noexcept(d = move(d)));
+        static_assert(noexcept(d.begin()));
+        static_assert(noexcept(cd.begin()));
+        static_assert(noexcept(d.end()));
+        static_assert(noexcept(cd.end()));
+        static_assert(noexcept(d.size()));
+        static_assert(noexcept(d.empty()));
+        static_assert(noexcept(d.capacity()));
+        static_assert(noexcept(d.front_spare()));
+        static_assert(noexcept(d.back_spare()));
+        static_assert(noexcept(d.spare()));
+        static_assert(noexcept(d.data()));
+        static_assert(noexcept(d.pop_front()));
+        static_assert(noexcept(d.pop_back()));
+        static_assert(noexcept(d.clear()));
+        static_assert(noexcept(d.swap(declval<devector<int> &>())));
+        std::cout << "\ttest_default_constructor/Member functions nothrow checking done." << std::endl;
+    }
+
+    // empty
+    {
+        devector<int> d {};
+        assert(d.size() == 0);
+        assert(d.empty());
+        assert(d.capacity() == 0);
+        assert(d.begin() == d.end());
+        assert(d.cbegin() == d.cend());
+        std::cout << "\ttest_default_constructor/Empty devector checking done." << std::endl;
+    }
+
+    std::cout << "Checking default constructor for ds::devector finished!" << std::endl;
+}
+void devector_correctness::test_constructor() {
+    std::cout << "Start checking constructors for ds::devector!" << std::endl;
+
+    // devector(size_type, const T &)
+    {
+        const auto size {static_cast<size_t>(this->generate_count(10000))};
+        const auto value {this->generate_a_random_number()};
+        devector<int> d(size, value);
+        assert(d.size() == size);
+        for(auto i {0uz}; i < size; ++i) {
+            assert(d[i] == value);
+        }
+        std::cout << "\ttest_constructor/devector(size_type, const T &) checking done." << std::endl;
+    }
+
+    // devector(ForwardIterator, ForwardIterator)
+    {
+        const auto v {this->generate_random_sequence(this->generate_count(10000))};
+        devector<int> d(v.data(), v.data() + v.size());
+        assert(d.size() == v.size());
+        for(auto i {0uz}; i < v.size(); ++i) {
+            assert(d[i] == v[i]);
+        }
+        devector<int> copy {d};
+        assert(copy.size() == d.size());
+        for(auto i {0uz}; i < v.size(); ++i) {
+            assert(copy[i] == v[i]);
+        }
+        std::cout << "\ttest_constructor/devector(ForwardIterator, ForwardIterator) checking done." << std::endl;
+    }
+
+    // devector(initializer_list<T>)
+    {
+        devector<int> d {1, 2, 3, 4, 5};
+        assert(d.size() == 5);
+        auto i {1};
+        for(auto it {d.cbegin()}; it not_eq d.cend(); ++it) {
+            assert(*it == i++);
+        }
+        i = 5;
+        for(auto it {d.crbegin()}; it not_eq d.crend(); ++it) {
+            assert(*it == i--);
+        }
+        std::cout << "\ttest_constructor/devector(initializer_list<T>) checking done." << std::endl;
+    }
+
+    std::cout << "Checking constructors for ds::devector finished!" << std::endl;
+}
+void devector_correctness::test_push_and_pop() {
+    std::cout << "Start checking push and pop for ds::devector!" << std::endl;
+
+    // mixed push_front and push_back
+    {
+        devector<int> d {};
+        std::deque<int> correct {};
+        const auto size {static_cast<size_t>(this->generate_count(10000))};
+        for(auto i {0uz}; i < size; ++i) {
+            const auto value {this->generate_a_random_number()};
+            if(value % 2 == 0) {
+                d.push_front(value);
+                correct.push_front(value);
+            }else {
+                d.push_back(value);
+                correct.push_back(value);
+            }
+            assert(d.front_spare() + d.size() + d.back_spare() == d.capacity());
+        }
+        assert(d.size() == correct.size());
+        for(auto i {0uz}; i < size; ++i) {
+            assert(d.data()[i] == correct[i]);
+        }
+        std::cout << "\ttest_push_and_pop/Mixed push_front and push_back checking done." << std::endl;
+    }
+
+    // a sliding window should not grow the memory without bound
+    {
+        devector<int> d {};
+        for(auto i {0}; i < 64; ++i) {
+            d.push_back(i);
+        }
+        const auto capacity {d.capacity()};
+        for(auto i {64}; i < 100000; ++i) {
+            d.push_back(i);
+            assert(d.front() == i - 64);
+            d.pop_front();
+        }
+        assert(d.size() == 64);
+        assert(d.capacity() <= capacity * 2);
+        for(auto i {0uz}; i < 64; ++i) {
+            assert(d[i] == static_cast<int>(100000 - 64 + i));
+        }
+        for(auto i {0}; i < 64; ++i) {
+            d.pop_back();
+        }
+        assert(d.empty());
+        std::cout << "\ttest_push_and_pop/Sliding window checking done." << std::endl;
+    }
+
+    // push_front with an element of itself
+    {
+        devector<int> d {1};
+        for(auto i {0}; i < 100; ++i) {
+            d.push_front(d.back());
+            d.push_back(d.front());
+        }
+        assert(d.size() == 201);
+        for(auto i {0uz}; i < d.size(); ++i) {
+            assert(d[i] == 1);
+        }
+        std::cout << "\ttest_push_and_pop/Self reference checking done." << std::endl;
+    }
+
+    std::cout << "Checking push and pop for ds::devector finished!" << std::endl;
+}
+void devector_correctness::test_insert() {
+    std::cout << "Start checking insert for ds::devector!" << std::endl;
+
+    // insert(size_type, const T &, size_type) at random positions
+    {
+        devector<int> d {};
+        std::deque<int> correct {};
+        const auto size {static_cast<size_t>(this->generate_count(1000))};
+        for(auto i {0uz}; i < size; ++i) {
+            const auto pos {this->generate_count(static_cast<int>(d.size()))};
+            const auto value {this->generate_a_random_number()};
+            const auto n {this->generate_count(5)};
+            auto it {d.insert(pos, value, n)};
+            assert(it == d.begin() + pos);
+            correct.insert(correct.begin() + pos, n, value);
+        }
+        assert(d.size() == correct.size());
+        for(auto i {0uz}; i < d.size(); ++i) {
+            assert(d[i] == correct[i]);
+        }
+        std::cout << "\ttest_insert/insert(size_type, const T &, size_type) checking done." << std::endl;
+    }
+
+    // insert(const_iterator, ForwardIterator, ForwardIterator) at front, middle and back
+    {
+        devector<int> d {1, 2, 3};
+        const int a[] {7, 8, 9};
+        d.insert(d.cbegin(), a, a + 3);
+        d.insert(d.cbegin() + 4, a, a + 3);
+        d.insert(d.cend(), a, a + 3);
+        const int expected[] {7, 8, 9, 1, 7, 8, 9, 2, 3, 7, 8, 9};
+        assert(d.size() == 12);
+        for(auto i {0uz}; i < 12; ++i) {
+            assert(d[i] == expected[i]);
+        }
+        std::cout << "\ttest_insert/insert(const_iterator, ForwardIterator, ForwardIterator) checking done." << std::endl;
+    }
+
+    // emplace and insert with an element of itself
+    {
+        devector<int> d {1, 2, 3, 4};
+        d.emplace(2, 42);
+        d.insert(d.cbegin() + 1, d[4], 3);
+        const int expected[] {1, 4, 4, 4, 2, 42, 3, 4};
+        assert(d.size() == 8);
+        for(auto i {0uz}; i < 8; ++i) {
+            assert(d[i] == expected[i]);
+        }
+        std::cout << "\ttest_insert/Self reference checking done." << std::endl;
+    }
+
+    std::cout << "Checking insert for ds::devector finished!" << std::endl;
+}
+void devector_correctness::test_erase() {
+    std::cout << "Start checking erase for ds::devector!" << std::endl;
+
+    {
+        const auto v {this->generate_random_sequence(this->generate_count(1000) + 1)};
+        devector<int> d(v.data(), v.data() + v.size());
+        std::deque<int> correct(v.cbegin(), v.cend());
+        while(not d.empty()) {
+            const auto pos {this->generate_count(static_cast<int>(d.size()) - 1)};
+            const auto n {std::min(this->generate_count(5), static_cast<int>(d.size()) - pos)};
+            auto it {d.erase(d.cbegin() + pos, d.cbegin() + (pos + n))};
+            assert(it == d.begin() + pos);
+            correct.erase(correct.begin() + pos, correct.begin() + (pos + n));
+            assert(d.size() == correct.size());
+            for(auto i {0uz}; i < d.size(); ++i) {
+                assert(d[i] == correct[i]);
+            }
+        }
+        std::cout << "\ttest_erase/Random erasion checking done." << std::endl;
+    }
+
+    std::cout << "Checking erase for ds::devector finished!" << std::endl;
+}
+void devector_correctness::test_reserve() {
+    std::cout << "Start checking reserve_front, reserve_back and shrink_to_fit for ds::devector!" << std::endl;
+
+    {
+        devector<int> d {1, 2, 3};
+        d.reserve_front(100);
+        assert(d.front_spare() >= 100);
+        d.reserve_back(50);
+        assert(d.back_spare() >= 50);
+        assert(d.front_spare() >= 100);
+        const auto capacity {d.capacity()};
+        const auto data {d.data()};
+        for(auto i {0}; i < 100; ++i) {
+            d.push_front(i);
+        }
+        assert(d.capacity() == capacity);
+        assert(d.data() == data - 100);
+        d.shrink_to_fit();
+        assert(d.capacity() == d.size());
+        assert(d.front_spare() == 0 and d.back_spare() == 0);
+        assert(d.front() == 99 and d.back() == 3);
+        d.clear();
+        d.shrink_to_fit();
+        assert(d.capacity() == 0);
+        std::cout << "\ttest_reserve/Spare memory checking done." << std::endl;
+    }
+
+    std::cout << "Checking reserve_front, reserve_back and shrink_to_fit for ds::devector finished!" << std::endl;
+}
+void devector_correctness::test_append_range() {
+    std::cout << "Start checking append_range for ds::devector!" << std::endl;
+
+    {
+        const auto v {this->generate_random_sequence(this->generate_count(10000))};
+        const devector<int> source(v.data(), v.data() + v.size());
+        devector<int> d {1, 2, 3};
+        d.push_front(0);
+        d.append_range(source);
+        int array[] {-1, -2, -3};
+        d.append_range(array);
+        assert(d.size() == v.size() + 7);
+        for(auto i {0uz}; i < v.size(); ++i) {
+            assert(d[i + 4] == v[i]);
+        }
+        assert(d.back() == -3);
+        std::cout << "\ttest_append_range/Forward range checking done." << std::endl;
+    }
+
+    std::cout << "Checking append_range for ds::devector finished!" << std::endl;
+}
+void devector_correctness::test_non_trivial() {
+    std::cout << "Start checking non trivial type std::string for ds::devector!" << std::endl;
+
+    {
+        std::string s {};
+        for(auto i {0}; i < 100; ++i) {         // avoid SSO
+            s += "hello";
+        }
+        devector<std::string> d {};
+        std::deque<std::string> correct {};
+        const auto size {static_cast<size_t>(this->generate_count(1000))};
+        for(auto i {0uz}; i < size; ++i) {
+            const auto value {s + std::to_string(i)};
+            switch(this->generate_a_random_number() % 4) {
+                case 0:
+                    d.push_front(value);
+                    correct.push_front(value);
+                    break;
+                case 1:
+                    d.push_back(value);
+                    correct.push_back(value);
+                    break;
+                case 2: {
+                    const auto pos {this->generate_count(static_cast<int>(d.size()))};
+                    d.insert(pos, value);
+                    correct.insert(correct.begin() + pos, value);
+                    break;
+                }
+                default:
+                    if(not d.empty()) {
+                        const auto pos {this->generate_count(static_cast<int>(d.size()) - 1)};
+                        d.erase(pos);
+                        correct.erase(correct.begin() + pos);
+                    }
+                    break;
+            }
+        }
+        assert(d.size() == correct.size());
+        for(auto i {0uz}; i < d.size(); ++i) {
+            assert(d[i] == correct[i]);
+        }
+        std::cout << "\ttest_non_trivial/Random operations checking done." << std::endl;
+    }
+
+    std::cout << "Checking non trivial type std::string for ds::devector finished!" << std::endl;
+}
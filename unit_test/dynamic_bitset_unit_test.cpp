@@ -0,0 +1,319 @@
+#include <iostream>
+#include <vector>
+#include "unit_test.hpp"
+#include "../source/dynamic_bitset.hpp"
+
+using namespace ds;
+class dynamic_bitset_correctness : public unit_test_correctness {
+public:
+    ~dynamic_bitset_correctness() noexcept override = default;
+private:
+    std::vector<bool> generate_random_bits(int);
+    static void check_same(const dynamic_bitset<> &, const std::vector<bool> &);
+public:
+    void test_default_constructor();
+    // dynamic_bitset(size_type, bool) and dynamic_bitset(initializer_list<bool>)
+    void test_constructor();
+    // push_back, pop_back and resize
+    void test_modifiers();
+    // set, reset and flip, including the ranges crossing the words
+    void test_set_and_reset();
+    // operator&=, operator|=, operator^= and operator~
+    void test_bitwise_operations();
+    // count, all, any, none, find_first and find_next
+    void test_query();
+    void test_iterator();
+};
+
+void dynamic_bitset_unit_test() {
+    auto correctness {new dynamic_bitset_correctness {}};
+    correctness->test_default_constructor();
+    correctness->test_constructor();
+    correctness->test_modifiers();
+    correctness->test_set_and_reset();
+    correctness->test_bitwise_operations();
+    correctness->test_query();
+    correctness->test_iterator();
+    delete correctness;
+}
+
+std::vector<bool> dynamic_bitset_correctness::generate_random_bits(int count) {
+    std::vector<bool> result {};
+    for(const auto value : this->generate_random_sequence(count)) {
+        result.push_back(value % 2 == 0);
+    }
+    return result;
+}
+void dynamic_bitset_correctness::check_same(const dynamic_bitset<> &b, const std::vector<bool> &correct) {
+    assert(b.size() == correct.size());
+    for(auto i {0uz}; i < correct.size(); ++i) {
+        assert(b[i] == correct[i]);
+    }
+    // the bits after size() should be zero
+    if(const auto used {b.size() % b.word_bits}; used not_eq 0) {
+        assert((b.data()[b.word_size() - 1] >> used) == 0);
+    }
+}
+
+void dynamic_bitset_correctness::test_default_constructor() {
+    std::cout << "Start checking default constructor for ds::dynamic_bitset!" << std::endl;
+
+    // the members which should be nothrow
+    {
+        dynamic_bitset<> b {};
+        const dynamic_bitset<> cb {};
+        static_assert(noexcept(dynamic_bitset<> {move(b)}));
+        static_assert(noexcept(b = move(b)));
+        static_assert(noexcept(b.begin()));
+        static_assert(noexcept(cb.begin()));
+        static_assert(noexcept(b.end()));
+        static_assert(noexcept(cb.end()));
+        static_assert(noexcept(b.size()));
+        static_assert(noexcept(b.empty()));
+        static_assert(noexcept(b.capacity()));
+        static_assert(noexcept(b.count()));
+        static_assert(noexcept(b.find_first()));
+        static_assert(noexcept(b.set()));
+        static_assert(noexcept(b.reset()));
+        static_assert(noexcept(b.flip()));
+        static_assert(noexcept(b &= cb));
+        static_assert(noexcept(b.swap(declval<dynamic_bitset<> &>())));
+        std::cout << "\ttest_default_constructor/Member functions nothrow checking done." << std::endl;
+    }
+
+    // empty
+    {
+        dynamic_bitset<> b {};
+        assert(b.size() == 0);
+        assert(b.empty());
+        assert(b.begin() == b.end());
+        assert(b.count() == 0);
+        assert(b.none());
+        assert(b.all());
+        assert(b.find_first() == b.npos);
+        std::cout << "\ttest_default_constructor/Empty dynamic_bitset checking done." << std::endl;
+    }
+
+    std::cout << "Checking default constructor for ds::dynamic_bitset finished!" << std::endl;
+}
+void dynamic_bitset_correctness::test_constructor() {
+    std::cout << "Start checking constructors for ds::dynamic_bitset!" << std::endl;
+
+    // dynamic_bitset(size_type, bool)
+    {
+        const auto size {this->generate_count(10000)};
+        dynamic_bitset<> zero(size);
+        check_same(zero, std::vector<bool>(size, false));
+        dynamic_bitset<> one(size, true);
+        check_same(one, std::vector<bool>(size, true));
+        assert(one.count() == static_cast<size_t>(size));
+        assert(one.all());
+        std::cout << "\ttest_constructor/dynamic_bitset(size_type, bool) checking done." << std::endl;
+    }
+
+    // dynamic_bitset(initializer_list<bool>), copy and move
+    {
+        dynamic_bitset<> b {true, false, true, true};
+        check_same(b, {true, false, true, true});
+        auto copy {b};
+        assert(copy == b);
+        auto moved {move(copy)};
+        assert(moved == b);
+        assert(copy.empty());
+        copy = moved;
+        assert(copy == b);
+        std::cout << "\ttest_constructor/dynamic_bitset(initializer_list<bool>) checking done." << std::endl;
+    }
+
+    std::cout << "Checking constructors for ds::dynamic_bitset finished!" << std::endl;
+}
+void dynamic_bitset_correctness::test_modifiers() {
+    std::cout << "Start checking push_back, pop_back and resize for ds::dynamic_bitset!" << std::endl;
+
+    {
+        const auto correct {this->generate_random_bits(this->generate_count(10000))};
+        dynamic_bitset<> b {};
+        for(const auto value : correct) {
+            b.push_back(value);
+        }
+        check_same(b, correct);
+        auto shrunk {correct};
+        while(not shrunk.empty()) {
+            assert(b.back() == shrunk.back());
+            b.pop_back();
+            shrunk.pop_back();
+            if(shrunk.size() % 97 == 0) {
+                check_same(b, shrunk);
+            }
+        }
+        assert(b.empty());
+        std::cout << "\ttest_modifiers/push_back and pop_back checking done." << std::endl;
+    }
+
+    {
+        auto correct {this->generate_random_bits(this->generate_count(1000))};
+        dynamic_bitset<> b {};
+        for(const auto value : correct) {
+            b.push_back(value);
+        }
+        for(auto i {0}; i < 20; ++i) {
+            const auto size {static_cast<size_t>(this->generate_count(2000))};
+            const auto value {this->generate_a_random_number() % 2 == 0};
+            b.resize(size, value);
+            correct.resize(size, value);
+            check_same(b, correct);
+        }
+        b.shrink_to_fit();
+        assert(b.capacity() == b.word_size() * b.word_bits);
+        check_same(b, correct);
+        std::cout << "\ttest_modifiers/resize checking done." << std::endl;
+    }
+
+    std::cout << "Checking push_back, pop_back and resize for ds::dynamic_bitset finished!" << std::endl;
+}
+void dynamic_bitset_correctness::test_set_and_reset() {
+    std::cout << "Start checking set, reset and flip for ds::dynamic_bitset!" << std::endl;
+
+    {
+        const auto size {this->generate_count(1000) + 1};
+        dynamic_bitset<> b(size);
+        std::vector<bool> correct(size);
+        for(auto i {0}; i < 200; ++i) {
+            const auto pos {this->generate_count(size - 1)};
+            const auto n {this->generate_count(size - pos)};
+            const auto value {this->generate_a_random_number() % 2 == 0};
+            b.set(pos, n, value);
+            for(auto j {pos}; j < pos + n; ++j) {
+                correct[j] = value;
+            }
+            check_same(b, correct);
+            const auto single {this->generate_count(size - 1)};
+            b.flip(single);
+            correct[single] = not correct[single];
+            check_same(b, correct);
+        }
+        b.flip();
+        correct.flip();
+        check_same(b, correct);
+        b.reset(0, static_cast<size_t>(size));
+        assert(b.none());
+        b.set();
+        assert(b.all());
+        b.reset();
+        assert(b.none());
+        std::cout << "\ttest_set_and_reset/Random range checking done." << std::endl;
+    }
+
+    std::cout << "Checking set, reset and flip for ds::dynamic_bitset finished!" << std::endl;
+}
+void dynamic_bitset_correctness::test_bitwise_operations() {
+    std::cout << "Start checking bitwise operations for ds::dynamic_bitset!" << std::endl;
+
+    {
+        const auto size {this->generate_count(10000)};
+        const auto lhs_bits {this->generate_random_bits(size)};
+        const auto rhs_bits {this->generate_random_bits(size)};
+        dynamic_bitset<> lhs {}, rhs {};
+        for(auto i {0}; i < size; ++i) {
+            lhs.push_back(lhs_bits[i]);
+            rhs.push_back(rhs_bits[i]);
+        }
+        const auto and_result {lhs & rhs};
+        const auto or_result {lhs | rhs};
+        const auto xor_result {lhs ^ rhs};
+        const auto not_result {~lhs};
+        for(auto i {0}; i < size; ++i) {
+            assert(and_result[i] == (lhs_bits[i] and rhs_bits[i]));
+            assert(or_result[i] == (lhs_bits[i] or rhs_bits[i]));
+            assert(xor_result[i] == (lhs_bits[i] not_eq rhs_bits[i]));
+            assert(not_result[i] == not lhs_bits[i]);
+        }
+        assert((not_result ^ lhs).all());
+        assert((not_result & lhs).none());
+        assert(lhs == lhs);
+        std::cout << "\ttest_bitwise_operations/Random bits checking done." << std::endl;
+    }
+
+    std::cout << "Checking bitwise operations for ds::dynamic_bitset finished!" << std::endl;
+}
+void dynamic_bitset_correctness::test_query() {
+    std::cout << "Start checking count and find for ds::dynamic_bitset!" << std::endl;
+
+    {
+        const auto correct {this->generate_random_bits(this->generate_count(10000))};
+        dynamic_bitset<> b {};
+        auto count {0uz};
+        for(const auto value : correct) {
+            b.push_back(value);
+            count += value;
+        }
+        assert(b.count() == count);
+        assert(b.any() == (count not_eq 0));
+        assert(b.all() == (count == correct.size()));
+        std::vector<size_t> positions {};
+        for(auto i {b.find_first()}; i not_eq b.npos; i = b.find_next(i)) {
+            positions.push_back(i);
+        }
+        assert(positions.size() == count);
+        auto it {positions.cbegin()};
+        for(auto i {0uz}; i < correct.size(); ++i) {
+            if(correct[i]) {
+                assert(*it++ == i);
+            }
+        }
+        std::cout << "\ttest_query/Random bits checking done." << std::endl;
+    }
+
+    // sparse bits
+    {
+        dynamic_bitset<> b(1000);
+        b.set(3).set(64).set(127).set(128).set(999);
+        assert(b.find_first() == 3);
+        assert(b.find_next(3) == 64);
+        assert(b.find_next(64) == 127);
+        assert(b.find_next(127) == 128);
+        assert(b.find_next(128) == 999);
+        assert(b.find_next(999) == b.npos);
+        assert(b.count() == 5);
+        std::cout << "\ttest_query/Sparse bits checking done." << std::endl;
+    }
+
+    std::cout << "Checking count and find for ds::dynamic_bitset finished!" << std::endl;
+}
+void dynamic_bitset_correctness::test_iterator() {
+    std::cout << "Start checking iterator for ds::dynamic_bitset!" << std::endl;
+
+    static_assert(is_random_access_iterator_v<dynamic_bitset<>::iterator>);
+    static_assert(is_random_access_iterator_v<dynamic_bitset<>::const_iterator>);
+    static_assert(is_random_access_iterator_v<dynamic_bitset<>::reverse_iterator>);
+    {
+        const auto correct {this->generate_random_bits(this->generate_count(1000) + 1)};
+        dynamic_bitset<> b(correct.size());
+        auto i {0uz};
+        for(auto it {b.begin()}; it not_eq b.end(); ++it) {
+            *it = correct[i++];
+        }
+        check_same(b, correct);
+        assert(b.end() - b.begin() == static_cast<ptrdiff_t>(correct.size()));
+        assert(b.cend() - b.cbegin() == static_cast<ptrdiff_t>(correct.size()));
+        dynamic_bitset<>::const_iterator cit {b.begin()};
+        for(i = 0; i < correct.size(); i += 7) {
+            assert((b.begin() + static_cast<ptrdiff_t>(i) == b.cbegin() + static_cast<ptrdiff_t>(i)));
+            assert(cit[static_cast<ptrdiff_t>(i)] == correct[i]);
+            assert(*(b.end() - static_cast<ptrdiff_t>(correct.size() - i)) == correct[i]);
+        }
+        i = correct.size();
+        for(auto it {b.crbegin()}; it not_eq b.crend(); ++it) {
+            assert(*it == correct[--i]);
+        }
+        assert(i == 0);
+        auto first {b.begin()};
+        const bool front {*first};
+        const bool back {b.back()};
+        swap(*first, *(b.end() - 1));
+        assert(b.front() == back and b.back() == front);
+        std::cout << "\ttest_iterator/Random bits checking done." << std::endl;
+    }
+
+    std::cout << "Checking iterator for ds::dynamic_bitset finished!" << std::endl;
+}
@@ -0,0 +1,294 @@
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+#include "unit_test.hpp"
+#include "../source/execution.hpp"
+#include "../source/vector.hpp"
+#include "../source/array.hpp"
+#include "../source/deque.hpp"
+
+using namespace ds;
+class execution_correctness : public unit_test_correctness {
+private:
+    // the pools of 1, 2 and 4 participants, the grain is small so the short ranges are split as well
+    static constexpr size_t concurrencies[] {1, 2, 4};
+    static constexpr size_t grain {64};
+private:
+    // the elements are pushed at both ends, so the first block is partial
+    deque<int> generate_deque(const std::vector<int> &);
+public:
+    ~execution_correctness() noexcept override = default;
+public:
+    void test_thread_pool();
+    void test_for_each_and_transform();
+    void test_reduce();
+    void test_fill_and_copy();
+    void test_sort();
+};
+
+void execution_unit_test() {
+    auto correctness {new execution_correctness {}};
+    correctness->test_thread_pool();
+    correctness->test_for_each_and_transform();
+    correctness->test_reduce();
+    correctness->test_fill_and_copy();
+    correctness->test_sort();
+    delete correctness;
+}
+
+deque<int> execution_correctness::generate_deque(const std::vector<int> &values) {
+    deque<int> d {};
+    for(auto i {0uz}; i < values.size(); ++i) {
+        if(i % 3 == 0) {
+            d.push_front(values[i]);
+        }else {
+            d.push_back(values[i]);
+        }
+    }
+    return d;
+}
+
+void execution_correctness::test_thread_pool() {
+    std::cout << "Start checking thread_pool!" << std::endl;
+
+    for(const auto concurrency : concurrencies) {
+        thread_pool pool {concurrency};
+        assert(pool.concurrency() == concurrency);
+        for(auto i {0}; i < 20; ++i) {
+            const auto chunks {static_cast<size_t>(this->generate_count(1000))};
+            std::vector<atomic<int>> visited(chunks);
+            pool.run(chunks, [&](size_t chunk) {
+                visited[chunk].fetch_add(1, memory_order_relaxed);
+            });
+            for(const auto &count : visited) {
+                assert(count.load() == 1);
+            }
+        }
+    }
+    std::cout << "\ttest_thread_pool/Every chunk once checking done." << std::endl;
+
+    {
+        thread_pool pool {4};
+        atomic<int> sum {0};
+        pool.run(16, [&](size_t) {
+            // the nested calls are executed by the calling participant
+            pool.run(8, [&](size_t chunk) {
+                sum.fetch_add(static_cast<int>(chunk), memory_order_relaxed);
+            });
+        });
+        assert(sum.load() == 16 * 28);
+        std::cout << "\ttest_thread_pool/Nested run checking done." << std::endl;
+    }
+
+    {
+        thread_pool pool {4};
+        auto thrown {false};
+        try {
+            pool.run(100, [](size_t chunk) {
+                if(chunk == 42) {
+                    throw std::runtime_error {"chunk 42"};
+                }
+            });
+        }catch(const std::runtime_error &) {
+            thrown = true;
+        }
+        assert(thrown);
+        // the pool is still usable after an exception
+        atomic<int> count {0};
+        pool.run(100, [&](size_t) {
+            count.fetch_add(1, memory_order_relaxed);
+        });
+        assert(count.load() == 100);
+        std::cout << "\ttest_thread_pool/Exception checking done." << std::endl;
+    }
+
+    std::cout << "Checking thread_pool finished!" << std::endl;
+}
+void execution_correctness::test_for_each_and_transform() {
+    std::cout << "Start checking parallel for_each and transform!" << std::endl;
+
+    for(const auto concurrency : concurrencies) {
+        thread_pool pool {concurrency};
+        const auto policy {execution::par.on(pool).with_grain(grain)};
+        for(auto i {0}; i < 10; ++i) {
+            const auto values {this->generate_random_sequence(this->generate_count(20000))};
+            {
+                vector<int> v(values.cbegin().operator->(), values.cbegin().operator->() + values.size());
+                ds::for_each(policy, v, [](int &value) noexcept {
+                    value /= 2;
+                });
+                for(auto j {0uz}; j < values.size(); ++j) {
+                    assert(v[j] == values[j] / 2);
+                }
+                vector<long long> result(v.size());
+                assert(ds::transform(policy, v, result.begin(), [](int value) noexcept {
+                    return static_cast<long long>(value) + 1;
+                }) == result.end());
+                for(auto j {0uz}; j < values.size(); ++j) {
+                    assert(result[j] == static_cast<long long>(values[j] / 2) + 1);
+                }
+            }
+            {
+                auto d {this->generate_deque(values)};
+                std::vector<int> correct {};
+                for(const auto value : d) {
+                    correct.push_back(value);
+                }
+                // the blocks of deque are not shared by the participants
+                std::vector<int> owners(d.size());
+                atomic<int> next_owner {0};
+                const auto begin {d.begin()};
+                __dsi::parallel_chunks(policy, begin, d.size(), [&](size_t, size_t from, size_t to) {
+                    const auto owner {next_owner.fetch_add(1, memory_order_relaxed)};
+                    for(auto j {from}; j < to; ++j) {
+                        owners[j] = owner;
+                    }
+                });
+                using traits = __dsa::segmented_iterator_traits<deque<int>::iterator>;
+                for(auto j {1uz}; j < d.size(); ++j) {
+                    if(owners[j] not_eq owners[j - 1]) {
+                        const auto it {begin + static_cast<ptrdiff_t>(j)};
+                        assert(traits::local(it) == traits::begin(traits::segment(it)));
+                    }
+                }
+                ds::for_each(policy, d, [](int &value) noexcept {
+                    ++value;
+                });
+                auto it {correct.cbegin()};
+                for(const auto value : d) {
+                    assert(value == *it++ + 1);
+                }
+                deque<int> result(d.size(), 0);
+                ds::transform(policy, d.begin(), d.end(), result.begin(), [](int value) noexcept {
+                    return -value;
+                });
+                for(auto j {0uz}; j < d.size(); ++j) {
+                    assert(result[j] == -d[j]);
+                }
+            }
+        }
+    }
+    std::cout << "\ttest_for_each_and_transform/ds::vector and ds::deque checking done." << std::endl;
+
+    {
+        array<int, 10000> a {};
+        ds::for_each(execution::par.with_grain(grain), a, [](int &value) noexcept {
+            value = 7;
+        });
+        assert(std::all_of(a.begin(), a.end(), [](int value) noexcept {
+            return value == 7;
+        }));
+        std::cout << "\ttest_for_each_and_transform/ds::array checking done." << std::endl;
+    }
+
+    std::cout << "Checking parallel for_each and transform finished!" << std::endl;
+}
+void execution_correctness::test_reduce() {
+    std::cout << "Start checking parallel reduce!" << std::endl;
+
+    for(const auto concurrency : concurrencies) {
+        thread_pool pool {concurrency};
+        const auto policy {execution::par.on(pool).with_grain(grain)};
+        for(auto i {0}; i < 10; ++i) {
+            const auto values {this->generate_random_sequence(this->generate_count(20000))};
+            long long correct {0};
+            for(const auto value : values) {
+                correct += value;
+            }
+            const vector<int> v(values.cbegin().operator->(), values.cbegin().operator->() + values.size());
+            assert(ds::reduce(policy, v, 0ll) == correct);
+            const auto d {this->generate_deque(values)};
+            assert(ds::reduce(policy, d.begin(), d.end(), 0ll) == correct);
+            // the operation is not commutative, the partial results are combined in order
+            vector<std::string> strings {};
+            for(auto j {0}; j < 500; ++j) {
+                strings.push_back(std::to_string(j % 10));
+            }
+            std::string concatenation {};
+            for(const auto &string : strings) {
+                concatenation += string;
+            }
+            assert(ds::reduce(policy.with_grain(16), strings, std::string {">"}) == ">" + concatenation);
+        }
+        assert(ds::reduce(policy, vector<int> {}, 42) == 42);
+    }
+    std::cout << "\ttest_reduce/ds::vector and ds::deque checking done." << std::endl;
+
+    std::cout << "Checking parallel reduce finished!" << std::endl;
+}
+void execution_correctness::test_fill_and_copy() {
+    std::cout << "Start checking parallel fill and copy!" << std::endl;
+
+    for(const auto concurrency : concurrencies) {
+        thread_pool pool {concurrency};
+        const auto policy {execution::par.on(pool).with_grain(grain)};
+        for(auto i {0}; i < 10; ++i) {
+            const auto values {this->generate_random_sequence(this->generate_count(20000))};
+            auto d {this->generate_deque(values)};
+            vector<int> v(d.size());
+            assert(ds::copy(policy, d, v.begin()) == v.end());
+            for(auto j {0uz}; j < d.size(); ++j) {
+                assert(v[j] == d[j]);
+            }
+            const auto from {static_cast<ptrdiff_t>(this->generate_count(static_cast<int>(d.size())))};
+            ds::fill(policy, d.begin() + from, d.end(), -1);
+            for(auto j {0uz}; j < d.size(); ++j) {
+                assert(d[j] == (static_cast<ptrdiff_t>(j) < from ? v[j] : -1));
+            }
+            ds::copy(policy, v.begin(), v.end(), d.begin());
+            for(auto j {0uz}; j < d.size(); ++j) {
+                assert(v[j] == d[j]);
+            }
+            ds::fill(policy, v, 3);
+            for(const auto value : v) {
+                assert(value == 3);
+            }
+        }
+    }
+    std::cout << "\ttest_fill_and_copy/ds::vector and ds::deque checking done." << std::endl;
+
+    std::cout << "Checking parallel fill and copy finished!" << std::endl;
+}
+void execution_correctness::test_sort() {
+    std::cout << "Start checking parallel sort!" << std::endl;
+
+    for(const auto concurrency : concurrencies) {
+        thread_pool pool {concurrency};
+        const auto policy {execution::par.on(pool).with_grain(grain)};
+        for(auto i {0}; i < 10; ++i) {
+            const auto values {this->generate_random_sequence(this->generate_count(20000))};
+            auto correct {values};
+            std::sort(correct.begin(), correct.end());
+            vector<int> v(values.cbegin().operator->(), values.cbegin().operator->() + values.size());
+            ds::sort(policy, v);
+            for(auto j {0uz}; j < correct.size(); ++j) {
+                assert(v[j] == correct[j]);
+            }
+            auto d {this->generate_deque(values)};
+            ds::sort(policy, d.begin(), d.end(), greater<> {});
+            for(auto j {0uz}; j < correct.size(); ++j) {
+                assert(d[j] == correct[correct.size() - 1 - j]);
+            }
+        }
+    }
+    std::cout << "\ttest_sort/ds::vector and ds::deque checking done." << std::endl;
+
+    {
+        thread_pool pool {4};
+        vector<std::string> strings {};
+        std::vector<std::string> correct {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(5000))) {
+            strings.push_back(std::to_string(value));
+            correct.push_back(std::to_string(value));
+        }
+        ds::sort(execution::par.on(pool).with_grain(grain), strings);
+        std::sort(correct.begin(), correct.end());
+        for(auto j {0uz}; j < correct.size(); ++j) {
+            assert(strings[j] == correct[j]);
+        }
+        std::cout << "\ttest_sort/std::string checking done." << std::endl;
+    }
+
+    std::cout << "Checking parallel sort finished!" << std::endl;
+}
@@ -0,0 +1,202 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include "unit_test.hpp"
+#include "../source/forward_list.hpp"
+#include "../source/concurrent_allocator.hpp"
+#include "../source/vector.hpp"
+
+using namespace ds;
+class forward_list_extension_correctness : public unit_test_correctness {
+public:
+    ~forward_list_extension_correctness() noexcept override = default;
+public:
+    void test_concurrent_node_allocator();
+    void test_node_allocator_trim();
+    void test_append_range();
+};
+
+void forward_list_extension_unit_test() {
+    auto correctness {new forward_list_extension_correctness {}};
+    correctness->test_concurrent_node_allocator();
+    correctness->test_node_allocator_trim();
+    correctness->test_append_range();
+    delete correctness;
+}
+
+void forward_list_extension_correctness::test_concurrent_node_allocator() {
+    std::cout << "Start checking concurrent node allocator for ds::forward_list!" << std::endl;
+
+    using node_allocator = __dsa::concurrent_forward_list_node_allocator<std::string, __dsa::forward_list_node,
+            allocator<std::string>, allocator<__dsa::forward_list_node<std::string>>, 16>;
+    using concurrent_forward_list = forward_list<std::string, allocator<std::string>, node_allocator>;
+    // the shared free list is a single pointer, which never takes the lock of libatomic
+    static_assert(sizeof(node_allocator::free_list_type) == sizeof(void *));
+    static_assert(node_allocator::free_list_type::is_always_lock_free);
+
+    // the lists constructed by the same node allocator share one node pool
+    {
+        concurrent_forward_list f {};
+        concurrent_forward_list g(f.node_allocator());
+        assert(f.node_allocator() == g.node_allocator());
+        assert(not (f.node_allocator() == concurrent_forward_list {}.node_allocator()));
+        f.insert_after(f.before_begin(), {"a", "b", "c"});
+        g.insert_after(g.before_begin(), "d", 3);
+        f.clear();
+        g.pop_front();
+        assert(g.size() == 2 and g.front() == "d");
+        std::cout << "\tChecking test_concurrent_node_allocator/Sharing done." << std::endl;
+    }
+
+    // the surplus of a magazine is returned to the shared free list, and the other copies take it from there
+    {
+        using counted_node_allocator = __dsa::concurrent_forward_list_node_allocator<std::string,
+                __dsa::forward_list_node, allocator<std::string>,
+                instrumented_allocator<__dsa::forward_list_node<std::string>>, 16>;
+        using counted_forward_list = forward_list<std::string, allocator<std::string>, counted_node_allocator>;
+        auto &statistics {instrumented_allocator<int>::statistics()};
+        statistics.reset();
+        {
+            counted_forward_list f {};
+            f.insert_after(f.before_begin(), "a", 100);
+            assert(statistics.allocate_calls() == 1);
+            f.clear();
+            assert(f.node_size.allocator().magazine.size == 16);
+            counted_forward_list g(f.node_allocator());
+            g.insert_after(g.before_begin(), "b", 50);
+            assert(g.size() == 50 and g.node_size.allocator().magazine.size == 84 - 50);
+            f.insert_after(f.before_begin(), "c", 16);
+            assert(statistics.allocate_calls() == 1 and f.node_size.allocator().magazine.size == 0);
+        }
+        assert(statistics.allocate_calls() == statistics.deallocate_calls() and statistics.live_bytes() == 0);
+        std::cout << "\tChecking test_concurrent_node_allocator/Batching done." << std::endl;
+    }
+
+    // producers and consumers recycle the nodes through the shared free list
+    {
+        concurrent_forward_list seed {};
+        const auto pool {seed.node_allocator()};
+        std::thread threads[4];
+        for(auto i {0}; i < 4; ++i) {
+            threads[i] = std::thread([this, pool, i]() {
+                concurrent_forward_list f(pool);
+                for(auto round {0}; round < 100; ++round) {
+                    const auto count {this->generate_count(200)};
+                    for(auto j {0}; j < count; ++j) {
+                        f.emplace_front(std::to_string(i * j) + "_a_string_which_is_not_small");
+                    }
+                    assert(f.size() == count);
+                    while(not f.empty()) {
+                        f.pop_front();
+                    }
+                }
+            });
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        std::cout << "\tChecking test_concurrent_node_allocator/Multi-threading done." << std::endl;
+    }
+
+    std::cout << "Checking concurrent node allocator for ds::forward_list finished!" << std::endl;
+}
+void forward_list_extension_correctness::test_node_allocator_trim() {
+    std::cout << "Start checking chunk growth policy and trim() of node allocator for ds::forward_list!" << std::endl;
+
+    static_assert(fixed_chunk_policy<8>::next_chunk_size(0, 3) == 8);
+    static_assert(fixed_chunk_policy<8>::next_chunk_size(8, 30) == 30);
+    static_assert(geometric_chunk_policy<4>::next_chunk_size(0, 1) == 4);
+    static_assert(geometric_chunk_policy<4>::next_chunk_size(4, 1) == 8);
+    static_assert(capped_chunk_policy<4, 8>::next_chunk_size(8, 1) == 8);
+    static_assert(capped_chunk_policy<4, 8>::next_chunk_size(8, 100) == 100);
+    std::cout << "\tChecking test_node_allocator_trim/Chunk growth policy done." << std::endl;
+
+    using node_allocator = __dsa::forward_list_node_allocator<std::string, __dsa::forward_list_node,
+            allocator<std::string>, allocator<__dsa::forward_list_node<std::string>>, capped_chunk_policy<4, 64>>;
+    using pooled_forward_list = forward_list<std::string, allocator<std::string>, node_allocator>;
+
+    // the chunks which are partially in use are kept after trim()
+    {
+        pooled_forward_list f {};
+        auto pool {f.node_allocator()};
+        pooled_forward_list g(pool);
+        const auto count {this->generate_count(1000)};
+        for(auto i {0}; i < count; ++i) {
+            f.emplace_front(std::to_string(i) + "_a_string_which_is_not_small");
+        }
+        g.insert_after(g.before_begin(), "keep", 3);
+        f.clear();
+        static_cast<void>(pool.trim());
+        assert(g.size() == 3);
+        for(const auto &s : g) {
+            assert(s == "keep");
+        }
+        f.insert_after(f.before_begin(), "a", 200);
+        assert(f.size() == 200 and f.front() == "a");
+        std::cout << "\tChecking test_node_allocator_trim/Partially used chunks done." << std::endl;
+    }
+
+    // all the nodes are released after clearing all the lists
+    {
+        pooled_forward_list f {};
+        const auto count {this->generate_count(1000)};
+        for(auto i {0}; i < count; ++i) {
+            f.emplace_front(std::to_string(i) + "_a_string_which_is_not_small");
+        }
+        f.clear();
+        assert(f.node_allocator().trim() >= static_cast<size_t>(count));
+        assert(f.node_allocator().trim() == 0);
+        f.emplace_front("again");
+        assert(f.size() == 1 and f.front() == "again");
+        std::cout << "\tChecking test_node_allocator_trim/Fully free chunks done." << std::endl;
+    }
+
+    std::cout << "Checking chunk growth policy and trim() of node allocator for ds::forward_list finished!" << std::endl;
+}
+
+void forward_list_extension_correctness::test_append_range() {
+    std::cout << "Start checking append_range for ds::forward_list!" << std::endl;
+
+    const auto count {this->generate_count(1000)};
+    {
+        vector<int> source {};
+        for(auto i {0}; i < count; ++i) {
+            source.emplace_back(i);
+        }
+        forward_list<int> f {};
+        f.append_range(source);
+        f.append_range(source);
+        assert(f.size() == 2 * static_cast<size_t>(count));
+        auto i {0};
+        for(auto value : f) {
+            assert(value == i++ % count);
+        }
+        std::cout << "\tChecking test_append_range/Forward range done." << std::endl;
+    }
+    {
+        std::stringstream stream {};
+        for(auto i {0}; i < count; ++i) {
+            stream << "string_" << i << ' ';
+        }
+        struct input_range {
+            std::stringstream &stream;
+            std_string_input_iterator begin() {
+                return std_string_input_iterator {this->stream};
+            }
+            std_string_input_iterator end() {
+                return std_string_input_iterator {};
+            }
+        };
+        forward_list<std::string> f {"front"};
+        f.append_range(input_range {stream});
+        assert(f.size() == static_cast<size_t>(count) + 1);
+        auto it {f.cbegin()};
+        assert(*it++ == "front");
+        for(auto i {0}; i < count; ++i) {
+            assert(*it++ == "string_" + std::to_string(i));
+        }
+        std::cout << "\tChecking test_append_range/Input range done." << std::endl;
+    }
+
+    std::cout << "Checking append_range for ds::forward_list finished!" << std::endl;
+}
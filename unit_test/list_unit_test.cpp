@@ -0,0 +1,242 @@
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+#include "unit_test.hpp"
+#include "../source/list.hpp"
+#include "../source/vector.hpp"
+
+using namespace ds;
+class list_correctness : public unit_test_correctness {
+private:
+    // the input range which can be traversed only once
+    struct input_range {
+        std::stringstream &stream;
+        std_string_input_iterator begin() {
+            return std_string_input_iterator {this->stream};
+        }
+        std_string_input_iterator end() {
+            return std_string_input_iterator {};
+        }
+    };
+private:
+    // insert and erase at the front, the middle, the back or a random position, the result is compared with std::list
+    template <typename T>
+    void check_insert_and_erase(int);
+public:
+    ~list_correctness() noexcept override = default;
+public:
+    void test_append_range();
+    void test_insert_and_erase();
+};
+
+void list_unit_test() {
+    auto correctness {new list_correctness {}};
+    correctness->test_append_range();
+    correctness->test_insert_and_erase();
+    delete correctness;
+}
+
+void list_correctness::test_append_range() {
+    std::cout << "Start checking append_range for ds::list!" << std::endl;
+
+    const auto count {this->generate_count(1000)};
+    {
+        vector<int> source {};
+        for(auto i {0}; i < count; ++i) {
+            source.emplace_back(i);
+        }
+        list<int> l {};
+        l.append_range(source);
+        l.append_range(source);
+        l.append_range(vector<int> {});
+        assert(l.size() == 2 * static_cast<size_t>(count));
+        auto i {0};
+        for(auto value : l) {
+            assert(value == i++ % count);
+        }
+        i = 2 * count;
+        for(auto it {l.crbegin()}; it not_eq l.crend(); ++it) {
+            assert(*it == --i % count);
+        }
+        std::cout << "\ttest_append_range/Sized range checking done." << std::endl;
+    }
+    {
+        std::stringstream stream {};
+        for(auto i {0}; i < count; ++i) {
+            stream << "string_" << i << ' ';
+        }
+        list<std::string> l {"front"};
+        l.append_range(input_range {stream});
+        assert(l.size() == static_cast<size_t>(count) + 1);
+        auto it {l.cbegin()};
+        assert(*it++ == "front");
+        for(auto i {0}; i < count; ++i) {
+            assert(*it++ == "string_" + std::to_string(i));
+        }
+        assert(it == l.cend());
+        std::cout << "\ttest_append_range/Input range checking done." << std::endl;
+    }
+    {
+        // the input range is buffered by the allocator of the list, which has no default constructor
+        monotonic_arena arena {};
+        std::stringstream stream {};
+        for(auto i {0}; i < count; ++i) {
+            stream << i << ' ';
+        }
+        list<std::string, arena_allocator<std::string>> l {arena_allocator<std::string> {arena}};
+        l.append_range(input_range {stream});
+        assert(l.size() == static_cast<size_t>(count));
+        auto i {0};
+        for(const auto &value : l) {
+            assert(value == std::to_string(i++));
+        }
+        std::cout << "\ttest_append_range/Input range with an arena checking done." << std::endl;
+    }
+    {
+        // the pool takes the nodes of a sized range in one batch and reuses them afterwards
+        auto &statistics {instrumented_allocator<int>::statistics()};
+        // the range is never empty, so the first append_range allocates
+        const auto size {count + 1};
+        vector<int> source {};
+        for(auto i {0}; i < size; ++i) {
+            source.emplace_back(i);
+        }
+        statistics.reset();
+        {
+            list<int, instrumented_allocator<int>> l {};
+            l.append_range(source);
+            assert(statistics.allocate_calls() == 1);
+            l.clear();
+            l.append_range(source);
+            assert(statistics.allocate_calls() == 1 and l.size() == static_cast<size_t>(size));
+            auto i {size};
+            for(auto it {l.crbegin()}; it not_eq l.crend(); ++it) {
+                assert(*it == --i);
+            }
+            list<int, instrumented_allocator<int>> moved {ds::move(l)};
+            l.append_range(source);
+            assert(moved.size() == l.size() and statistics.allocate_calls() == 2);
+        }
+        assert(statistics.allocate_calls() == statistics.deallocate_calls() and statistics.live_bytes() == 0);
+        statistics.reset();
+        {
+            list<int, instrumented_allocator<int>, void> l {};
+            l.append_range(source);
+            assert(statistics.allocate_calls() == static_cast<size_t>(size));
+        }
+        assert(statistics.deallocate_calls() == static_cast<size_t>(size));
+        std::cout << "\ttest_append_range/Batched nodes checking done." << std::endl;
+    }
+
+    std::cout << "Checking append_range for ds::list finished!" << std::endl;
+}
+template <typename T>
+void list_correctness::check_insert_and_erase(int count) {
+    const auto make_value {[](int value) {
+        if constexpr(is_same_v<T, std::string>) {
+            return "string_" + std::to_string(value);
+        }else {
+            return value;
+        }
+    }};
+    list<T> l {};
+    std::list<T> correct {};
+    const auto operations {this->generate_random_sequence(0, 8, count)};
+    const auto numbers {this->generate_random_sequence(0, std::numeric_limits<int>::max(), count)};
+    for(auto i {0}; i < count; ++i) {
+        const auto size {correct.size()};
+        // the front, the middle, the back or a random position
+        const auto random {static_cast<size_t>(numbers[i])};
+        const size_t positions[] {0, size / 2, size, size == 0 ? 0 : random % (size + 1)};
+        auto position {positions[random % 4]};
+        const auto n {random / 4 % 6};
+        const auto value {make_value(numbers[i])};
+        const auto at {[&](size_t index) {
+            return ds::advance(l.cbegin(), static_cast<ptrdiff_t>(index));
+        }};
+        const auto correct_at {[&](size_t index) {
+            return std::next(correct.cbegin(), static_cast<ptrdiff_t>(index));
+        }};
+        const auto check_result {[&](auto result) {
+            assert(ds::distance(l.begin(), result) == static_cast<ptrdiff_t>(position));
+        }};
+        switch(operations[i]) {
+            case 0:
+                check_result(l.insert(at(position), value));
+                correct.insert(correct_at(position), value);
+                break;
+            case 1:
+                check_result(l.insert(position, value, n));
+                correct.insert(correct_at(position), n, value);
+                break;
+            case 2:
+                check_result(l.emplace(at(position), value));
+                correct.emplace(correct_at(position), value);
+                break;
+            case 3: {
+                auto moved {value};
+                check_result(l.insert(position, ds::move(moved)));
+                correct.insert(correct_at(position), value);
+                break;
+            }
+            case 4: {
+                std::vector<T> range {};
+                for(auto j {0uz}; j < n; ++j) {
+                    range.push_back(make_value(numbers[i] + static_cast<int>(j)));
+                }
+                const auto first {range.data()};
+                check_result(l.insert(at(position), first, first + range.size()));
+                correct.insert(correct_at(position), range.cbegin(), range.cend());
+                break;
+            }
+            case 5:
+                check_result(l.insert(position, {value, make_value(-numbers[i])}));
+                correct.insert(correct_at(position), {value, make_value(-numbers[i])});
+                break;
+            case 6:
+                if(size not_eq 0) {
+                    position = position == size ? size - 1 : position;
+                    check_result(l.erase(at(position)));
+                    correct.erase(correct_at(position));
+                }
+                break;
+            case 7: {
+                const auto erased {n < size - position ? n : size - position};
+                check_result(l.erase(position, erased));
+                correct.erase(correct_at(position), correct_at(position + erased));
+                break;
+            }
+            default: {
+                const auto erased {n < size - position ? n : size - position};
+                check_result(l.erase(at(position), at(position + erased)));
+                correct.erase(correct_at(position), correct_at(position + erased));
+                break;
+            }
+        }
+        assert(l.size() == correct.size());
+    }
+    auto it {correct.cbegin()};
+    for(const auto &value : l) {
+        assert(value == *it++);
+    }
+    auto reverse {correct.crbegin()};
+    for(auto rit {l.crbegin()}; rit not_eq l.crend(); ++rit) {
+        assert(*rit == *reverse++);
+    }
+    assert(reverse == correct.crend());
+}
+void list_correctness::test_insert_and_erase() {
+    std::cout << "Start checking insert and erase of ds::list!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        this->check_insert_and_erase<int>(this->generate_count(3000));
+    }
+    std::cout << "\ttest_insert_and_erase/int checking done." << std::endl;
+    for(auto i {0}; i < 10; ++i) {
+        this->check_insert_and_erase<std::string>(this->generate_count(3000));
+    }
+    std::cout << "\ttest_insert_and_erase/std::string checking done." << std::endl;
+
+    std::cout << "Checking insert and erase of ds::list finished!" << std::endl;
+}
@@ -0,0 +1,320 @@
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include "unit_test.hpp"
+#include "../source/sort.hpp"
+#include "../source/vector.hpp"
+#include "../source/deque.hpp"
+
+using namespace ds;
+class sort_correctness : public unit_test_correctness {
+private:
+    // random values, sorted, reversed, all equal, organ pipe and few unique values
+    std::vector<std::vector<int>> generate_patterns(int);
+    template <typename T, typename Compare = less<>>
+    static void check_sort(std::vector<T>, Compare = {});
+    template <typename T>
+    void check_radix_sort(int);
+public:
+    ~sort_correctness() noexcept override = default;
+public:
+    void test_sort();
+    void test_sort_with_compare();
+    void test_heap_sort();
+    void test_radix_sort();
+    void test_radix_sort_floating_point();
+    // the segmented sort of deque
+    void test_deque_sort();
+};
+
+void sort_unit_test() {
+    auto correctness {new sort_correctness {}};
+    correctness->test_sort();
+    correctness->test_sort_with_compare();
+    correctness->test_heap_sort();
+    correctness->test_radix_sort();
+    correctness->test_radix_sort_floating_point();
+    correctness->test_deque_sort();
+    delete correctness;
+}
+
+std::vector<std::vector<int>> sort_correctness::generate_patterns(int count) {
+    std::vector<std::vector<int>> result {};
+    result.push_back(this->generate_random_sequence(count));
+    auto sorted {result.back()};
+    std::sort(sorted.begin(), sorted.end());
+    result.push_back(sorted);
+    result.emplace_back(sorted.rbegin(), sorted.rend());
+    result.emplace_back(count, 42);
+    std::vector<int> organ_pipe {};
+    for(auto i {0}; i < count; ++i) {
+        organ_pipe.push_back(i < count / 2 ? i : count - i);
+    }
+    result.push_back(organ_pipe);
+    result.push_back(this->generate_random_sequence(0, 3, count));
+    return result;
+}
+template <typename T, typename Compare>
+void sort_correctness::check_sort(std::vector<T> v, Compare compare) {
+    auto correct {v};
+    std::sort(correct.begin(), correct.end(), compare);
+    ds::sort(v.data(), v.data() + v.size(), compare);
+    assert(v == correct);
+}
+template <typename T>
+void sort_correctness::check_radix_sort(int count) {
+    std::vector<T> v {};
+    for(const auto value : this->generate_random_sequence(count)) {
+        // the random numbers are spread to every byte of T
+        v.push_back(static_cast<T>(static_cast<unsigned long long>(value) * 0x9E3779B97F4A7C15ull));
+    }
+    auto correct {v};
+    std::sort(correct.begin(), correct.end());
+    radix_sort(v.data(), v.data() + v.size());
+    assert(v == correct);
+}
+
+void sort_correctness::test_sort() {
+    std::cout << "Start checking sort!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        for(const auto &pattern : this->generate_patterns(this->generate_count(10000))) {
+            check_sort(pattern);
+        }
+    }
+    std::cout << "\ttest_sort/Patterns of int checking done." << std::endl;
+
+    for(auto size {0}; size < 100; ++size) {
+        check_sort(this->generate_random_sequence(size));
+    }
+    std::cout << "\ttest_sort/Short ranges checking done." << std::endl;
+
+    {
+        std::vector<std::string> strings {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(1000))) {
+            strings.push_back(std::to_string(value));
+        }
+        check_sort(strings);
+        std::cout << "\ttest_sort/std::string checking done." << std::endl;
+    }
+
+    {
+        vector<int> v {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(1000))) {
+            v.push_back(value);
+        }
+        ds::sort(v.begin(), v.end());
+        assert(std::is_sorted(v.data(), v.data() + v.size()));
+        std::cout << "\ttest_sort/ds::vector checking done." << std::endl;
+    }
+
+    // constant evaluation
+    {
+        constexpr auto sorted {[] {
+            int numbers[] {5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+            ds::sort(numbers, numbers + 10);
+            for(auto i {0}; i < 10; ++i) {
+                if(numbers[i] not_eq i) {
+                    return false;
+                }
+            }
+            return true;
+        }()};
+        static_assert(sorted);
+        std::cout << "\ttest_sort/Constant evaluation checking done." << std::endl;
+    }
+
+    std::cout << "Checking sort finished!" << std::endl;
+}
+void sort_correctness::test_sort_with_compare() {
+    std::cout << "Start checking sort with comparator!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        for(const auto &pattern : this->generate_patterns(this->generate_count(10000))) {
+            check_sort(pattern, greater<> {});
+            // the comparator is not arithmetic, so the partition has branches
+            check_sort(pattern, [](int lhs, int rhs) noexcept {
+                return lhs % 1000 < rhs % 1000 or (lhs % 1000 == rhs % 1000 and lhs < rhs);
+            });
+        }
+    }
+    std::cout << "\ttest_sort_with_compare/Patterns of int checking done." << std::endl;
+
+    std::cout << "Checking sort with comparator finished!" << std::endl;
+}
+void sort_correctness::test_heap_sort() {
+    std::cout << "Start checking heap sort fallback!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        for(auto pattern : this->generate_patterns(this->generate_count(1000))) {
+            auto correct {pattern};
+            std::sort(correct.begin(), correct.end());
+            less<> compare {};
+            __dsi::heap_sort(pattern.data(), pattern.data() + pattern.size(), compare);
+            assert(pattern == correct);
+        }
+    }
+    std::cout << "\ttest_heap_sort/Patterns of int checking done." << std::endl;
+
+    std::cout << "Checking heap sort fallback finished!" << std::endl;
+}
+void sort_correctness::test_radix_sort() {
+    std::cout << "Start checking radix_sort!" << std::endl;
+
+    for(auto i {0}; i < 10; ++i) {
+        const auto count {this->generate_count(10000)};
+        this->check_radix_sort<signed char>(count);
+        this->check_radix_sort<unsigned char>(count);
+        this->check_radix_sort<short>(count);
+        this->check_radix_sort<unsigned short>(count);
+        this->check_radix_sort<int>(count);
+        this->check_radix_sort<unsigned>(count);
+        this->check_radix_sort<long long>(count);
+        this->check_radix_sort<unsigned long long>(count);
+    }
+    std::cout << "\ttest_radix_sort/Integers of every width checking done." << std::endl;
+
+    // the passes are skipped when the byte is same for all keys
+    {
+        std::vector<unsigned long long> v {};
+        for(const auto value : this->generate_random_sequence(0, 1000, 5000)) {
+            v.push_back(static_cast<unsigned long long>(value) << 24 | 0xFF00000000000000ull);
+        }
+        auto correct {v};
+        std::sort(correct.begin(), correct.end());
+        std::vector<unsigned long long> scratch(v.size());
+        radix_sort(v.data(), v.data() + v.size(), scratch.data());
+        assert(v == correct);
+        std::cout << "\ttest_radix_sort/Skipped passes checking done." << std::endl;
+    }
+
+    {
+        vector<int> v {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(10000))) {
+            v.push_back(value);
+        }
+        radix_sort(v.begin(), v.end());
+        assert(std::is_sorted(v.data(), v.data() + v.size()));
+        std::cout << "\ttest_radix_sort/ds::vector checking done." << std::endl;
+    }
+
+    std::cout << "Checking radix_sort finished!" << std::endl;
+}
+void sort_correctness::test_radix_sort_floating_point() {
+    std::cout << "Start checking radix_sort with floating point numbers!" << std::endl;
+
+    {
+        std::vector<double> v {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(10000))) {
+            v.push_back(static_cast<double>(value) / 7.0 - 1000.0);
+        }
+        v.push_back(std::numeric_limits<double>::infinity());
+        v.push_back(-std::numeric_limits<double>::infinity());
+        v.push_back(std::numeric_limits<double>::denorm_min());
+        v.push_back(-std::numeric_limits<double>::denorm_min());
+        v.push_back(0.0);
+        v.push_back(-0.0);
+        auto correct {v};
+        std::sort(correct.begin(), correct.end());
+        radix_sort(v.data(), v.data() + v.size());
+        assert(v == correct);
+        std::cout << "\ttest_radix_sort_floating_point/double checking done." << std::endl;
+    }
+
+    {
+        std::vector<float> v {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(10000))) {
+            v.push_back(static_cast<float>(value) / 3.0f - 50000.0f);
+        }
+        auto correct {v};
+        std::sort(correct.begin(), correct.end());
+        radix_sort(v.data(), v.data() + v.size());
+        assert(v == correct);
+        std::cout << "\ttest_radix_sort_floating_point/float checking done." << std::endl;
+    }
+
+    // the short ranges are sorted by the radix keys as well, so NaN never breaks the order
+    {
+        const auto nan {std::numeric_limits<double>::quiet_NaN()};
+        for(auto size : {16uz, __dsi::radix_sort_threshold * 2}) {
+            std::vector<double> v {};
+            for(auto i {0uz}; v.size() < size; ++i) {
+                const auto value {i % 7 == 0 ? -0.0 : 100.0 - static_cast<double>(i)};
+                v.push_back(i % 5 == 0 ? (i % 2 == 0 ? nan : -nan) : value);
+            }
+            radix_sort(v.data(), v.data() + v.size());
+            for(auto i {1uz}; i < v.size(); ++i) {
+                assert(__dsi::radix_key(v[i - 1]) <= __dsi::radix_key(v[i]));
+            }
+            assert(std::signbit(v.front()) and std::isnan(v.front()) and std::isnan(v.back()));
+        }
+        std::cout << "\ttest_radix_sort_floating_point/NaN in short and long ranges checking done." << std::endl;
+    }
+
+    std::cout << "Checking radix_sort with floating point numbers finished!" << std::endl;
+}
+void sort_correctness::test_deque_sort() {
+    std::cout << "Start checking sort with ds::deque!" << std::endl;
+
+    static_assert(__dsa::is_segmented_iterator_v<deque<int>::iterator>);
+    for(auto i {0}; i < 10; ++i) {
+        for(const auto &pattern : this->generate_patterns(this->generate_count(20000))) {
+            // the elements are pushed at both ends, so the first block is partial
+            deque<int> d {};
+            for(auto j {0uz}; j < pattern.size(); ++j) {
+                if(j % 3 == 0) {
+                    d.push_front(pattern[j]);
+                }else {
+                    d.push_back(pattern[j]);
+                }
+            }
+            std::vector<int> correct {};
+            for(const auto value : d) {
+                correct.push_back(value);
+            }
+            std::sort(correct.begin(), correct.end());
+            ds::sort(d.begin(), d.end());
+            auto it {correct.cbegin()};
+            for(const auto value : d) {
+                assert(value == *it++);
+            }
+        }
+    }
+    std::cout << "\ttest_deque_sort/Patterns of int checking done." << std::endl;
+
+    // the ranges which do not start or end at the block boundaries
+    for(auto i {0}; i < 20; ++i) {
+        const auto pattern {this->generate_random_sequence(this->generate_count(10000) + 1)};
+        deque<int> d(pattern.cbegin().operator->(), pattern.cbegin().operator->() + pattern.size());
+        const auto size {static_cast<int>(pattern.size())};
+        const auto from {this->generate_count(size - 1)};
+        const auto to {from + this->generate_count(size - from)};
+        ds::sort(d.begin() + from, d.begin() + to, greater<> {});
+        auto correct {pattern};
+        std::sort(correct.begin() + from, correct.begin() + to, std::greater<> {});
+        for(auto j {0}; j < size; ++j) {
+            assert(d[static_cast<size_t>(j)] == correct[static_cast<size_t>(j)]);
+        }
+    }
+    std::cout << "\ttest_deque_sort/Subranges checking done." << std::endl;
+
+    // std::string is not trivially copyable, it's sorted by pdqsort on the iterators of deque
+    {
+        deque<std::string> d {};
+        std::vector<std::string> correct {};
+        for(const auto value : this->generate_random_sequence(this->generate_count(1000))) {
+            d.push_back(std::to_string(value));
+            correct.push_back(std::to_string(value));
+        }
+        ds::sort(d.begin(), d.end());
+        std::sort(correct.begin(), correct.end());
+        for(auto j {0uz}; j < correct.size(); ++j) {
+            assert(d[j] == correct[j]);
+        }
+        std::cout << "\ttest_deque_sort/std::string checking done." << std::endl;
+    }
+
+    std::cout << "Checking sort with ds::deque finished!" << std::endl;
+}
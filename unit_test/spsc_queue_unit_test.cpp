@@ -0,0 +1,264 @@
+#include <iostream>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "unit_test.hpp"
+#include "../source/spsc_queue.hpp"
+
+using namespace ds;
+class spsc_queue_correctness : public unit_test_correctness {
+private:
+    // throws when it's constructed from a negative number, the live objects are counted
+    struct counted {
+        static inline int live {0};
+        int value;
+        counted(int value) : value {value} {
+            if(value < 0) {
+                throw value;
+            }
+            ++counted::live;
+        }
+        counted(const counted &rhs) : value {rhs.value} {
+            ++counted::live;
+        }
+        counted &operator=(const counted &) = default;
+        ~counted() noexcept {
+            --counted::live;
+        }
+    };
+public:
+    ~spsc_queue_correctness() noexcept override = default;
+public:
+    void test_capacity();
+    void test_push_and_pop();
+    void test_batch();
+    void test_two_threads();
+};
+
+void spsc_queue_unit_test() {
+    auto correctness {new spsc_queue_correctness {}};
+    correctness->test_capacity();
+    correctness->test_push_and_pop();
+    correctness->test_batch();
+    correctness->test_two_threads();
+    delete correctness;
+}
+
+void spsc_queue_correctness::test_capacity() {
+    std::cout << "Start checking capacity of ds::spsc_queue!" << std::endl;
+
+    {
+        // the capacity is rounded up to a power of two
+        assert(spsc_queue<int>(0).capacity() == 1);
+        assert(spsc_queue<int>(1).capacity() == 1);
+        assert(spsc_queue<int>(3).capacity() == 4);
+        assert(spsc_queue<int>(1024).capacity() == 1024);
+        assert(spsc_queue<int>(1025).capacity() == 2048);
+        spsc_queue<int> q(100);
+        assert(q.empty() and q.size() == 0 and q.front() == nullptr);
+        for(auto n : {std::numeric_limits<size_t>::max() / 2 + 2, std::numeric_limits<size_t>::max()}) {
+            auto thrown {false};
+            try {
+                spsc_queue<int> overflow(n);
+            }catch(const std::length_error &) {
+                thrown = true;
+            }
+            assert(thrown);
+        }
+        std::cout << "\ttest_capacity/Power of two capacity checking done." << std::endl;
+    }
+    {
+        // head and tail are on different cache lines, which are not shared with the read-only members either
+        spsc_queue<int> q(16);
+        const auto address {[](const void *p) noexcept {
+            return reinterpret_cast<std::uintptr_t>(p);
+        }};
+        assert(address(&q.tail) % 64 == 0 and address(&q.head) % 64 == 0);
+        assert(address(&q.head) - address(&q.tail) >= 64);
+        assert(address(&q.tail) - address(&q.first) >= 64);
+        assert(address(&q.cached_head) - address(&q.tail) < 64);
+        assert(address(&q.cached_tail) - address(&q.head) < 64);
+        static_assert(alignof(spsc_queue<int>) == 64);
+        std::cout << "\ttest_capacity/Cache line separation checking done." << std::endl;
+    }
+
+    std::cout << "Checking capacity of ds::spsc_queue finished!" << std::endl;
+}
+void spsc_queue_correctness::test_push_and_pop() {
+    std::cout << "Start checking push and pop of ds::spsc_queue!" << std::endl;
+
+    {
+        spsc_queue<int> q(4);
+        for(auto i {0}; i < 4; ++i) {
+            assert(q.try_push(i));
+        }
+        assert(not q.try_push(4));
+        assert(q.size() == 4);
+        int value {};
+        for(auto round {0}; round < 100; ++round) {
+            assert(q.try_pop(value) and value == round);
+            assert(q.try_push(round + 4));
+        }
+        assert(*q.front() == 100);
+        q.pop();
+        while(q.try_pop(value)) {}
+        assert(value == 103 and q.empty());
+        assert(not q.try_pop(value));
+        std::cout << "\ttest_push_and_pop/Wrapped push and pop checking done." << std::endl;
+    }
+    {
+        spsc_queue<std::string> q(8);
+        for(auto i {0}; i < 6; ++i) {
+            assert(q.try_emplace(100, static_cast<char>('a' + i)));
+        }
+        const std::string value {"value"};
+        assert(q.try_push(value));
+        std::string result {};
+        assert(q.try_pop(result) and result == std::string(100, 'a'));
+        assert(q.front()->size() == 100);
+        q.pop();
+        std::cout << "\ttest_push_and_pop/std::string checking done." << std::endl;
+    }
+    {
+        // the elements left in the queue are destroyed by the destructor
+        {
+            spsc_queue<counted> q(8);
+            for(auto i {0}; i < 5; ++i) {
+                assert(q.try_emplace(i));
+            }
+            assert(counted::live == 5);
+        }
+        assert(counted::live == 0);
+        std::cout << "\ttest_push_and_pop/Destruction checking done." << std::endl;
+    }
+
+    std::cout << "Checking push and pop of ds::spsc_queue finished!" << std::endl;
+}
+void spsc_queue_correctness::test_batch() {
+    std::cout << "Start checking push_n and pop_n of ds::spsc_queue!" << std::endl;
+
+    {
+        // the batches wrap around the end of the storage
+        spsc_queue<int> q(16);
+        std::vector<int> input(40), output(40);
+        for(auto i {0}; i < 40; ++i) {
+            input[i] = i;
+        }
+        assert(q.push_n(input.data(), 10) == 10);
+        assert(q.pop_n(output.data(), 7) == 7);
+        assert(q.push_n(input.data() + 10, 30) == 13);
+        assert(q.size() == 16);
+        assert(q.push_n(input.data() + 23, 1) == 0);
+        assert(q.pop_n(output.data() + 7, 40) == 16);
+        assert(q.pop_n(output.data(), 1) == 0);
+        for(auto i {0}; i < 23; ++i) {
+            assert(output[i] == i);
+        }
+        std::cout << "\ttest_batch/Trivially copyable batch checking done." << std::endl;
+    }
+    {
+        spsc_queue<std::string> q(4);
+        std::vector<std::string> input {"a", "b", "c", "d", "e", "f"};
+        std::vector<std::string> output {};
+        assert(q.push_n(input.data(), 3) == 3);
+        assert(q.pop_n(std::back_inserter(output), 2) == 2);
+        assert(q.push_n(input.data() + 3, 3) == 3);
+        assert(q.pop_n(std::back_inserter(output), 10) == 4);
+        assert(output == input);
+        std::cout << "\ttest_batch/std::string batch checking done." << std::endl;
+    }
+    {
+        // push_n publishes nothing if a construction throws
+        spsc_queue<counted> q(8);
+        const int input[] {1, 2, -3, 4};
+        assert(q.push_n(input, 2) == 2);
+        try {
+            q.push_n(input, 4);
+            assert(false);
+        }catch(int) {}
+        assert(q.size() == 2 and counted::live == 2);
+        assert(q.front()->value == 1);
+        q.pop();
+        assert(q.front()->value == 2);
+        q.pop();
+        assert(q.empty() and counted::live == 0);
+        std::cout << "\ttest_batch/Exception safety checking done." << std::endl;
+    }
+
+    std::cout << "Checking push_n and pop_n of ds::spsc_queue finished!" << std::endl;
+}
+void spsc_queue_correctness::test_two_threads() {
+    std::cout << "Start checking one producer and one consumer of ds::spsc_queue!" << std::endl;
+
+    {
+        constexpr auto count {1000000};
+        spsc_queue<int> q(256);
+        std::thread producer([&q] {
+            int buffer[64];
+            for(auto next {0}; next < count;) {
+                auto pushed {0};
+                if(next % 3 == 0) {
+                    pushed = q.try_push(next);
+                }else {
+                    auto n {0};
+                    for(; n < 64 and next + n < count; ++n) {
+                        buffer[n] = next + n;
+                    }
+                    pushed = static_cast<int>(q.push_n(buffer, static_cast<size_t>(n)));
+                }
+                if(pushed == 0) {
+                    std::this_thread::yield();
+                }
+                next += pushed;
+            }
+        });
+        int buffer[48];
+        for(auto expected {0}; expected < count;) {
+            auto popped {0};
+            if(expected % 2 == 0) {
+                popped = q.try_pop(buffer[0]);
+            }else {
+                popped = static_cast<int>(q.pop_n(buffer, 48));
+            }
+            if(popped == 0) {
+                std::this_thread::yield();
+            }
+            for(auto i {0}; i < popped; ++i) {
+                assert(buffer[i] == expected++);
+            }
+        }
+        producer.join();
+        assert(q.empty());
+        std::cout << "\ttest_two_threads/Integer stream checking done." << std::endl;
+    }
+    {
+        constexpr auto count {100000};
+        spsc_queue<std::string> q(64);
+        std::thread producer([&q] {
+            for(auto i {0}; i < count;) {
+                if(q.try_push(std::to_string(i))) {
+                    ++i;
+                }else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        for(auto expected {0}; expected < count;) {
+            if(const auto front {q.front()}) {
+                assert(*front == std::to_string(expected));
+                q.pop();
+                ++expected;
+            }else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        assert(q.empty());
+        std::cout << "\ttest_two_threads/std::string stream checking done." << std::endl;
+    }
+
+    std::cout << "Checking one producer and one consumer of ds::spsc_queue finished!" << std::endl;
+}
@@ -3,18 +3,33 @@
 #include <iterator>
 #include "unit_test.hpp"
 
+#ifndef DATA_STRUCTURE_UNIT_TEST_MAX_COUNT
+#define DATA_STRUCTURE_UNIT_TEST_MAX_COUNT 0
+#endif
+
 __DATA_STRUCTURE_START(correctness testing base class implementation)
+/*
+ * The sizes of the randomly sized cases are capped by DATA_STRUCTURE_UNIT_TEST_MAX_COUNT, 0 keeps the whole range of
+ * int. A size is either a count, or a number drawn from [min, std::numeric_limits<int>::max()] with a non-negative min.
+ */
+static int cap_count(int min, int max) noexcept {
+    constexpr int max_count {DATA_STRUCTURE_UNIT_TEST_MAX_COUNT};
+    if(max_count == 0 or min < 0 or max <= max_count) {
+        return max;
+    }
+    return min < max_count ? max_count : min;
+}
 int unit_test_correctness::generate_count() {
     return this->generate_count(std::numeric_limits<int>::max());
 }
 int unit_test_correctness::generate_count(int max) {
-    std::uniform_int_distribution u(0, max);
+    std::uniform_int_distribution u(0, cap_count(0, max));
     std::random_device d {};
     std::default_random_engine e(d());
     return u(e);
 }
 int unit_test_correctness::generate_a_random_number(int min, int max) {
-    std::uniform_int_distribution u(min, max);
+    std::uniform_int_distribution u(min, max == std::numeric_limits<int>::max() ? cap_count(min, max) : max);
     std::random_device d {};
     std::default_random_engine e(d());
     return u(e);
@@ -1,16 +1,18 @@
 #ifndef DATA_STRUCTURE_UNIT_TEST_HPP
 #define DATA_STRUCTURE_UNIT_TEST_HPP
 
-#define private public
-
 #include <vector>
 #include <random>
 #include <cassert>
 #include <sstream>
 #include <iterator>
+#include <algorithm>
 #include <forward_list>
 #include <list>
 #include <deque>
+
+#define private public
+
 #include "../source/iterator.hpp"
 
 __DATA_STRUCTURE_START(correctness testing base class)
@@ -0,0 +1,540 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include "unit_test.hpp"
+#include "../source/vector.hpp"
+#include "../source/forward_list.hpp"
+
+using namespace ds;
+class vector_extension_correctness : public unit_test_correctness {
+public:
+    ~vector_extension_correctness() noexcept override = default;
+public:
+    void test_trivially_relocatable();
+    void test_small_vector();
+    void test_growth_policy();
+    void test_for_overwrite();
+    void test_unchecked_emplace_back();
+    void test_append_range();
+};
+
+void vector_extension_unit_test() {
+    auto correctness {new vector_extension_correctness {}};
+    correctness->test_trivially_relocatable();
+    correctness->test_small_vector();
+    correctness->test_growth_policy();
+    correctness->test_for_overwrite();
+    correctness->test_unchecked_emplace_back();
+    correctness->test_append_range();
+    delete correctness;
+}
+
+void vector_extension_correctness::test_trivially_relocatable() {
+    std::cout << "Start checking trivially relocatable type for ds::vector!" << std::endl;
+
+    static_assert(is_trivially_relocatable_v<int>);
+    static_assert(is_trivially_relocatable_v<vector<int>>);
+    static_assert(is_trivially_relocatable_v<vector<vector<int>>>);
+    static_assert(is_trivially_relocatable_v<std::unique_ptr<int>>);
+    static_assert(not is_trivially_relocatable_v<std::string>);
+
+    // vector<vector<int>>
+    {
+        vector<vector<int>> v {};
+        std::vector<std::vector<int>> r {};
+        const auto count {this->generate_count(1000)};
+        for(auto i {0}; i < count; ++i) {
+            const auto sequence {this->generate_random_sequence(this->generate_count(32))};
+            v.emplace_back(sequence.data(), sequence.data() + sequence.size());
+            r.emplace_back(sequence);
+        }
+        const auto check {[&]() {
+            assert(v.size() == r.size());
+            for(auto i {0uz}; i < r.size(); ++i) {
+                assert(v[i].size() == r[i].size());
+                for(auto j {0uz}; j < r[i].size(); ++j) {
+                    assert(v[i][j] == r[i][j]);
+                }
+            }
+        }};
+        check();
+        for(auto i {0}; i < 16; ++i) {
+            const auto position {this->generate_a_random_number(0, static_cast<int>(r.size()))};
+            const auto sequence {this->generate_random_sequence(this->generate_count(32))};
+            v.insert(position, vector<int>(sequence.data(), sequence.data() + sequence.size()), 2);
+            r.insert(r.begin() + position, 2, sequence);
+            v.emplace(position, sequence.data(), sequence.data() + sequence.size());
+            r.emplace(r.begin() + position, sequence);
+        }
+        check();
+        std::cout << "\tChecking test_trivially_relocatable/Insertion done." << std::endl;
+        for(auto i {0}; i < 16 and r.size() > 1; ++i) {
+            const auto position {this->generate_a_random_number(0, static_cast<int>(r.size()) - 2)};
+            v.erase(position, 2);
+            r.erase(r.begin() + position, r.begin() + (position + 2));
+        }
+        check();
+        std::cout << "\tChecking test_trivially_relocatable/Erasion done." << std::endl;
+        v.reserve(v.capacity() * 4 + 1);
+        v.shrink_to_fit();
+        assert(v.capacity() == v.size());
+        check();
+        std::cout << "\tChecking test_trivially_relocatable/Reallocation done." << std::endl;
+    }
+
+    // vector<std::unique_ptr<int>>
+    {
+        vector<std::unique_ptr<int>> v {};
+        for(auto i {0}; i < 1000; ++i) {
+            v.emplace_back(new int(i));
+        }
+        v.erase(0uz, 500);
+        v.emplace(0uz, new int(-1));
+        v.resize(10);
+        v.shrink_to_fit();
+        assert(*v[0] == -1);
+        for(auto i {1}; i < 10; ++i) {
+            assert(*v[i] == 499 + i);
+        }
+        std::cout << "\tChecking test_trivially_relocatable/Move-only type done." << std::endl;
+    }
+
+    std::cout << "Checking trivially relocatable type for ds::vector finished!" << std::endl;
+}
+void vector_extension_correctness::test_small_vector() {
+    std::cout << "Start checking ds::small_vector!" << std::endl;
+
+    // the elements are kept in the inline block until the size exceeds N
+    {
+        small_vector<int, 8> v {};
+        assert(v.empty() and v.is_inline() and v.capacity() == 8);
+        for(auto i {0}; i < 8; ++i) {
+            v.push_back(i);
+        }
+        assert(v.is_inline() and v.spare() == 0);
+        v.push_back(8);
+        assert(not v.is_inline() and v.capacity() >= 9);
+        v.resize(3);
+        v.shrink_to_fit();
+        assert(v.is_inline() and v.size() == 3 and v.capacity() == 8);
+        for(auto i {0}; i < 3; ++i) {
+            assert(v[i] == i);
+        }
+        assert((small_vector<int, 8>(8, 0).is_inline()));
+        assert(not (small_vector<int, 8>(9, 0).is_inline()));
+        std::cout << "\tChecking test_small_vector/Inline block done." << std::endl;
+    }
+
+    // small_vector<std::string, 4> behaves the same as std::vector<std::string>
+    {
+        small_vector<std::string, 4> v {};
+        std::vector<std::string> r {};
+        const auto check {[&]() {
+            assert(v.size() == r.size() and v.capacity() >= 4);
+            for(auto i {0uz}; i < r.size(); ++i) {
+                assert(v[i] == r[i]);
+            }
+        }};
+        for(auto i {0}; i < 1000; ++i) {
+            const auto value {std::to_string(this->generate_a_random_number()) + "_a_string_which_is_not_small"};
+            const auto size {static_cast<int>(r.size())};
+            switch(this->generate_a_random_number(0, 7)) {
+                case 0:
+                    v.emplace_back(value);
+                    r.emplace_back(value);
+                    break;
+                case 1:
+                    if(size > 0) {
+                        v.pop_back();
+                        r.pop_back();
+                    }
+                    break;
+                case 2: {
+                    const auto position {this->generate_a_random_number(0, size)};
+                    v.insert(v.cbegin() + position, value, 2);
+                    r.insert(r.begin() + position, 2, value);
+                    break;
+                }
+                case 3:
+                    if(size > 0) {
+                        const auto position {this->generate_a_random_number(0, size - 1)};
+                        v.erase(v.cbegin() + position);
+                        r.erase(r.begin() + position);
+                    }
+                    break;
+                case 4: {
+                    const auto n {static_cast<size_t>(this->generate_a_random_number(0, 12))};
+                    v.resize(n, value);
+                    r.resize(n, value);
+                    break;
+                }
+                case 5:
+                    v.shrink_to_fit();
+                    break;
+                case 6: {
+                    small_vector<std::string, 4> moved {ds::move(v)};
+                    assert(v.empty() and v.is_inline());
+                    v = moved;
+                    break;
+                }
+                default: {
+                    small_vector<std::string, 4> other {value};
+                    v.swap(other);
+                    swap(v, other);
+                    break;
+                }
+            }
+            check();
+        }
+        std::cout << "\tChecking test_small_vector/Random operations done." << std::endl;
+    }
+
+    // move assignment from a small_vector on the heap into an inline one and back
+    {
+        const auto make_value {[](int i) {
+            return std::to_string(i) + "_a_string_which_is_not_small";
+        }};
+        small_vector<std::string, 4> heap {};
+        for(auto i {0}; i < 10; ++i) {
+            heap.emplace_back(make_value(i));
+        }
+        small_vector<std::string, 4> inline_one {make_value(100), make_value(101)};
+        assert(not heap.is_inline() and inline_one.is_inline());
+        const auto heap_data {heap.data()};
+        inline_one = ds::move(heap);
+        assert(heap.empty() and heap.is_inline() and heap.capacity() == 4);
+        assert(not inline_one.is_inline() and inline_one.data() == heap_data and inline_one.size() == 10);
+        for(auto i {0}; i < 10; ++i) {
+            assert(inline_one[i] == make_value(i));
+        }
+        heap.emplace_back(make_value(200));
+        heap = ds::move(inline_one);
+        assert(inline_one.empty() and inline_one.is_inline());
+        assert(not heap.is_inline() and heap.data() == heap_data and heap.size() == 10);
+        inline_one.emplace_back(make_value(300));
+        inline_one.emplace_back(make_value(301));
+        heap = ds::move(inline_one);
+        assert(heap.is_inline() and heap.size() == 2 and heap[0] == make_value(300) and heap[1] == make_value(301));
+        assert(inline_one.empty() and inline_one.is_inline());
+        inline_one = ds::move(heap);
+        assert(inline_one.is_inline() and inline_one.size() == 2 and inline_one[1] == make_value(301));
+        std::cout << "\tChecking test_small_vector/Move assignment done." << std::endl;
+    }
+
+    // an input range fills the inline block first, the comparison is the one of ds::vector
+    {
+        std::stringstream short_stream {"0 1 2 3 4 5"};
+        small_vector<int, 8> v(int_input_iterator {short_stream}, {});
+        assert(v.is_inline() and v.size() == 6 and v.capacity() == 8);
+        std::stringstream long_stream {"0 1 2 3 4 5 6 7 8 9"};
+        small_vector<int, 8> w(int_input_iterator {long_stream}, {}, {}, 32);
+        assert(not w.is_inline() and w.size() == 10 and w.capacity() >= 32);
+        for(auto i {0}; i < 10; ++i) {
+            assert(w[i] == i);
+        }
+        assert(v == v and v not_eq w and v < w and w > v);
+        w.resize(6);
+        assert(v == w and (v <=> w) == 0);
+        w[5] = -1;
+        assert(w < v and (v <=> w) > 0);
+        std::cout << "\tChecking test_small_vector/Input range and comparison done." << std::endl;
+    }
+
+    std::cout << "Checking ds::small_vector finished!" << std::endl;
+}
+void vector_extension_correctness::test_growth_policy() {
+    std::cout << "Start checking growth policy for ds::vector!" << std::endl;
+
+    static_assert(doubling_growth_policy::next_capacity<int>(0, 1) == 1);
+    static_assert(doubling_growth_policy::next_capacity<int>(4, 5) == 8);
+    static_assert(one_and_a_half_growth_policy::next_capacity<int>(4, 5) == 6);
+    static_assert(one_and_a_half_growth_policy::next_capacity<int>(1, 2) == 2);
+    static_assert(size_class_growth_policy<>::next_capacity<int>(4, 5) == 6);
+    static_assert(size_class_growth_policy<doubling_growth_policy>::next_capacity<int>(0, 1) == 2);
+    static_assert(capped_linear_growth_policy<64, 16>::next_capacity<int>(8, 9) == 16);
+    static_assert(capped_linear_growth_policy<64, 16>::next_capacity<int>(16, 17) == 20);
+    std::cout << "\tChecking test_growth_policy/Policies done." << std::endl;
+
+    // size_class_growth_policy takes the usable size reported by the allocator as the capacity
+    {
+        vector<int, allocator<int>, size_class_growth_policy<>> v {};
+        vector<int, allocator<int>, one_and_a_half_growth_policy> w {};
+        for(auto i {0}; i < 1000; ++i) {
+            v.push_back(i);
+            w.push_back(i);
+            assert(v.capacity() == allocator<int>::usable_size(v.data(), v.size()));
+        }
+        assert(allocator<int>::usable_size(w.data(), w.capacity()) >= w.capacity());
+        for(auto i {0}; i < 1000; ++i) {
+            assert(v[i] == i);
+        }
+        std::cout << "\tChecking test_growth_policy/Usable size done." << std::endl;
+    }
+
+    const auto check {[this]<typename GrowthPolicy>() {
+        vector<int, allocator<int>, GrowthPolicy> v {};
+        const auto count {this->generate_count(10000)};
+        for(auto i {0}; i < count; ++i) {
+            v.emplace_back(i);
+        }
+        v.insert(0uz, -1, 100);
+        assert(v.size() == static_cast<size_t>(count) + 100);
+        for(auto i {0}; i < 100; ++i) {
+            assert(v[i] == -1);
+        }
+        for(auto i {0}; i < count; ++i) {
+            assert(v[100 + i] == i);
+        }
+        std::stringstream stream {};
+        for(auto i {0}; i < count; ++i) {
+            stream << i << ' ';
+        }
+        vector<int, allocator<int>, GrowthPolicy> input(int_input_iterator {stream}, {}, {}, 0);
+        assert(input.size() == static_cast<size_t>(count));
+        for(auto i {0}; i < count; ++i) {
+            assert(input[i] == i);
+        }
+    }};
+    check.template operator()<one_and_a_half_growth_policy>();
+    check.template operator()<size_class_growth_policy<>>();
+    check.template operator()<capped_linear_growth_policy<1024, 256>>();
+    std::cout << "\tChecking test_growth_policy/Growth of vector done." << std::endl;
+
+    // the spare memory is bounded by the step of capped_linear_growth_policy
+    {
+        vector<std::string, allocator<std::string>, capped_linear_growth_policy<1024, 256>> v {};
+        for(auto i {0}; i < 1000; ++i) {
+            v.emplace_back(std::to_string(i));
+            assert(v.size() <= 1024 / sizeof(std::string) or v.spare() < 256 / sizeof(std::string));
+        }
+        std::cout << "\tChecking test_growth_policy/Capped linear growth done." << std::endl;
+    }
+
+    std::cout << "Checking growth policy for ds::vector finished!" << std::endl;
+}
+
+void vector_extension_correctness::test_for_overwrite() {
+    std::cout << "Start checking resize_for_overwrite and append_uninitialized for ds::vector!" << std::endl;
+
+    {
+        vector<int> v(100, for_overwrite);
+        assert(v.size() == 100);
+        for(auto i {0}; i < 100; ++i) {
+            v[i] = i;
+        }
+        const auto capacity {v.capacity()};
+        v.resize_for_overwrite(50);
+        assert(v.size() == 50);
+        assert(v.capacity() == capacity);
+        v.resize_for_overwrite(80);
+        assert(v.size() == 80);
+        assert(v.capacity() == capacity);
+        for(auto i {0}; i < 50; ++i) {
+            assert(v[i] == i);
+        }
+        v.resize_for_overwrite(1000);
+        assert(v.size() == 1000);
+        assert(v.capacity() >= 1000);
+        for(auto i {0}; i < 50; ++i) {
+            assert(v[i] == i);
+        }
+        std::cout << "\tChecking test_for_overwrite/resize_for_overwrite done." << std::endl;
+    }
+    {
+        vector<int> v {};
+        const auto count {this->generate_count(1000)};
+        for(auto i {0}; i < count; ++i) {
+            const auto n {static_cast<size_t>(i % 7 + 1)};
+            const auto p {v.append_uninitialized(n)};
+            assert(p == v.data() + (v.size() - n));
+            for(auto j {0uz}; j < n; ++j) {
+                p[j] = i;
+            }
+        }
+        auto index {0uz};
+        for(auto i {0}; i < count; ++i) {
+            for(auto j {0}; j < i % 7 + 1; ++j) {
+                assert(v[index++] == i);
+            }
+        }
+        assert(index == v.size());
+        std::cout << "\tChecking test_for_overwrite/append_uninitialized done." << std::endl;
+    }
+    {
+        vector<std::string> v(10, for_overwrite);
+        for(auto &s : v) {
+            assert(s.empty());
+        }
+        const auto p {v.append_uninitialized(100)};
+        for(auto i {0}; i < 100; ++i) {
+            assert(p[i].empty());
+            p[i] = std::to_string(i);
+        }
+        v.resize_for_overwrite(20);
+        assert(v.size() == 20);
+        assert(v[19] == "9");
+        v.resize_for_overwrite(200);
+        assert(v.back().empty());
+        std::cout << "\tChecking test_for_overwrite/Non-trivial type done." << std::endl;
+    }
+    {
+        small_vector<int, 16> v {};
+        const auto p {v.append_uninitialized(10)};
+        for(auto i {0}; i < 10; ++i) {
+            p[i] = i;
+        }
+        assert(v.is_inline());
+        v.resize_for_overwrite(100);
+        assert(not v.is_inline());
+        for(auto i {0}; i < 10; ++i) {
+            assert(v[i] == i);
+        }
+        std::cout << "\tChecking test_for_overwrite/small_vector done." << std::endl;
+    }
+
+    std::cout << "Checking resize_for_overwrite and append_uninitialized for ds::vector finished!" << std::endl;
+}
+
+void vector_extension_correctness::test_unchecked_emplace_back() {
+    std::cout << "Start checking unchecked_emplace_back for ds::vector!" << std::endl;
+
+    {
+        vector<int> v {};
+        const auto count {this->generate_count(10000)};
+        v.reserve(count);
+        const auto capacity {v.capacity()};
+        for(auto i {0}; i < count; ++i) {
+            if(i % 2 == 0) {
+                v.unchecked_emplace_back(i);
+            }else {
+                v.unchecked_push_back(i);
+            }
+        }
+        assert(v.size() == static_cast<size_t>(count));
+        assert(v.capacity() == capacity);
+        for(auto i {0}; i < count; ++i) {
+            assert(v[i] == i);
+        }
+        std::cout << "\tChecking test_unchecked_emplace_back/Trivial type done." << std::endl;
+    }
+    {
+        vector<std::string> v {};
+        v.reserve(100);
+        for(auto i {0}; i < 100; ++i) {
+            auto str {std::to_string(i)};
+            v.unchecked_push_back(ds::move(str));
+        }
+        for(auto i {0}; i < 100; ++i) {
+            assert(v[i] == std::to_string(i));
+        }
+        std::cout << "\tChecking test_unchecked_emplace_back/Non-trivial type done." << std::endl;
+    }
+    {
+        vector<int> v {1, 2, 3};
+        const auto count {this->generate_count(1000)};
+        auto inserter {reserved_back_inserter(v, count)};
+        assert(v.spare() >= static_cast<size_t>(count));
+        for(auto i {0}; i < count; ++i) {
+            *inserter++ = i;
+        }
+        assert(v.size() == static_cast<size_t>(count) + 3);
+        for(auto i {0}; i < count; ++i) {
+            assert(v[i + 3] == i);
+        }
+        small_vector<std::string, 8> sv {};
+        auto small_inserter {reserved_back_inserter(sv, 8)};
+        for(auto i {0}; i < 8; ++i) {
+            *small_inserter++ = std::to_string(i);
+        }
+        assert(sv.is_inline());
+        assert(sv.size() == 8 and sv.back() == "7");
+        std::cout << "\tChecking test_unchecked_emplace_back/reserved_back_inserter done." << std::endl;
+    }
+    {
+        // the batches grow the capacity by the growth policy instead of the exact size
+        vector<int> v {};
+        auto growth {0};
+        for(auto batch {0}; batch < 1000; ++batch) {
+            const auto capacity {v.capacity()};
+            auto inserter {reserved_back_inserter(v, 3)};
+            growth += capacity not_eq v.capacity();
+            for(auto i {0}; i < 3; ++i) {
+                *inserter++ = batch * 3 + i;
+            }
+        }
+        assert(v.size() == 3000 and growth <= 12);
+        for(auto i {0}; i < 3000; ++i) {
+            assert(v[i] == i);
+        }
+        std::cout << "\tChecking test_unchecked_emplace_back/Batched reserved_back_inserter done." << std::endl;
+    }
+
+    std::cout << "Checking unchecked_emplace_back for ds::vector finished!" << std::endl;
+}
+
+void vector_extension_correctness::test_append_range() {
+    std::cout << "Start checking append_range for ds::vector!" << std::endl;
+
+    const auto count {this->generate_count(10000)};
+    {
+        vector<int> source {};
+        for(auto i {0}; i < count; ++i) {
+            source.emplace_back(i);
+        }
+        vector<int> v {-3, -2, -1};
+        v.append_range(source);
+        int array[] {count, count + 1, count + 2};
+        v.append_range(array);
+        assert(v.size() == static_cast<size_t>(count) + 6);
+        for(auto i {0}; i < count + 3; ++i) {
+            assert(v[i + 3] == i);
+        }
+        v.append_range(vector<int> {});
+        assert(v.size() == static_cast<size_t>(count) + 6);
+        std::cout << "\tChecking test_append_range/Contiguous range done." << std::endl;
+    }
+    {
+        forward_list<int> source {};
+        for(auto i {0}; i < count; ++i) {
+            source.emplace_front(i);
+        }
+        vector<int> v {};
+        v.append_range(source);
+        assert(v.size() == static_cast<size_t>(count));
+        for(auto i {0}; i < count; ++i) {
+            assert(v[i] == count - 1 - i);
+        }
+        vector<std::string> strings {};
+        strings.append_range(vector<std::string>(100, "string"));
+        strings.append_range(std::initializer_list<std::string> {"a", "b"});
+        assert(strings.size() == 102 and strings.back() == "b");
+        for(auto i {0}; i < 100; ++i) {
+            assert(strings[i] == "string");
+        }
+        std::cout << "\tChecking test_append_range/Forward range done." << std::endl;
+    }
+    {
+        struct input_range {
+            std::stringstream &stream;
+            int_input_iterator begin() {
+                return int_input_iterator {this->stream};
+            }
+            int_input_iterator end() {
+                return int_input_iterator {};
+            }
+        };
+        std::stringstream stream {};
+        for(auto i {0}; i < count; ++i) {
+            stream << i << ' ';
+        }
+        vector<int> v {-1};
+        v.append_range(input_range {stream});
+        assert(v.size() == static_cast<size_t>(count) + 1);
+        for(auto i {0}; i < count; ++i) {
+            assert(v[i + 1] == i);
+        }
+        std::cout << "\tChecking test_append_range/Input range done." << std::endl;
+    }
+
+    std::cout << "Checking append_range for ds::vector finished!" << std::endl;
+}